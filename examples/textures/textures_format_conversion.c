@@ -0,0 +1,132 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - Pixel formats conversion throughput
+*
+*   Example complexity rating: [★★☆☆] 2/4
+*
+*   NOTE: Measures ImageFormat() and LoadImageColors() conversion speed between pixel formats,
+*   results are given in millions of pixels converted per second (best of several runs)
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2025 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define IMAGE_SIZE          2048        // Converted image width and height
+#define BENCHMARK_RUNS         5        // Conversion runs, best time is used
+#define MAX_CONVERSIONS       10
+
+typedef struct Conversion {
+    int srcFormat;
+    int dstFormat;                      // 0: LoadImageColors()
+    const char *name;
+    double mpixels;                     // Measured throughput (Mpixels/s)
+} Conversion;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - format conversion");
+
+    Conversion conversions[MAX_CONVERSIONS] = {
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, "R8G8B8 -> R8G8B8A8", 0 },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R8G8B8, "R8G8B8A8 -> R8G8B8", 0 },
+        { PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, "GRAYSCALE -> R8G8B8A8", 0 },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, "R8G8B8A8 -> GRAYSCALE", 0 },
+        { PIXELFORMAT_UNCOMPRESSED_R5G6B5, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, "R5G6B5 -> R8G8B8A8", 0 },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, "R8G8B8A8 -> R4G4B4A4", 0 },
+        { PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, "R32G32B32A32 -> R8G8B8A8", 0 },
+        { PIXELFORMAT_UNCOMPRESSED_R16G16B16A16, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, "R16G16B16A16 -> R8G8B8A8", 0 },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, PIXELFORMAT_UNCOMPRESSED_R16G16B16A16, "R8G8B8A8 -> R16G16B16A16", 0 },
+        { PIXELFORMAT_UNCOMPRESSED_R8G8B8, 0, "R8G8B8 -> LoadImageColors()", 0 },
+    };
+
+    // Source image, converted to every source format before measuring
+    Image base = GenImagePerlinNoise(IMAGE_SIZE, IMAGE_SIZE, 0, 0, 4.0f);
+    ImageColorTint(&base, ORANGE);
+
+    double maxMpixels = 0.0;
+
+    for (int i = 0; i < MAX_CONVERSIONS; i++)
+    {
+        Image source = ImageCopy(base);
+        ImageFormat(&source, conversions[i].srcFormat);
+
+        double bestTime = 1e9;
+
+        for (int run = 0; run < BENCHMARK_RUNS; run++)
+        {
+            Image image = ImageCopy(source);    // Copy is not measured
+
+            double startTime = GetTime();
+            if (conversions[i].dstFormat != 0) ImageFormat(&image, conversions[i].dstFormat);
+            else UnloadImageColors(LoadImageColors(image));
+            double elapsedTime = GetTime() - startTime;
+
+            if (elapsedTime < bestTime) bestTime = elapsedTime;
+            UnloadImage(image);
+        }
+
+        conversions[i].mpixels = (double)IMAGE_SIZE*IMAGE_SIZE/bestTime/1000000.0;
+        if (conversions[i].mpixels > maxMpixels) maxMpixels = conversions[i].mpixels;
+
+        TraceLog(LOG_INFO, "BENCHMARK: %-30s %8.2f ms | %8.1f Mpixels/s", conversions[i].name, bestTime*1000.0, conversions[i].mpixels);
+
+        UnloadImage(source);
+    }
+
+    Texture2D texture = LoadTextureFromImage(base);
+    UnloadImage(base);
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawTextureEx(texture, (Vector2){ 580, 70 }, 0.0f, 200.0f/IMAGE_SIZE, WHITE);
+            DrawRectangleLines(580, 70, 200, 200, GRAY);
+
+            DrawText(TextFormat("IMAGE %ix%i CONVERSION (best of %i runs)", IMAGE_SIZE, IMAGE_SIZE, BENCHMARK_RUNS), 20, 20, 20, DARKGRAY);
+
+            for (int i = 0; i < MAX_CONVERSIONS; i++)
+            {
+                int barWidth = (int)(300.0*conversions[i].mpixels/maxMpixels);
+
+                DrawText(conversions[i].name, 20, 72 + i*36, 10, DARKGRAY);
+                DrawRectangle(20, 86 + i*36, barWidth, 14, (conversions[i].dstFormat != 0)? SKYBLUE : LIME);
+                DrawText(TextFormat("%.0f Mpixels/s", conversions[i].mpixels), 30 + barWidth, 88 + i*36, 10, GRAY);
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(texture);       // Texture unloading
+
+    CloseWindow();                // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - PNG images decoding throughput
+*
+*   Example complexity rating: [★★☆☆] 2/4
+*
+*   NOTE: Measures LoadImageFromMemory() decoding speed over example PNG resources,
+*   results are given in megabytes of decoded pixel data per second (best of several runs)
+*
+*   NOTE: png_oversized_zlib.png is a malformed image (zlib stream bigger than image data),
+*   it must be decoded or rejected without writing past image data
+*
+*   Example originally created with raylib 5.6, last time updated with raylib 5.6
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2025 agent
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#define BENCHMARK_RUNS         5        // Decoding runs, best time is used
+#define MAX_PNG_FILES         11
+
+typedef struct PngDecoding {
+    const char *fileName;
+    int width;
+    int height;
+    double mbytes;                      // Measured throughput (MB/s), 0: image not decoded
+} PngDecoding;
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [textures] example - png decoding");
+
+    PngDecoding decodings[MAX_PNG_FILES] = {
+        { "resources/parrots.png", 0, 0, 0 },
+        { "resources/cat.png", 0, 0, 0 },
+        { "resources/fudesumi.png", 0, 0, 0 },
+        { "resources/cyberpunk_street_background.png", 0, 0, 0 },
+        { "resources/cyberpunk_street_foreground.png", 0, 0, 0 },
+        { "resources/custom_jupiter_crash.png", 0, 0, 0 },
+        { "resources/explosion.png", 0, 0, 0 },
+        { "resources/scarfy.png", 0, 0, 0 },
+        { "resources/raylib_logo.png", 0, 0, 0 },
+        { "resources/patterns.png", 0, 0, 0 },
+        { "resources/png_oversized_zlib.png", 0, 0, 0 },
+    };
+
+    double maxMbytes = 0.0;
+    double totalBytes = 0.0;
+    double totalTime = 0.0;
+
+    for (int i = 0; i < MAX_PNG_FILES; i++)
+    {
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(decodings[i].fileName, &dataSize);   // File loading is not measured
+
+        double bestTime = 1e9;
+        int imageSize = 0;
+
+        for (int run = 0; run < BENCHMARK_RUNS; run++)
+        {
+            double startTime = GetTime();
+            Image image = LoadImageFromMemory(".png", fileData, dataSize);
+            double elapsedTime = GetTime() - startTime;
+
+            if (!IsImageValid(image)) break;
+
+            if (elapsedTime < bestTime) bestTime = elapsedTime;
+            decodings[i].width = image.width;
+            decodings[i].height = image.height;
+            imageSize = GetPixelDataSize(image.width, image.height, image.format);
+            UnloadImage(image);
+        }
+
+        UnloadFileData(fileData);
+
+        if (imageSize > 0)
+        {
+            decodings[i].mbytes = (double)imageSize/bestTime/1000000.0;
+            if (decodings[i].mbytes > maxMbytes) maxMbytes = decodings[i].mbytes;
+
+            totalBytes += imageSize;
+            totalTime += bestTime;
+
+            TraceLog(LOG_INFO, "BENCHMARK: %-45s %4ix%-4i %8.3f ms | %8.1f MB/s", decodings[i].fileName,
+                decodings[i].width, decodings[i].height, bestTime*1000.0, decodings[i].mbytes);
+        }
+        else TraceLog(LOG_INFO, "BENCHMARK: %-45s not decoded", decodings[i].fileName);
+    }
+
+    double totalMbytes = (totalTime > 0.0)? totalBytes/totalTime/1000000.0 : 0.0;
+    TraceLog(LOG_INFO, "BENCHMARK: Total %.2f MB decoded | %.1f MB/s", totalBytes/1000000.0, totalMbytes);
+
+    Texture2D texture = LoadTexture(decodings[0].fileName);
+
+    SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawTextureEx(texture, (Vector2){ 580, 70 }, 0.0f, 200.0f/texture.width, WHITE);
+            DrawRectangleLines(580, 70, 200, (int)(200.0f*texture.height/texture.width), GRAY);
+
+            DrawText(TextFormat("PNG DECODING: %.1f MB/s (best of %i runs)", totalMbytes, BENCHMARK_RUNS), 20, 20, 20, DARKGRAY);
+
+            for (int i = 0; i < MAX_PNG_FILES; i++)
+            {
+                int barWidth = (maxMbytes > 0.0)? (int)(300.0*decodings[i].mbytes/maxMbytes) : 0;
+
+                DrawText(TextFormat("%s (%ix%i)", GetFileName(decodings[i].fileName), decodings[i].width, decodings[i].height), 20, 64 + i*34, 10, DARKGRAY);
+                DrawRectangle(20, 78 + i*34, barWidth, 12, (i < (MAX_PNG_FILES - 1))? SKYBLUE : ORANGE);
+                DrawText(TextFormat("%.0f MB/s", decodings[i].mbytes), 30 + barWidth, 79 + i*34, 10, GRAY);
+            }
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadTexture(texture);       // Texture unloading
+
+    CloseWindow();                // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -115,6 +115,8 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_CAPTURE_READBACKS           3       // Maximum screen capture frames being read back from GPU (pixel buffers)
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -200,18 +202,48 @@
 #define SUPPORT_FILEFORMAT_DDS      1
 //#define SUPPORT_FILEFORMAT_HDR      1
 //#define SUPPORT_FILEFORMAT_PIC          1
-//#define SUPPORT_FILEFORMAT_KTX      1
+#define SUPPORT_FILEFORMAT_KTX      1
 //#define SUPPORT_FILEFORMAT_ASTC     1
 //#define SUPPORT_FILEFORMAT_PKM      1
 //#define SUPPORT_FILEFORMAT_PVR      1
 
-// Support image export functionality (.png, .bmp, .tga, .jpg, .qoi)
+// Support image export functionality (.png, .bmp, .tga, .jpg, .qoi, .dds, .ktx)
 #define SUPPORT_IMAGE_EXPORT            1
 // Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 #define SUPPORT_IMAGE_GENERATION        1
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support image compression to GPU compressed formats: ImageCompress() to DXT1, DXT3, DXT5, ETC1, ETC2
+#define SUPPORT_IMAGE_COMPRESSION       1
+// Support asynchronous image and texture loading: LoadImageAsync(), LoadTextureAsync()
+// NOTE: Images are decoded on background threads (if available), textures are uploaded to GPU on EndDrawing()
+#define SUPPORT_ASYNC_LOADING           1
+// Support memory mapped image loading: LoadImageMapped(), LoadImageRawMapped()
+// NOTE: Pixel data stored in file as loaded is used from file mapping (no copy), only available on POSIX systems
+#define SUPPORT_IMAGE_MAPPING           1
+// Support streaming image decoding: LoadImageStream(), LoadImageStreamRec(), LoadImageStreamRows()
+// NOTE: PNG images are decoded by scanlines on request with bounded memory, other formats are fully loaded
+#define SUPPORT_IMAGE_STREAMING         1
+// Support decoded images disk cache: SetImageCacheDirectory(), LoadImageProcessed()
+// NOTE: Cache is disabled until a cache directory is set, cached image data is memory mapped if possible
+#define SUPPORT_IMAGE_CACHE             1
+// Support non-stalling render texture readback: RequestTextureReadback(), GetTextureReadbackImage()
+// NOTE: Pixels are read into GPU pixel buffers and retrieved some frames later, synchronous read if not available
+#define SUPPORT_TEXTURE_READBACK        1
+
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define MAX_ASYNC_LOAD_REQUESTS       512       // Max number of simultaneous async loading requests
+#define MAX_ASYNC_LOAD_TASKS            8       // Max number of async tasks loading requests, other requests wait to be loaded
+#define MAX_ASYNC_UPLOAD_BYTES   16777216       // Max texture data uploaded to GPU per frame by async loading (16 MB)
+#define PNG_COMPRESSION_LEVEL           6       // Default PNG compression level for ExportImage(): 0 (fastest) to 9 (smallest)
+#define PNG_COMPRESS_CHUNK_SIZE   1048576       // PNG data compressed per independent chunk, chunks compressed in parallel (1 MB)
+#define MAX_MAPPED_IMAGES              64       // Max number of simultaneous memory mapped images
+#define IMAGE_STREAM_TILE_SIZE        256       // Image stream cached tiles size in pixels
+#define IMAGE_STREAM_CACHE_TILES       64       // Max number of cached tiles per image stream
+#define MAX_TEXTURE_READBACKS          16       // Max number of simultaneous render texture readback requests
+#define TEXTURE_READBACK_LATENCY        2       // Default frames a texture readback can be in flight before waiting for it
 
 
 //------------------------------------------------------------------------------------
@@ -224,6 +256,11 @@
 #define SUPPORT_FILEFORMAT_TTF          1
 #define SUPPORT_FILEFORMAT_FNT          1
 //#define SUPPORT_FILEFORMAT_BDF          1
+// Support raylib binary font format (.rfnt), pre-baked glyphs and atlas exported with ExportFont()
+#define SUPPORT_FILEFORMAT_RFNT         1
+// Compress font atlas pixel data (DEFLATE) on ExportFont(), it requires SUPPORT_COMPRESSION_API
+// NOTE: Uncompressed atlas data can be uploaded to GPU directly from file data on loading
+//#define SUPPORT_FONT_EXPORT_COMPRESSION 1
 
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
@@ -294,9 +331,14 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Use worker threads for expensive processing functions (image processing and generation)
+// NOTE: Number of threads can be set with SetWorkerThreads(), not available on PLATFORM_WEB
+#define SUPPORT_THREADS                 1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_WORKER_THREADS             16       // Max number of worker threads for parallel processing
+#define MAX_ASYNC_TASKS               256       // Max number of queued async tasks (background threads)
 
 #endif // CONFIG_H
@@ -11,7 +11,7 @@
 *     In those cases data is loaded uncompressed and format is returned.
 *
 *   TODO:
-*     - Implement raylib function: rlGetGlTextureFormats(), required by rl_save_ktx_to_memory()
+*     - Implement raylib function: rlGetGlTextureFormats(), required by rl_save_ktx()
 *     - Review rl_load_ktx_from_memory() to support KTX v2.2 specs
 *
 *   CONFIGURATION:
@@ -66,7 +66,11 @@ RLAPI void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int
 RLAPI void *rl_load_pvr_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 
-RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
+// Get image data location in memory data files (DDS, KTX, PVR), if data can be used directly from file data (no copy)
+RLAPI unsigned int rl_get_gputex_data_offset(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips, int *data_size);
+
+RLAPI int rl_save_dds(const char *file_name, void *data, int width, int height, int format, int mipmaps);  // Save image data as DDS file
+RLAPI int rl_save_ktx(const char *file_name, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
 
 #if defined(__cplusplus)
 }
@@ -83,6 +87,8 @@ RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int
 
 #if defined(RL_GPUTEX_IMPLEMENTATION)
 
+#include <limits.h>         // Required for: INT_MAX [Used in rl_load_dds_from_memory(), rl_get_gputex_data_offset()]
+
 // Simple log system to avoid RPNG_LOG() calls if required
 // NOTE: Avoiding those calls, also avoids const strings memory usage
 #define RL_GPUTEX_SHOW_LOG_INFO
@@ -96,7 +102,11 @@ RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 // Get pixel data size in bytes for certain pixel format
-static int get_pixel_data_size(int width, int height, int format);
+static long long get_pixel_data_size(int width, int height, int format);
+// Get pixel data size in bytes for certain pixel format, including mipmaps
+static long long get_mipmaps_data_size(int width, int height, int format, int mipmaps);
+// Get maximum number of mipmap levels for provided dimensions
+static int get_max_mipmaps(int width, int height);
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -106,7 +116,6 @@ static int get_pixel_data_size(int width, int height, int format);
 void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
 {
     void *image_data = NULL;        // Image data pointer
-    int image_pixel_size = 0;       // Image pixel size
 
     unsigned char *file_data_ptr = (unsigned char *)file_data;
 
@@ -153,7 +162,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
         unsigned int reserved2;
     } dds_header;
 
-    if (file_data_ptr != NULL)
+    if ((file_data_ptr != NULL) && (file_size >= (4 + sizeof(dds_header))))
     {
         // Verify the type of file
         unsigned char *dds_header_id = file_data_ptr;
@@ -169,133 +178,252 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
 
             file_data_ptr += sizeof(dds_header);        // Skip header
 
-            *width = header->width;
-            *height = header->height;
-
-            if (*width % 4 != 0) LOG("WARNING: IMAGE: DDS file width must be multiple of 4. Image will not display correctly");
-            if (*height % 4 != 0) LOG("WARNING: IMAGE: DDS file height must be multiple of 4. Image will not display correctly");
-
-            image_pixel_size = header->width*header->height;
-
-            if (header->mipmap_count == 0) *mips = 1;   // Parameter not used
-            else *mips = header->mipmap_count;
+            long long file_data_size = (long long)file_size - (long long)(file_data_ptr - file_data);    // Available pixel data size
+            int data_format = 0;                        // Pixel data format (0: not supported)
 
             if (header->ddspf.rgb_bit_count == 16)      // 16bit mode, no compressed
             {
-                if (header->ddspf.flags == 0x40)        // No alpha channel
+                if (header->ddspf.flags == 0x40) data_format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;    // No alpha channel
+                else if (header->ddspf.flags == 0x41)   // With alpha channel
                 {
-                    int data_size = image_pixel_size*sizeof(unsigned short);
-                    if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                    image_data = RL_MALLOC(data_size);
-
-                    memcpy(image_data, file_data_ptr, data_size);
-
-                    *format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+                    if (header->ddspf.a_bit_mask == 0x8000) data_format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;        // 1bit alpha
+                    else if (header->ddspf.a_bit_mask == 0xf000) data_format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;   // 4bit alpha
                 }
-                else if (header->ddspf.flags == 0x41)           // With alpha channel
+            }
+            else if ((header->ddspf.flags == 0x40) && (header->ddspf.rgb_bit_count == 24)) data_format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;        // DDS_RGB, no compressed
+            else if ((header->ddspf.flags == 0x41) && (header->ddspf.rgb_bit_count == 32)) data_format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;      // DDS_RGBA, no compressed
+            else if (((header->ddspf.flags == 0x04) || (header->ddspf.flags == 0x05)) && (header->ddspf.fourcc > 0)) // Compressed
+            {
+                switch (header->ddspf.fourcc)
                 {
-                    if (header->ddspf.a_bit_mask == 0x8000)     // 1bit alpha
+                    case FOURCC_DXT1:
                     {
-                        int data_size = image_pixel_size*sizeof(unsigned short);
-                        if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                        image_data = RL_MALLOC(data_size);
+                        if (header->ddspf.flags == 0x04) data_format = PIXELFORMAT_COMPRESSED_DXT1_RGB;
+                        else data_format = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+                    } break;
+                    case FOURCC_DXT3: data_format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+                    case FOURCC_DXT5: data_format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+                    default: break;
+                }
+            }
 
-                        memcpy(image_data, file_data_ptr, data_size);
+            *format = data_format;
 
-                        unsigned char alpha = 0;
+            // Validate dimensions and mipmaps: data size (computed in 64 bit) must fit in int
+            // and at least first level must be available in file data, missing mipmap levels are discarded
+            if ((header->width == 0) || (header->height == 0) || (header->width > (unsigned int)INT_MAX) || (header->height > (unsigned int)INT_MAX) || (data_format == 0))
+            {
+                LOG("WARNING: IMAGE: DDS file data not valid");
+            }
+            else
+            {
+                *width = (int)header->width;
+                *height = (int)header->height;
 
-                        // NOTE: Data comes as A1R5G5B5, it must be reordered to R5G5B5A1
-                        for (int i = 0; i < image_pixel_size; i++)
-                        {
-                            alpha = ((unsigned short *)image_data)[i] >> 15;
-                            ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 1;
-                            ((unsigned short *)image_data)[i] += alpha;
-                        }
+                if (*width % 4 != 0) LOG("WARNING: IMAGE: DDS file width must be multiple of 4. Image will not display correctly");
+                if (*height % 4 != 0) LOG("WARNING: IMAGE: DDS file height must be multiple of 4. Image will not display correctly");
 
-                        *format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
-                    }
-                    else if (header->ddspf.a_bit_mask == 0xf000)   // 4bit alpha
-                    {
-                        int data_size = image_pixel_size*sizeof(unsigned short);
-                        if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                        image_data = RL_MALLOC(data_size);
+                int max_mips = get_max_mipmaps(*width, *height);
 
-                        memcpy(image_data, file_data_ptr, data_size);
+                if (header->mipmap_count == 0) *mips = 1;   // Parameter not used
+                else *mips = (header->mipmap_count > (unsigned int)max_mips)? max_mips : (int)header->mipmap_count;
 
-                        unsigned char alpha = 0;
+                while ((*mips > 1) && (get_mipmaps_data_size(*width, *height, data_format, *mips) > file_data_size)) (*mips)--;
 
-                        // NOTE: Data comes as A4R4G4B4, it must be reordered R4G4B4A4
-                        for (int i = 0; i < image_pixel_size; i++)
+                long long data_size = get_mipmaps_data_size(*width, *height, data_format, *mips);
+
+                if ((data_size <= 0) || (data_size > INT_MAX) || (data_size > file_data_size))
+                {
+                    LOG("WARNING: IMAGE: DDS file data size not valid");
+                }
+                else
+                {
+                    image_data = RL_MALLOC((size_t)data_size);
+
+                    if (image_data == NULL) LOG("WARNING: IMAGE: DDS data memory could not be allocated");
+                    else
+                    {
+                        memcpy(image_data, file_data_ptr, (size_t)data_size);
+
+                        int pixel_count = (int)(data_size/((data_format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 2));
+
+                        if (data_format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
                         {
-                            alpha = ((unsigned short *)image_data)[i] >> 12;
-                            ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 4;
-                            ((unsigned short *)image_data)[i] += alpha;
+                            // NOTE: Data comes as A1R5G5B5, it must be reordered to R5G5B5A1 (including mipmaps)
+                            for (int i = 0; i < pixel_count; i++)
+                            {
+                                unsigned short alpha = ((unsigned short *)image_data)[i] >> 15;
+                                ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 1;
+                                ((unsigned short *)image_data)[i] += alpha;
+                            }
+                        }
+                        else if (data_format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)
+                        {
+                            // NOTE: Data comes as A4R4G4B4, it must be reordered R4G4B4A4 (including mipmaps)
+                            for (int i = 0; i < pixel_count; i++)
+                            {
+                                unsigned short alpha = ((unsigned short *)image_data)[i] >> 12;
+                                ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 4;
+                                ((unsigned short *)image_data)[i] += alpha;
+                            }
+                        }
+                        else if (data_format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+                        {
+                            // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
+                            // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
+                            // So, we must realign B8G8R8A8 to R8G8B8A8 (including mipmaps)
+                            for (int i = 0; i < pixel_count; i++)
+                            {
+                                unsigned char blue = ((unsigned char *)image_data)[i*4];
+                                ((unsigned char *)image_data)[i*4] = ((unsigned char *)image_data)[i*4 + 2];
+                                ((unsigned char *)image_data)[i*4 + 2] = blue;
+                            }
                         }
-
-                        *format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
                     }
                 }
             }
-            else if ((header->ddspf.flags == 0x40) && (header->ddspf.rgb_bit_count == 24))   // DDS_RGB, no compressed
-            {
-                int data_size = image_pixel_size*3*sizeof(unsigned char);
-                if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                image_data = RL_MALLOC(data_size);
+        }
+    }
 
-                memcpy(image_data, file_data_ptr, data_size);
+    return image_data;
+}
 
-                *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
-            }
-            else if ((header->ddspf.flags == 0x41) && (header->ddspf.rgb_bit_count == 32)) // DDS_RGBA, no compressed
-            {
-                int data_size = image_pixel_size*4*sizeof(unsigned char);
-                if (header->mipmap_count > 1) data_size = data_size + data_size / 3;
-                image_data = RL_MALLOC(data_size);
+// Save image data as DDS file
+// NOTE: Supported formats: DXT1, DXT3, DXT5 and uncompressed R8G8B8, R8G8B8A8 (stored as B8G8R8A8)
+int rl_save_dds(const char *file_name, void *data, int width, int height, int format, int mipmaps)
+{
+    // DDS Pixel Format
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int fourcc;
+        unsigned int rgb_bit_count;
+        unsigned int r_bit_mask;
+        unsigned int g_bit_mask;
+        unsigned int b_bit_mask;
+        unsigned int a_bit_mask;
+    } dds_pixel_format;
 
-                memcpy(image_data, file_data_ptr, data_size);
+    // DDS Header (124 bytes)
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int height;
+        unsigned int width;
+        unsigned int pitch_or_linear_size;
+        unsigned int depth;
+        unsigned int mipmap_count;
+        unsigned int reserved1[11];
+        dds_pixel_format ddspf;
+        unsigned int caps;
+        unsigned int caps2;
+        unsigned int caps3;
+        unsigned int caps4;
+        unsigned int reserved2;
+    } dds_header;
 
-                unsigned char blue = 0;
+    if (mipmaps < 1) mipmaps = 1;
 
-                // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
-                // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
-                // So, we must realign B8G8R8A8 to R8G8B8A8
-                for (int i = 0; i < image_pixel_size*4; i += 4)
-                {
-                    blue = ((unsigned char *)image_data)[i];
-                    ((unsigned char *)image_data)[i] = ((unsigned char *)image_data)[i + 2];
-                    ((unsigned char *)image_data)[i + 2] = blue;
-                }
+    dds_header header = { 0 };
+    header.size = 124;
+    header.flags = 0x1 | 0x2 | 0x4 | 0x1000;        // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
+    header.height = height;
+    header.width = width;
+    header.mipmap_count = mipmaps;
+    header.ddspf.size = 32;
+    header.caps = 0x1000;                           // DDSCAPS_TEXTURE
 
-                *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-            }
-            else if (((header->ddspf.flags == 0x04) || (header->ddspf.flags == 0x05)) && (header->ddspf.fourcc > 0)) // Compressed
-            {
-                int data_size = 0;
+    if (mipmaps > 1)
+    {
+        header.flags |= 0x20000;                    // DDSD_MIPMAPCOUNT
+        header.caps |= 0x8 | 0x400000;              // DDSCAPS_COMPLEX | DDSCAPS_MIPMAP
+    }
 
-                // Calculate data size, including all mipmaps
-                if (header->mipmap_count > 1) data_size = header->pitch_or_linear_size + header->pitch_or_linear_size / 3;
-                else data_size = header->pitch_or_linear_size;
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB: header.ddspf.flags = 0x04; header.ddspf.fourcc = FOURCC_DXT1; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: header.ddspf.flags = 0x05; header.ddspf.fourcc = FOURCC_DXT1; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA: header.ddspf.flags = 0x04; header.ddspf.fourcc = FOURCC_DXT3; break;
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA: header.ddspf.flags = 0x04; header.ddspf.fourcc = FOURCC_DXT5; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            // NOTE: Bit masks define R8G8B8 memory order, as expected by rl_load_dds_from_memory()
+            header.ddspf.flags = 0x40;              // DDPF_RGB
+            header.ddspf.rgb_bit_count = 24;
+            header.ddspf.r_bit_mask = 0x0000ff;
+            header.ddspf.g_bit_mask = 0x00ff00;
+            header.ddspf.b_bit_mask = 0xff0000;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            header.ddspf.flags = 0x41;              // DDPF_RGB | DDPF_ALPHAPIXELS
+            header.ddspf.rgb_bit_count = 32;
+            header.ddspf.r_bit_mask = 0x00ff0000;
+            header.ddspf.g_bit_mask = 0x0000ff00;
+            header.ddspf.b_bit_mask = 0x000000ff;
+            header.ddspf.a_bit_mask = 0xff000000;
+        } break;
+        default:
+        {
+            LOG("WARNING: IMAGE: Pixel format not supported for DDS export (%i)", format);
+            return false;
+        }
+    }
 
-                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
+    if (header.ddspf.fourcc != 0)
+    {
+        header.flags |= 0x80000;                    // DDSD_LINEARSIZE
+        header.pitch_or_linear_size = (unsigned int)get_pixel_data_size(width, height, format);
+    }
+    else
+    {
+        header.flags |= 0x8;                        // DDSD_PITCH
+        header.pitch_or_linear_size = width*header.ddspf.rgb_bit_count/8;
+    }
 
-                memcpy(image_data, file_data_ptr, data_size);
+    int image_data_size = (int)get_mipmaps_data_size(width, height, format, mipmaps);
+    int data_size = 4 + sizeof(dds_header) + image_data_size;
 
-                switch (header->ddspf.fourcc)
-                {
-                    case FOURCC_DXT1:
-                    {
-                        if (header->ddspf.flags == 0x04) *format = PIXELFORMAT_COMPRESSED_DXT1_RGB;
-                        else *format = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
-                    } break;
-                    case FOURCC_DXT3: *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
-                    case FOURCC_DXT5: *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
-                    default: break;
-                }
-            }
+    unsigned char *file_data = RL_MALLOC(data_size);
+
+    memcpy(file_data, "DDS ", 4);
+    memcpy(file_data + 4, &header, sizeof(dds_header));
+    memcpy(file_data + 4 + sizeof(dds_header), data, image_data_size);
+
+    // NOTE: R8G8B8A8 data is stored as B8G8R8A8, memory order of DirectX A8R8G8B8 format
+    if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        unsigned char *pixels = file_data + 4 + sizeof(dds_header);
+
+        for (int i = 0; i < image_data_size; i += 4)
+        {
+            unsigned char red = pixels[i];
+            pixels[i] = pixels[i + 2];
+            pixels[i + 2] = red;
         }
     }
 
-    return image_data;
+    // Save file data to file
+    int success = false;
+    FILE *file = fopen(file_name, "wb");
+
+    if (file != NULL)
+    {
+        int count = (int)fwrite(file_data, sizeof(unsigned char), data_size, file);
+
+        // NOTE: Success is logged by caller
+        if (count == 0) LOG("WARNING: FILEIO: [%s] Failed to write file", file_name);
+        else if (count != data_size) LOG("WARNING: FILEIO: [%s] File partially written", file_name);
+
+        int result = fclose(file);
+        if ((result == 0) && (count == data_size)) success = true;
+    }
+    else LOG("WARNING: FILEIO: [%s] Failed to open file", file_name);
+
+    RL_FREE(file_data);    // Free file data buffer
+
+    // If all data has been written correctly to file, success = 1
+    return success;
 }
 #endif
 
@@ -377,7 +505,7 @@ void *rl_load_pkm_from_memory(const unsigned char *file_data, unsigned int file_
 #endif
 
 #if defined(RL_GPUTEX_SUPPORT_KTX)
-// Load KTX compressed image data (ETC1/ETC2 compression)
+// Load KTX compressed image data (ETC1/ETC2/DXT compression)
 // TODO: Review KTX loading, many things changed!
 void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
 {
@@ -438,16 +566,36 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
 
             file_data_ptr += header->key_value_data_size; // Skip value data size
 
-            int data_size = ((int *)file_data_ptr)[0];
-            file_data_ptr += sizeof(int);
+            // Load all mipmaps data, every mipmap data block is preceded by its size
+            int data_size = 0;
+            int mipmaps = 0;
 
-            image_data = RL_MALLOC(data_size*sizeof(unsigned char));
+            for (int i = 0; i < *mips; i++)
+            {
+                if ((file_data_ptr + sizeof(int)) > (file_data + file_size)) break;
 
-            memcpy(image_data, file_data_ptr, data_size);
+                int mipmap_size = ((int *)file_data_ptr)[0];
+                file_data_ptr += sizeof(int);
+
+                if ((mipmap_size <= 0) || ((file_data_ptr + mipmap_size) > (file_data + file_size))) break;
+
+                image_data = RL_REALLOC(image_data, data_size + mipmap_size);
+                memcpy((unsigned char *)image_data + data_size, file_data_ptr, mipmap_size);
+
+                file_data_ptr += mipmap_size;
+                data_size += mipmap_size;
+                mipmaps++;
+            }
+
+            *mips = (mipmaps > 0)? mipmaps : 1;
 
             if (header->gl_internal_format == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
             else if (header->gl_internal_format == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
             else if (header->gl_internal_format == 0x9278) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+            else if (header->gl_internal_format == 0x83F0) *format = PIXELFORMAT_COMPRESSED_DXT1_RGB;
+            else if (header->gl_internal_format == 0x83F1) *format = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+            else if (header->gl_internal_format == 0x83F2) *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA;
+            else if (header->gl_internal_format == 0x83F3) *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
 
             // TODO: Support uncompressed data formats? Right now it returns format = 0!
         }
@@ -486,11 +634,7 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     // Calculate file data_size required
     int data_size = sizeof(ktx_header);
 
-    for (int i = 0, w = width, h = height; i < mipmaps; i++)
-    {
-        data_size += get_pixel_data_size(w, h, format);
-        w /= 2; h /= 2;
-    }
+    data_size += (int)get_mipmaps_data_size(width, height, format, mipmaps) + mipmaps*4;
 
     unsigned char *file_data = RL_CALLOC(data_size, 1);
     unsigned char *file_data_ptr = file_data;
@@ -505,7 +649,7 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
     // Get the image header
     memcpy(header.id, ktx_identifier, 12);  // KTX 1.1 signature
-    header.endianness = 0;
+    header.endianness = 0x04030201;         // Stored as little endian: 0x01 0x02 0x03 0x04
     header.gl_type = 0;                     // Obtained from format
     header.gl_type_size = 1;
     header.gl_format = 0;                   // Obtained from format
@@ -522,9 +666,27 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type);   // rlgl module function
     header.gl_base_internal_format = header.gl_format;    // KTX 1.1 only
 
+    // NOTE: Compressed formats internal format is saved even if not supported by current GPU
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB: header.gl_internal_format = 0x83F0; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: header.gl_internal_format = 0x83F1; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA: header.gl_internal_format = 0x83F2; break;
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA: header.gl_internal_format = 0x83F3; break;
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB: header.gl_internal_format = 0x8D64; break;
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB: header.gl_internal_format = 0x9274; break;
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: header.gl_internal_format = 0x9278; break;
+        default: break;
+    }
+
     // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
 
-    if (header.gl_format == -1) LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", header.gl_format);
+    if (header.gl_internal_format == 0)
+    {
+        LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", format);
+        RL_FREE(file_data);
+        return false;
+    }
     else
     {
         memcpy(file_data_ptr, &header, sizeof(ktx_header));
@@ -537,13 +699,13 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
         // Save all mipmaps data
         for (int i = 0; i < mipmaps; i++)
         {
-            unsigned int data_size = get_pixel_data_size(temp_width, temp_height, format);
+            unsigned int data_size = (unsigned int)get_pixel_data_size(temp_width, temp_height, format);
 
             memcpy(file_data_ptr, &data_size, sizeof(unsigned int));
             memcpy(file_data_ptr + 4, (unsigned char *)data + data_offset, data_size);
 
-            temp_width /= 2;
-            temp_height /= 2;
+            temp_width = (temp_width > 1)? temp_width/2 : 1;
+            temp_height = (temp_height > 1)? temp_height/2 : 1;
             data_offset += data_size;
             file_data_ptr += (4 + data_size);
         }
@@ -555,14 +717,14 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
     if (file != NULL)
     {
-        unsigned int count = (unsigned int)fwrite(file_data, sizeof(unsigned char), data_size, file);
+        int count = (int)fwrite(file_data, sizeof(unsigned char), data_size, file);
 
+        // NOTE: Success is logged by caller
         if (count == 0) LOG("WARNING: FILEIO: [%s] Failed to write file", file_name);
         else if (count != data_size) LOG("WARNING: FILEIO: [%s] File partially written", file_name);
-        else LOG("INFO: FILEIO: [%s] File saved successfully", file_name);
 
         int result = fclose(file);
-        if (result == 0) success = true;
+        if ((result == 0) && (count == data_size)) success = true;
     }
     else LOG("WARNING: FILEIO: [%s] Failed to open file", file_name);
 
@@ -776,13 +938,145 @@ void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file
 }
 #endif
 
+#if defined(RL_GPUTEX_SUPPORT_DDS) || defined(RL_GPUTEX_SUPPORT_KTX) || defined(RL_GPUTEX_SUPPORT_PVR)
+// Get image data location in memory data files, only if pixel data is stored in file as loaded (no reordering required)
+// NOTE: Supported files: DDS (DXT1, DXT3, DXT5, R5G6B5, R8G8B8), KTX 1.1 (single mipmap level), PVR v3 (single surface and face),
+// returns pixel data offset in file data (0 if pixel data can not be used directly from file data)
+unsigned int rl_get_gputex_data_offset(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips, int *data_size)
+{
+    unsigned int offset = 0;
+    unsigned int header[31] = { 0 };    // Header fields (32 bit)
+
+    *width = 0;
+    *height = 0;
+    *format = 0;
+    *mips = 1;
+    *data_size = 0;
+
+    if (file_data == NULL) return 0;
+
+#if defined(RL_GPUTEX_SUPPORT_DDS)
+    if ((file_size > 128) && (file_data[0] == 'D') && (file_data[1] == 'D') && (file_data[2] == 'S') && (file_data[3] == ' '))
+    {
+        // DDS header fields: [2] height, [3] width, [6] mipmap_count, pixel format: [19] flags, [20] fourcc, [21] rgb_bit_count
+        memcpy(header, file_data + 4, 31*sizeof(unsigned int));
+        unsigned int flags = header[19];
+        unsigned int fourcc = header[20];
+        unsigned int bit_count = header[21];
+
+        *width = (int)header[3];
+        *height = (int)header[2];
+        *mips = (header[6] == 0)? 1 : (int)header[6];
+
+        if ((flags == 0x40) && (bit_count == 16)) *format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+        else if ((flags == 0x40) && (bit_count == 24)) *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+        else if ((flags == 0x04) || (flags == 0x05))
+        {
+            if (fourcc == 0x31545844) *format = (flags == 0x04)? PIXELFORMAT_COMPRESSED_DXT1_RGB : PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+            else if (fourcc == 0x33545844) *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA;
+            else if (fourcc == 0x35545844) *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+        }
+
+        offset = 128;
+    }
+#endif
+#if defined(RL_GPUTEX_SUPPORT_KTX)
+    if ((file_size > 68) && (file_data[1] == 'K') && (file_data[2] == 'T') && (file_data[3] == 'X') &&
+        (file_data[4] == ' ') && (file_data[5] == '1') && (file_data[6] == '1'))
+    {
+        // KTX header fields: [4] gl_internal_format, [6] width, [7] height, [10] faces, [11] mipmap_levels, [12] key_value_data_size
+        memcpy(header, file_data + 12, 13*sizeof(unsigned int));
+
+        *width = (int)header[6];
+        *height = (int)header[7];
+
+        if (header[4] == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
+        else if (header[4] == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
+        else if (header[4] == 0x9278) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+        else if (header[4] == 0x83F0) *format = PIXELFORMAT_COMPRESSED_DXT1_RGB;
+        else if (header[4] == 0x83F1) *format = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+        else if (header[4] == 0x83F2) *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA;
+        else if (header[4] == 0x83F3) *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+
+        // NOTE: Every mipmap level is preceded by its size, only single level files are stored contiguously
+        unsigned int image_size = 0;
+        if ((header[10] <= 1) && (header[11] <= 1) && ((64 + (unsigned long long)header[12] + 4) <= file_size))
+        {
+            memcpy(&image_size, file_data + 64 + header[12], sizeof(unsigned int));
+            if (image_size == get_pixel_data_size(*width, *height, *format)) offset = 64 + header[12] + 4;
+        }
+    }
+#endif
+#if defined(RL_GPUTEX_SUPPORT_PVR)
+    if ((file_size > 52) && (file_data[0] == 'P') && (file_data[1] == 'V') && (file_data[2] == 'R') && (file_data[3] == 3))
+    {
+        // PVR header fields: [1..2] channels and channel depths, [5] height, [6] width, [8] num_surfaces, [9] num_faces, [10] num_mipmaps, [11] metadata_size
+        const unsigned char *channels = file_data + 8;
+        const unsigned char *depth = file_data + 12;
+        memcpy(header, file_data + 4, 12*sizeof(unsigned int));
+
+        *width = (int)header[6];
+        *height = (int)header[5];
+        *mips = (header[10] == 0)? 1 : (int)header[10];
+
+        if ((channels[0] == 'l') && (channels[1] == 0) && (depth[0] == 8)) *format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+        else if ((channels[0] == 'l') && (channels[1] == 'a') && (depth[0] == 8) && (depth[1] == 8)) *format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        else if ((channels[0] == 'r') && (channels[1] == 'g') && (channels[2] == 'b'))
+        {
+            if (channels[3] == 'a')
+            {
+                if ((depth[0] == 5) && (depth[1] == 5) && (depth[2] == 5) && (depth[3] == 1)) *format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+                else if ((depth[0] == 4) && (depth[1] == 4) && (depth[2] == 4) && (depth[3] == 4)) *format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+                else if ((depth[0] == 8) && (depth[1] == 8) && (depth[2] == 8) && (depth[3] == 8)) *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            }
+            else if (channels[3] == 0)
+            {
+                if ((depth[0] == 5) && (depth[1] == 6) && (depth[2] == 5)) *format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+                else if ((depth[0] == 8) && (depth[1] == 8) && (depth[2] == 8)) *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+            }
+        }
+        else if (channels[0] == 2) *format = PIXELFORMAT_COMPRESSED_PVRT_RGB;
+        else if (channels[0] == 3) *format = PIXELFORMAT_COMPRESSED_PVRT_RGBA;
+
+        // NOTE: Mipmap levels are stored contiguously, only for single surface and face
+        if ((header[8] <= 1) && (header[9] <= 1) && ((52 + (unsigned long long)header[11]) < file_size)) offset = 52 + header[11];
+    }
+#endif
+
+    if ((offset > 0) && (*format > 0) && (*width > 0) && (*height > 0) && (*mips > 0))
+    {
+        // NOTE: Sizes computed in 64 bit, mipmap levels limited to dimensions and data size must fit in int
+        int max_mips = get_max_mipmaps(*width, *height);
+        if (*mips > max_mips) *mips = max_mips;
+
+        long long size = get_mipmaps_data_size(*width, *height, *format, *mips);
+
+        // Mipmap levels not available in file data, only base level used
+        if ((size <= 0) || (size > INT_MAX) || (((long long)offset + size) > (long long)file_size))
+        {
+            *mips = 1;
+            size = get_pixel_data_size(*width, *height, *format);
+        }
+
+        if ((size <= 0) || (size > INT_MAX) || (((long long)offset + size) > (long long)file_size)) offset = 0;
+        else *data_size = (int)size;
+    }
+    else offset = 0;
+
+    if (offset == 0) *data_size = 0;
+
+    return offset;
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
 // Get pixel data size in bytes for certain pixel format
-static int get_pixel_data_size(int width, int height, int format)
+// NOTE: Size computed in 64 bit, so it can be validated by the caller
+static long long get_pixel_data_size(int width, int height, int format)
 {
-    int data_size = 0;       // Size in bytes
+    long long data_size = 0; // Size in bytes
     int bpp = 0;            // Bits per pixel
 
     switch (format)
@@ -811,11 +1105,17 @@ static int get_pixel_data_size(int width, int height, int format)
         default: break;
     }
 
-    data_size = width*height*bpp/8;  // Total data size in bytes
+    if ((width <= 0) || (height <= 0)) return 0;
 
-    // Most compressed formats works on 4x4 blocks,
+    data_size = (long long)width*height*bpp/8;  // Total data size in bytes
+
+    // Most compressed formats works on 4x4 blocks, partial blocks are stored as full blocks,
     // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))
+    {
+        data_size = (long long)((width + 3)/4)*((height + 3)/4)*(bpp*16/8);
+    }
+    else if ((width < 4) && (height < 4))
     {
         if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) data_size = 8;
         else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) data_size = 16;
@@ -823,4 +1123,35 @@ static int get_pixel_data_size(int width, int height, int format)
 
     return data_size;
 }
+
+// Get pixel data size in bytes for certain pixel format, including mipmaps
+static long long get_mipmaps_data_size(int width, int height, int format, int mipmaps)
+{
+    long long data_size = 0;
+
+    for (int i = 0; i < mipmaps; i++)
+    {
+        data_size += get_pixel_data_size(width, height, format);
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    return data_size;
+}
+
+// Get maximum number of mipmap levels for provided dimensions
+static int get_max_mipmaps(int width, int height)
+{
+    int mipmaps = 1;
+
+    while ((width > 1) || (height > 1))
+    {
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+        mipmaps++;
+    }
+
+    return mipmaps;
+}
 #endif // RL_GPUTEX_IMPLEMENTATION
@@ -219,6 +219,7 @@ sinfl_refill(struct sinfl *s) {
       s->bitcnt |= 56; /* bitcount in range [56,63] */
   } else {
       // @raysan5: added this case when bits remaining < 8
+      if (s->bitcnt < 0) s->bitcnt = 0; /* bits consumed past input end */
       int bitswant = 63 - s->bitcnt;
       int byteswant = bitswant >> 3;
       int bytesuse = s->bitend - s->bitptr <= byteswant ? (int)(s->bitend - s->bitptr) : byteswant;
@@ -356,7 +357,7 @@ sinfl_build(unsigned *tbl, unsigned char *lens, int tbl_bits, int maxlen,
     gen.sorted[off[lens[i]]++] = (short)i;
   gen.sorted += off[0];
 
-  if (used < (1 << maxlen)){
+  if (used != (1 << maxlen)){ /* incomplete or oversubscribed code */
     for (i = 0; i < 1 << tbl_bits; ++i)
       tbl[i] = (0 << 16u) | 1;
     return;
@@ -425,7 +426,7 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
 
       if ((unsigned short)len != (unsigned short)~nlen)
         return (int)(out-o);
-      if (len > (e - s.bitptr) || !len)
+      if (len > (e - s.bitptr) || len > (oe - out) || !len)
         return (int)(out-o);
 
       memcpy(out, s.bitptr, (size_t)len);
@@ -467,9 +468,11 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         sinfl_refill(&s);
         sym = sinfl_decode(&s, hlens, 7);
         switch (sym) {default: lens[n++] = (unsigned char)sym; break;
-        case 16: for (i=3+sinfl_get(&s,2);i;i--,n++) lens[n]=lens[n-1]; break;
-        case 17: for (i=3+sinfl_get(&s,3);i;i--,n++) lens[n]=0; break;
-        case 18: for (i=11+sinfl_get(&s,7);i;i--,n++) lens[n]=0; break;}
+        case 16: if (!n) return (int)(out-o); /* no previous length */
+          for (i=3+sinfl_get(&s,2);i && n<nlit+ndist;i--,n++) lens[n]=lens[n-1];
+          break;
+        case 17: for (i=3+sinfl_get(&s,3);i && n<nlit+ndist;i--,n++) lens[n]=0; break;
+        case 18: for (i=11+sinfl_get(&s,7);i && n<nlit+ndist;i--,n++) lens[n]=0; break;}
       }
       /* build lit/dist tables */
       sinfl_build(s.lits, lens, 10, 15, nlit);
@@ -490,6 +493,9 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
           *out++ = (unsigned char)sym;
           sym = sinfl_decode(&s, s.lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) {
+              return (int)(out-o);
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
@@ -510,7 +516,7 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         int dsym = sinfl_decode(&s, s.dsts, 8);
         int offs = sinfl__get(&s, dbits[dsym]) + dbase[dsym];
         unsigned char *dst = out, *src = out - offs;
-        if (sinfl_unlikely(offs > (int)(out-o))) {
+        if (sinfl_unlikely(offs > (int)(out-o) || len > (int)(oe-out))) {
           return (int)(out-o);
         }
         out = out + len;
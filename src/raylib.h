@@ -268,6 +268,32 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rtextures module
+typedef struct rImageOperation rImageOperation;
+
+// ImagePipeline, image operations recorded to be applied in a single pass
+typedef struct ImagePipeline {
+    Image image;                // Source image (not copied, must be valid until pipeline is applied)
+    int width;                  // Output image width (after recorded operations)
+    int height;                 // Output image height (after recorded operations)
+    int format;                 // Output image format (after recorded operations)
+    int operationCount;         // Recorded operations count
+    rImageOperation *operations; // Recorded operations
+} ImagePipeline;
+
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rtextures module
+typedef struct rImageStream rImageStream;
+
+// ImageStream, image file opened for decoding on request (regions, scanlines bands)
+typedef struct ImageStream {
+    int width;                  // Image width
+    int height;                 // Image height
+    int format;                 // Decoded data format (PixelFormat type)
+    rImageStream *decoder;      // Image decoder and cached tiles
+} ImageStream;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -303,6 +329,33 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// ImageAtlas, images packed into atlas pages
+typedef struct ImageAtlas {
+    Image *pages;           // Atlas pages images (R8G8B8A8)
+    int pageCount;          // Atlas pages count
+    int pageWidth;          // Atlas pages width
+    int pageHeight;         // Atlas pages height
+    int padding;            // Padding pixels around every image
+    int extrude;            // Border pixels repeated into padding
+    Rectangle *recs;        // Images rectangles in atlas pages
+    int *recPages;          // Images atlas page index (-1: not packed)
+    int recCount;           // Images count
+} ImageAtlas;
+
+// NoiseParams, fractal noise generation parameters
+// NOTE: Zero values use defaults: 6 octaves, lacunarity 2.0, gain 0.5, ridge offset 1.0
+typedef struct NoiseParams {
+    int type;               // Noise type (NoiseType)
+    Vector2 offset;         // Noise offset (in pixels)
+    float scale;            // Noise scale, noise periods along image
+    int octaves;            // Number of noise octaves summed
+    float lacunarity;       // Frequency multiplier between successive octaves
+    float gain;             // Amplitude multiplier between successive octaves
+    float ridgeOffset;      // Ridged noise offset, inverts ridges
+    float warp;             // Domain warp strength (0.0f: no warping)
+    int seed;               // Noise variation seed
+} NoiseParams;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -532,6 +585,14 @@ typedef struct AutomationEventList {
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// Text builder, appends text into a caller-owned buffer (no memory allocated)
+typedef struct TextBuilder {
+    char *buffer;                   // Text buffer (caller-owned, always '\0' terminated)
+    int capacity;                   // Buffer capacity in bytes (including '\0')
+    int length;                     // Text length in bytes (not including '\0')
+    bool truncated;                 // Text appended did not fit in buffer
+} TextBuilder;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -891,6 +952,13 @@ typedef enum {
     CUBEMAP_LAYOUT_CROSS_FOUR_BY_THREE     // Layout is defined by a 4x3 cross with cubemap faces
 } CubemapLayout;
 
+// Noise types, fractal sums of perlin noise octaves
+typedef enum {
+    NOISE_FBM = 0,                  // Fractal brownian motion, octaves summed
+    NOISE_RIDGED,                   // Ridged multifractal, octaves inverted and weighted by previous octave
+    NOISE_TURBULENCE                // Turbulence, octaves absolute values summed
+} NoiseType;
+
 // Font type, defines generation method
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
@@ -1097,6 +1165,9 @@ RLAPI void UnloadRandomSequence(int *sequence);                   // Unload rand
 
 // Misc. functions
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void StartScreenRecording(const char *fileName);            // Start recording screen frames to file (.gif, .y4m, .raw), encoded asynchronously
+RLAPI void StopScreenRecording(void);                             // Stop current screen recording, file finished asynchronously
+RLAPI bool IsScreenRecording(void);                               // Check if screen recording is active
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1104,6 +1175,7 @@ RLAPI void OpenURL(const char *url);                              // Open URL wi
 //------------------------------------------------------------------
 RLAPI void TraceLog(int logLevel, const char *text, ...);         // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
 RLAPI void SetTraceLogLevel(int logLevel);                        // Set the current threshold (minimum) log level
+RLAPI void SetWorkerThreads(int count);                           // Set number of worker threads for image processing (0: all processors, 1: no worker threads)
 RLAPI void *MemAlloc(unsigned int size);                          // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
@@ -1327,6 +1399,10 @@ RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);
 // NOTE: These functions do not require GPU access
 RLAPI Image LoadImage(const char *fileName);                                                             // Load image from file into CPU memory (RAM)
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
+RLAPI Image LoadImageMapped(const char *fileName);                                                       // Load image from file, pixel data memory mapped if possible (DDS, KTX, PVR)
+RLAPI Image LoadImageRawMapped(const char *fileName, int width, int height, int format, int headerSize); // Load image from RAW file data, pixel data memory mapped if possible
+RLAPI Image LoadImageProcessed(const char *fileName, int width, int height, int format, bool mipmaps);    // Load image resized (0: keep size), converted to format (0: keep format) and mipmaps generated, processed data cached
+RLAPI void SetImageCacheDirectory(const char *dirPath);                                                  // Set decoded images cache directory, loaded images data cached by file content (NULL: disabled)
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
@@ -1336,8 +1412,19 @@ RLAPI bool IsImageValid(Image image);
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
+RLAPI bool ExportImagePNG(Image image, const char *fileName, int level);                                  // Export image as PNG file with compression level (0: fastest, 9: smallest), returns true on success
+RLAPI unsigned char *ExportImagePNGToMemory(Image image, int level, int *fileSize);                        // Export image to memory buffer as PNG file with compression level (0: fastest, 9: smallest)
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
 
+// Image streaming functions
+// NOTE: PNG images are decoded by scanlines keeping a bounded working set, other formats are fully loaded
+RLAPI ImageStream LoadImageStream(const char *fileName);                                                 // Load image stream from file, image data decoded on request
+RLAPI bool IsImageStreamValid(ImageStream stream);                                                       // Check if an image stream is valid
+RLAPI void UnloadImageStream(ImageStream stream);                                                        // Unload image stream (decoder and cached tiles)
+RLAPI Image LoadImageStreamRows(ImageStream stream, int startRow, int rowCount);                         // Load image scanlines band from stream, successive bands decoded without restarting
+RLAPI Image LoadImageStreamRec(ImageStream stream, Rectangle rec);                                       // Load image region from stream, decoded tiles cached
+RLAPI bool ExportImageStreamTiles(ImageStream stream, const char *dirPath, int tileSize);                // Export image stream as tiled mip pyramid: dirPath/level/x_y.png, returns true on success
+
 // Image generation functions
 RLAPI Image GenImageColor(int width, int height, Color color);                                           // Generate image: plain color
 RLAPI Image GenImageGradientLinear(int width, int height, int direction, Color start, Color end);        // Generate image: linear gradient, direction in degrees [0..360], 0=Vertical gradient
@@ -1347,6 +1434,7 @@ RLAPI Image GenImageChecked(int width, int height, int checksX, int checksY, Col
 RLAPI Image GenImageWhiteNoise(int width, int height, float factor);                                     // Generate image: white noise
 RLAPI Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
 RLAPI Image GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
+RLAPI Image GenImageNoise(int width, int height, NoiseParams params);                                     // Generate image: fractal noise (fbm, ridged, turbulence) with domain warping, R32 values [0..1]
 RLAPI Image GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
 
 // Image manipulation functions
@@ -1356,6 +1444,7 @@ RLAPI Image ImageFromChannel(Image image, int selectedChannel);
 RLAPI Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
 RLAPI Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
 RLAPI void ImageFormat(Image *image, int newFormat);                                                     // Convert image data to desired format
+RLAPI void ImageCompress(Image *image, int newFormat, int quality);                                      // Compress image data to GPU compressed format (DXT, ETC), quality: 0 (fast), 1 (normal), 2 (best)
 RLAPI void ImageToPOT(Image *image, Color fill);                                                         // Convert image to POT (power-of-two)
 RLAPI void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
 RLAPI void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
@@ -1368,7 +1457,9 @@ RLAPI void ImageResize(Image *image, int newWidth, int newHeight);
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill); // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
+RLAPI void ImageMipmapsEx(Image *image, bool srgb, float alphaCutoff);                                   // Compute all mipmap levels for a provided image, with options (sRGB linear filtering, alpha test coverage)
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+RLAPI void ImageQuantize(Image *image, int colorCount, bool dither);                                     // Quantize image colors to a reduced palette (median cut), optional Floyd-Steinberg dithering
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
 RLAPI void ImageRotate(Image *image, int degrees);                                                       // Rotate image by input angle in degrees (-359 to 359)
@@ -1382,11 +1473,29 @@ RLAPI void ImageColorBrightness(Image *image, int brightness);
 RLAPI void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
 RLAPI Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
+RLAPI unsigned char *LoadImagePaletteIndices(Image image, const Color *palette, int paletteSize, bool dither); // Load palette indices from image, nearest palette color per pixel (max 256 colors)
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
 RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
+RLAPI void UnloadImagePaletteIndices(unsigned char *indices);                                           // Unload palette indices loaded with LoadImagePaletteIndices()
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 RLAPI Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
+// Image pipeline functions
+// NOTE: Operations are recorded and applied lazily, fused in a single pass over source image
+RLAPI ImagePipeline LoadImagePipeline(Image image);                                                      // Load image operations pipeline for source image (image not copied)
+RLAPI void UnloadImagePipeline(ImagePipeline pipeline);                                                  // Unload image operations pipeline (source image not unloaded)
+RLAPI Image LoadImageFromPipeline(ImagePipeline pipeline);                                               // Load image applying pipeline recorded operations
+RLAPI void ImagePipelineCrop(ImagePipeline *pipeline, Rectangle crop);                                   // Record image operation: crop
+RLAPI void ImagePipelineResize(ImagePipeline *pipeline, int newWidth, int newHeight);                    // Record image operation: resize (Bicubic scaling algorithm)
+RLAPI void ImagePipelineFormat(ImagePipeline *pipeline, int newFormat);                                  // Record image operation: convert to format
+RLAPI void ImagePipelineAlphaPremultiply(ImagePipeline *pipeline);                                       // Record image operation: premultiply alpha channel
+RLAPI void ImagePipelineColorTint(ImagePipeline *pipeline, Color color);                                 // Record image operation: color tint
+RLAPI void ImagePipelineColorInvert(ImagePipeline *pipeline);                                            // Record image operation: color invert
+RLAPI void ImagePipelineColorGrayscale(ImagePipeline *pipeline);                                         // Record image operation: color grayscale
+RLAPI void ImagePipelineColorContrast(ImagePipeline *pipeline, float contrast);                          // Record image operation: color contrast (-100 to 100)
+RLAPI void ImagePipelineColorBrightness(ImagePipeline *pipeline, int brightness);                        // Record image operation: color brightness (-255 to 255)
+RLAPI void ImagePipelineColorReplace(ImagePipeline *pipeline, Color color, Color replace);               // Record image operation: replace color
+
 // Image drawing functions
 // NOTE: Image software-rendering functions (CPU)
 RLAPI void ImageClearBackground(Image *dst, Color color);                                                // Clear image background with given color
@@ -1408,10 +1517,19 @@ RLAPI void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, C
 RLAPI void ImageDrawTriangleLines(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color);          // Draw triangle outline within an image
 RLAPI void ImageDrawTriangleFan(Image *dst, Vector2 *points, int pointCount, Color color);               // Draw a triangle fan defined by points within an image (first vertex is the center)
 RLAPI void ImageDrawTriangleStrip(Image *dst, Vector2 *points, int pointCount, Color color);             // Draw a triangle strip defined by points within an image
+RLAPI void ImageDrawLineAA(Image *dst, Vector2 start, Vector2 end, float thick, Color color);          // Draw a line defining thickness within an image, anti-aliased (color blended)
+RLAPI void ImageDrawCircleAA(Image *dst, Vector2 center, float radius, Color color);                     // Draw a filled circle within an image, anti-aliased (color blended)
+RLAPI void ImageDrawTriangleAA(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color);            // Draw triangle within an image, anti-aliased (color blended)
 RLAPI void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);             // Draw a source image within a destination image (tint applied to source)
 RLAPI void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color);   // Draw text (using default font) within an image (destination)
 RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text (custom sprite font) within an image (destination)
 
+// Image atlas functions
+// NOTE: Atlas pages can be loaded as textures, images drawn with DrawTextureRec() using atlas.recs[i] on texture of page atlas.recPages[i]
+RLAPI ImageAtlas LoadImageAtlas(const Image *images, int imageCount, int pageWidth, int pageHeight, int padding, int extrude); // Load image atlas packing images into pages (MaxRects packing), no images for an empty atlas
+RLAPI void UnloadImageAtlas(ImageAtlas atlas);                                                           // Unload image atlas pages and rectangles data
+RLAPI int ImageAtlasAdd(ImageAtlas *atlas, Image image);                                                 // Add image to atlas (incremental packing), returns image index or -1 on failure
+
 // Texture loading functions
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
@@ -1425,6 +1543,21 @@ RLAPI void UnloadRenderTexture(RenderTexture2D target);
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
 
+// Async loading functions
+// NOTE: Images are decoded on background threads, textures are uploaded to GPU on EndDrawing()
+RLAPI unsigned int LoadImageAsync(const char *fileName);                                                 // Load image from file asynchronously, returns async request id
+RLAPI unsigned int LoadTextureAsync(const char *fileName);                                               // Load texture from file asynchronously, returns async request id
+RLAPI bool IsAssetReady(unsigned int asyncId);                                                           // Check if async loading request is completed (image decoded, texture uploaded)
+RLAPI Image GetAsyncImage(unsigned int asyncId);                                                         // Get async loaded image and release request (image must be unloaded)
+RLAPI Texture2D GetAsyncTexture(unsigned int asyncId);                                                   // Get async loaded texture and release request (texture must be unloaded)
+
+// Texture readback functions
+// NOTE: Render texture pixels are read into GPU pixel buffers and retrieved some frames later without stalling the GPU
+RLAPI unsigned int RequestTextureReadback(RenderTexture2D target, Rectangle rec);                         // Request render texture pixels readback (zero size rectangle: full texture), returns readback request id
+RLAPI bool IsTextureReadbackReady(unsigned int readbackId);                                              // Check if texture readback pixel data is available (GPU copy completed)
+RLAPI Image GetTextureReadbackImage(unsigned int readbackId);                                            // Get texture readback image (waits if not ready) and release request (image must be unloaded)
+RLAPI void SetTextureReadbackLatency(int frames);                                                        // Set frames a texture readback can be in flight before waiting for it (0: synchronous reads)
+
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 RLAPI void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
@@ -1469,9 +1602,11 @@ RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
-RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
+RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info, packMethod: 0-Basic, 1-Skyline, 2-MaxRects (non-POT)
+RLAPI Image *GenImageFontAtlasPages(const GlyphInfo *glyphs, Rectangle **glyphRecs, int **glyphPages, int glyphCount, int padding, int pageWidth, int pageHeight, int *pageCount); // Generate multiple image font atlas pages of limited size (MaxRects packing)
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
+RLAPI bool ExportFont(Font font, const char *fileName);                                     // Export font as binary file (.rfnt), returns true on success
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
 
 // Text drawing functions
@@ -1503,6 +1638,7 @@ RLAPI const char *CodepointToUTF8(int codepoint, int *utf8Size);
 
 // Text strings management functions (no UTF-8 strings, only byte chars)
 // NOTE: Some strings allocate memory internally for returned strings, just be careful!
+// NOTE: Functions returning static strings use per-thread internal buffers
 RLAPI int TextCopy(char *dst, const char *src);                                             // Copy one string to another, returns bytes copied
 RLAPI bool TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 RLAPI unsigned int TextLength(const char *text);                                            // Get text length, checks for '\0' ending
@@ -1523,6 +1659,16 @@ RLAPI char *TextToCamel(const char *text);
 RLAPI int TextToInteger(const char *text);                                                  // Get integer value from text
 RLAPI float TextToFloat(const char *text);                                                  // Get float value from text
 
+// Text builder functions (caller-owned buffer, no memory allocated)
+// NOTE: Functions return false if text was truncated to fit buffer capacity
+RLAPI TextBuilder TextBuilderInit(char *buffer, int capacity);                              // Init text builder over a caller-owned buffer
+RLAPI void TextBuilderClear(TextBuilder *builder);                                          // Clear text builder content (buffer is kept)
+RLAPI bool TextBuilderAppend(TextBuilder *builder, const char *text);                       // Append text to text builder
+RLAPI bool TextBuilderAppendFormat(TextBuilder *builder, const char *text, ...);            // Append formatted text to text builder (sprintf() style)
+RLAPI bool TextBuilderAppendCodepoint(TextBuilder *builder, int codepoint);                 // Append one codepoint to text builder, UTF-8 encoded
+RLAPI bool TextBuilderAppendReplace(TextBuilder *builder, const char *text, const char *replace, const char *by); // Append text with replacements to text builder
+RLAPI bool TextBuilderAppendJoin(TextBuilder *builder, char **textList, int count, const char *delimiter); // Append text strings joined with delimiter to text builder
+
 //------------------------------------------------------------------------------------
 // Basic 3d Shapes Drawing Functions (Module: models)
 //------------------------------------------------------------------------------------
@@ -259,6 +259,9 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 #ifndef MAX_AUTOMATION_EVENTS
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
+#ifndef MAX_CAPTURE_READBACKS
+    #define MAX_CAPTURE_READBACKS          3        // Maximum screen capture frames being read back from GPU (pixel buffers)
+#endif
 
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
@@ -388,11 +391,61 @@ bool isGpuReady = false;
 static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
+// Screen capture type
+typedef enum {
+    CAPTURE_RECORDING_FRAME = 0,            // Frame added to screen recording
+    CAPTURE_RECORDING_END                   // Screen recording finished, no frame data
+} CaptureType;
+
+// Screen recording format
+typedef enum {
+    RECORDING_GIF = 0,                      // Animated GIF, frames recorded at GIF_RECORD_FRAMERATE
+    RECORDING_Y4M,                          // YUV4MPEG2 video, YUV 4:2:0 frames, every frame recorded
+    RECORDING_RAW                           // Raw video, R8G8B8A8 frames, every frame recorded
+} RecordingFormat;
+
+// Screen recording state
+// NOTE: Once started, state is only accessed by capture frames processing (async tasks)
+typedef struct ScreenRecording {
+    int format;                             // Recording format (RecordingFormat)
+    int width;                              // Recording frames width
+    int height;                             // Recording frames height
+    int frameCount;                         // Recording frames processed
+    FILE *file;                             // Recording output file (video formats)
 #if defined(SUPPORT_GIF_RECORDING)
-static unsigned int gifFrameCounter = 0;    // GIF frames counter
-static bool gifRecording = false;           // GIF recording state
-static MsfGifState gifState = { 0 };        // MSGIF context state
+    MsfGifState gifState;                   // MSGIF context state
 #endif
+    char fileName[512];                     // Recording output file path
+} ScreenRecording;
+
+// Screen capture frame, processed in order by async tasks
+typedef struct CaptureFrame {
+    int type;                               // Capture type (CaptureType)
+    int width;                              // Frame width
+    int height;                             // Frame height
+    int delay;                              // Frame delay in centiseconds (GIF recording)
+    unsigned char *data;                    // Frame pixel data (R8G8B8A8, top-down)
+    ScreenRecording *recording;             // Frame screen recording
+    struct CaptureFrame *next;              // Next frame in processing queue
+} CaptureFrame;
+
+// Screen capture readback, frame pixel data being read from GPU
+typedef struct CaptureReadback {
+    unsigned int pboId;                     // Pixel buffer id
+    int pboSize;                            // Pixel buffer size in bytes
+    void *fence;                            // Fence sync, signaled when pixel data is available
+    CaptureFrame *frame;                    // Frame waiting for pixel data
+} CaptureReadback;
+
+static CaptureReadback captureReadbacks[MAX_CAPTURE_READBACKS] = { 0 }; // Screen capture readbacks (ring buffer)
+static int captureReadbackFirst = 0;        // Screen capture readbacks first (oldest) index
+static int captureReadbackCount = 0;        // Screen capture readbacks in flight
+static CaptureFrame *captureQueueFirst = NULL;  // Capture frames processing queue first, shared with async tasks
+static CaptureFrame *captureQueueLast = NULL;   // Capture frames processing queue last, shared with async tasks
+static bool captureQueueProcessing = false; // Capture frames processing queue being processed by an async task
+
+static ScreenRecording *screenRecording = NULL; // Current screen recording
+static unsigned int recordingFrameCounter = 0;  // Screen recording time since last frame, in milliseconds (GIF)
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 // Automation events type
@@ -492,6 +545,16 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_ASYNC_LOADING)
+extern void UpdateAsyncLoading(void);   // [Module: textures] Uploads async loaded textures to GPU on EndDrawing()
+extern void CloseAsyncLoading(void);    // [Module: textures] Waits for async loading and unloads pending requests
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_TEXTURE_READBACK)
+extern void UpdateTextureReadbacks(void);   // [Module: textures] Completes texture readbacks copied by GPU on EndDrawing()
+extern void CloseTextureReadbacks(void);    // [Module: textures] Unloads texture readback requests and pixel buffers
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -506,6 +569,13 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+static void RequestScreenCapture(CaptureFrame *frame);      // Request screen pixel data for capture frame, read back asynchronously if supported
+static void UpdateScreenCapture(bool wait);                 // Queue capture frames with pixel data read back, optionally waiting for all of them
+static void CloseScreenCapture(void);                       // Finish screen capture frames processing and unload readback buffers
+static void QueueCaptureFrame(CaptureFrame *frame);         // Queue capture frame for processing on async task
+static void ProcessCaptureQueue(void *userData);            // Process queued capture frames in order (async task)
+static void ProcessCaptureFrame(CaptureFrame *frame);       // Process capture frame: add recording frame or finish recording
+
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -730,19 +800,21 @@ void InitWindow(int width, int height, const char *title)
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
-#if defined(SUPPORT_GIF_RECORDING)
-    if (gifRecording)
-    {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
-        gifRecording = false;
-    }
-#endif
+    StopScreenRecording();      // Finish screen recording, if any
+    CloseScreenCapture();       // Finish pending screen recording frames
 
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_ASYNC_LOADING)
+    CloseAsyncLoading();        // WARNING: Module required: rtextures
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_TEXTURE_READBACK)
+    CloseTextureReadbacks();    // WARNING: Module required: rtextures
+#endif
+
     rlglClose();                // De-init rlgl
 
     // De-initialize platform
@@ -897,51 +969,63 @@ void EndDrawing(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
-#if defined(SUPPORT_GIF_RECORDING)
-    // Draw record indicator
-    if (gifRecording)
+    if (screenRecording != NULL)
     {
-        #ifndef GIF_RECORD_FRAMERATE
-        #define GIF_RECORD_FRAMERATE    10
-        #endif
-        gifFrameCounter += (unsigned int)(GetFrameTime()*1000);
-
-        // NOTE: We record one gif frame depending on the desired gif framerate
-        if (gifFrameCounter > 1000/GIF_RECORD_FRAMERATE)
+        if (screenRecording->format == RECORDING_GIF)
         {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-
-            #ifndef GIF_RECORD_BITRATE
-            #define GIF_RECORD_BITRATE 16
+            #ifndef GIF_RECORD_FRAMERATE
+            #define GIF_RECORD_FRAMERATE    10
             #endif
+            recordingFrameCounter += (unsigned int)(GetFrameTime()*1000);
+
+            // NOTE: We record one gif frame depending on the desired gif framerate
+            if (recordingFrameCounter > 1000/GIF_RECORD_FRAMERATE)
+            {
+                // Request frame from backbuffer, it is read back and added to the gif asynchronously
+                CaptureFrame *frame = (CaptureFrame *)RL_CALLOC(1, sizeof(CaptureFrame));
+                frame->type = CAPTURE_RECORDING_FRAME;
+                frame->delay = recordingFrameCounter/10;    // Given how many frames have passed in centiseconds
+                frame->recording = screenRecording;
+                RequestScreenCapture(frame);
+
+                recordingFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
+            }
 
-            // Add the frame to the gif recording, given how many frames have passed in centiseconds
-            msf_gif_frame(&gifState, screenData, gifFrameCounter/10, GIF_RECORD_BITRATE, (int)((float)CORE.Window.render.width*scale.x)*4);
-            gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
+        #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
+            // Display the recording indicator every half-second
+            if ((int)(GetTime()/0.5)%2 == 1)
+            {
+                DrawCircle(30, CORE.Window.screen.height - 20, 10, MAROON);                 // WARNING: Module required: rshapes
+                DrawText("GIF RECORDING", 50, CORE.Window.screen.height - 25, 10, RED);     // WARNING: Module required: rtext
+            }
+        #endif
 
-            RL_FREE(screenData);    // Free image data
+            rlDrawRenderBatchActive();  // Update and draw internal render batch
         }
-
-    #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
-        // Display the recording indicator every half-second
-        if ((int)(GetTime()/0.5)%2 == 1)
+        else
         {
-            DrawCircle(30, CORE.Window.screen.height - 20, 10, MAROON);                 // WARNING: Module required: rshapes
-            DrawText("GIF RECORDING", 50, CORE.Window.screen.height - 25, 10, RED);     // WARNING: Module required: rtext
+            // Video formats record every frame
+            CaptureFrame *frame = (CaptureFrame *)RL_CALLOC(1, sizeof(CaptureFrame));
+            frame->type = CAPTURE_RECORDING_FRAME;
+            frame->recording = screenRecording;
+            RequestScreenCapture(frame);
         }
-    #endif
-
-        rlDrawRenderBatchActive();  // Update and draw internal render batch
     }
-#endif
+
+    UpdateScreenCapture(false);     // Queue captured frames already read back from GPU
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_ASYNC_LOADING)
+    UpdateAsyncLoading();           // Upload async loaded textures to GPU (limited per frame)
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_TEXTURE_READBACK)
+    UpdateTextureReadbacks();       // Complete texture readbacks copied by GPU (waits once latency is reached)
+#endif
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
@@ -973,27 +1057,11 @@ void EndDrawing(void)
 #if defined(SUPPORT_GIF_RECORDING)
         if (IsKeyDown(KEY_LEFT_CONTROL))
         {
-            if (gifRecording)
-            {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
-
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
-            }
+            if (screenRecording != NULL) StopScreenRecording();
             else
             {
-                gifRecording = true;
-                gifFrameCounter = 0;
-
-                Vector2 scale = GetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
                 screenshotCounter++;
-
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
+                StartScreenRecording(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter));
             }
         }
         else
@@ -1861,6 +1929,7 @@ void UnloadRandomSequence(int *sequence)
 
 // Takes a screenshot of current screen
 // NOTE: Provided fileName should not contain paths, saving to working directory
+// NOTE: Screen is read and file saved before returning, screen recordings use asynchronous readback
 void TakeScreenshot(const char *fileName)
 {
 #if defined(SUPPORT_MODULE_RTEXTURES)
@@ -1884,6 +1953,87 @@ void TakeScreenshot(const char *fileName)
 #endif
 }
 
+// Start recording screen frames to file, format defined by fileName extension
+// NOTE: Supported formats: .gif (GIF_RECORD_FRAMERATE), .y4m and .raw (R8G8B8A8, every frame),
+// frames are read back and encoded asynchronously, recording frame size is current render size
+void StartScreenRecording(const char *fileName)
+{
+    if (screenRecording != NULL) StopScreenRecording();
+
+    Vector2 scale = GetWindowScaleDPI();
+    ScreenRecording *recording = (ScreenRecording *)RL_CALLOC(1, sizeof(ScreenRecording));
+    recording->width = (int)((float)CORE.Window.render.width*scale.x);
+    recording->height = (int)((float)CORE.Window.render.height*scale.y);
+    strncpy(recording->fileName, fileName, sizeof(recording->fileName) - 1);
+
+    if (IsFileExtension(fileName, ".gif"))
+    {
+    #if defined(SUPPORT_GIF_RECORDING)
+        recording->format = RECORDING_GIF;
+        msf_gif_begin(&recording->gifState, recording->width, recording->height);
+        recordingFrameCounter = 0;
+
+        TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", GetFileName(fileName));
+    #else
+        TRACELOG(LOG_WARNING, "SYSTEM: GIF recording not supported, enable SUPPORT_GIF_RECORDING");
+        RL_FREE(recording);
+        return;
+    #endif
+    }
+    else if (IsFileExtension(fileName, ".y4m;.raw"))
+    {
+        recording->format = IsFileExtension(fileName, ".y4m")? RECORDING_Y4M : RECORDING_RAW;
+        recording->file = fopen(fileName, "wb");
+
+        if (recording->file == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to open file for screen recording", fileName);
+            RL_FREE(recording);
+            return;
+        }
+
+        if (recording->format == RECORDING_Y4M)
+        {
+            int fps = (CORE.Time.target > 0.0)? (int)(1.0/CORE.Time.target + 0.5) : 60;
+            fprintf(recording->file, "YUV4MPEG2 W%i H%i F%i:1 Ip A1:1 C420jpeg\n", recording->width, recording->height, fps);
+        }
+
+        TRACELOG(LOG_INFO, "SYSTEM: Start video recording: %s (%ix%i)", GetFileName(fileName), recording->width, recording->height);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screen recording file format not supported", fileName);
+        RL_FREE(recording);
+        return;
+    }
+
+    screenRecording = recording;
+}
+
+// Stop current screen recording
+// NOTE: Recording file is finished asynchronously, once all its frames are processed
+void StopScreenRecording(void)
+{
+    if (screenRecording == NULL) return;
+
+    // Recording end must be processed after all recording frames requested,
+    // frames still being read back from GPU are waited for and queued first
+    UpdateScreenCapture(true);
+
+    CaptureFrame *frame = (CaptureFrame *)RL_CALLOC(1, sizeof(CaptureFrame));
+    frame->type = CAPTURE_RECORDING_END;
+    frame->recording = screenRecording;
+    QueueCaptureFrame(frame);
+
+    screenRecording = NULL;
+}
+
+// Check if screen recording is active
+bool IsScreenRecording(void)
+{
+    return (screenRecording != NULL);
+}
+
 // Setup window configuration flags (view FLAGS)
 // NOTE: This function is expected to be called before window creation,
 // because it sets up some flags for the window creation process
@@ -4048,6 +4198,239 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+// Request screen pixel data for capture frame
+// NOTE: Pixel data is read into a pixel buffer and retrieved on UpdateScreenCapture() once its fence is signaled,
+// some frames later, so the GPU pipeline is not stalled; if not supported, pixel data is read immediately
+static void RequestScreenCapture(CaptureFrame *frame)
+{
+    frame->width = frame->recording->width;
+    frame->height = frame->recording->height;
+
+    // All readbacks in flight, wait for the oldest one to release its pixel buffer
+    if (captureReadbackCount == MAX_CAPTURE_READBACKS)
+    {
+        CaptureReadback *oldest = &captureReadbacks[captureReadbackFirst];
+        rlIsFenceSyncReady(oldest->fence, true);
+        UpdateScreenCapture(false);
+    }
+
+    CaptureReadback *readback = &captureReadbacks[(captureReadbackFirst + captureReadbackCount)%MAX_CAPTURE_READBACKS];
+    int size = frame->width*frame->height*4;
+
+    if (readback->pboSize < size)
+    {
+        rlUnloadPixelBuffer(readback->pboId);
+        readback->pboId = rlLoadPixelBuffer(size);
+        readback->pboSize = (readback->pboId > 0)? size : 0;
+    }
+
+    if (readback->pboId > 0)
+    {
+        rlReadScreenPixelsToBuffer(readback->pboId, frame->width, frame->height);
+        readback->fence = rlLoadFenceSync();
+        readback->frame = frame;
+        captureReadbackCount++;
+    }
+    else
+    {
+        // Pixel buffers not supported, synchronous read (already flipped)
+        frame->data = rlReadScreenPixels(frame->width, frame->height);
+        QueueCaptureFrame(frame);
+    }
+}
+
+// Queue capture frames with pixel data already read back from GPU, in requested order
+// NOTE: Pixel data is copied out of the pixel buffer flipped vertically (top-down rows)
+static void UpdateScreenCapture(bool wait)
+{
+    while (captureReadbackCount > 0)
+    {
+        CaptureReadback *readback = &captureReadbacks[captureReadbackFirst];
+
+        if (!rlIsFenceSyncReady(readback->fence, wait)) break;
+
+        CaptureFrame *frame = readback->frame;
+        int pitch = frame->width*4;
+        frame->data = (unsigned char *)RL_MALLOC(pitch*frame->height);
+
+        unsigned char *pixels = (unsigned char *)rlMapPixelBuffer(readback->pboId, pitch*frame->height);
+
+        if (pixels != NULL)
+        {
+            for (int y = 0; y < frame->height; y++) memcpy(frame->data + y*pitch, pixels + (frame->height - 1 - y)*pitch, pitch);
+            rlUnmapPixelBuffer(readback->pboId);
+        }
+        else memset(frame->data, 0, pitch*frame->height);
+
+        rlUnloadFenceSync(readback->fence);
+        readback->fence = NULL;
+        readback->frame = NULL;
+
+        captureReadbackFirst = (captureReadbackFirst + 1)%MAX_CAPTURE_READBACKS;
+        captureReadbackCount--;
+
+        QueueCaptureFrame(frame);
+    }
+}
+
+// Finish screen capture frames processing and unload readback buffers
+static void CloseScreenCapture(void)
+{
+    UpdateScreenCapture(true);
+
+    // Wait for queued capture frames to be processed
+    CloseAsyncTasks();
+
+    for (int i = 0; i < MAX_CAPTURE_READBACKS; i++)
+    {
+        rlUnloadPixelBuffer(captureReadbacks[i].pboId);
+        captureReadbacks[i].pboId = 0;
+        captureReadbacks[i].pboSize = 0;
+    }
+
+    captureReadbackFirst = 0;
+}
+
+// Queue capture frame for processing on async task
+// NOTE: Frames are processed by one task at a time, in queued order
+static void QueueCaptureFrame(CaptureFrame *frame)
+{
+    LockAsyncTasks();
+    if (captureQueueLast != NULL) captureQueueLast->next = frame;
+    else captureQueueFirst = frame;
+    captureQueueLast = frame;
+    UnlockAsyncTasks();
+
+    RunAsyncTask(ProcessCaptureQueue, NULL);
+}
+
+// Process queued capture frames in order (async task)
+// NOTE: If another task is already processing the queue, it also processes the frames queued meanwhile
+static void ProcessCaptureQueue(void *userData)
+{
+    LockAsyncTasks();
+
+    if (!captureQueueProcessing)
+    {
+        captureQueueProcessing = true;
+
+        while (captureQueueFirst != NULL)
+        {
+            CaptureFrame *frame = captureQueueFirst;
+            captureQueueFirst = frame->next;
+            if (captureQueueFirst == NULL) captureQueueLast = NULL;
+
+            UnlockAsyncTasks();
+            ProcessCaptureFrame(frame);
+            LockAsyncTasks();
+        }
+
+        captureQueueProcessing = false;
+    }
+
+    UnlockAsyncTasks();
+}
+
+// Process capture frame: add recording frame or finish recording
+static void ProcessCaptureFrame(CaptureFrame *frame)
+{
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    if (frame->data != NULL)
+    {
+        for (int i = 3; i < frame->width*frame->height*4; i += 4) frame->data[i] = 255;
+    }
+
+    ScreenRecording *recording = frame->recording;
+
+    switch (frame->type)
+    {
+        case CAPTURE_RECORDING_FRAME:
+        {
+            if (recording->format == RECORDING_GIF)
+            {
+            #if defined(SUPPORT_GIF_RECORDING)
+                #ifndef GIF_RECORD_BITRATE
+                #define GIF_RECORD_BITRATE 16
+                #endif
+                msf_gif_frame(&recording->gifState, frame->data, frame->delay, GIF_RECORD_BITRATE, frame->width*4);
+            #endif
+            }
+            else if (recording->format == RECORDING_Y4M)
+            {
+                // Convert to YUV 4:2:0 (BT.601, limited range), chroma from 2x2 pixels average
+                int width = frame->width, height = frame->height;
+                int chromaWidth = (width + 1)/2, chromaHeight = (height + 1)/2;
+                unsigned char *yuv = (unsigned char *)RL_MALLOC(width*height + 2*chromaWidth*chromaHeight);
+                unsigned char *planeY = yuv;
+                unsigned char *planeU = yuv + width*height;
+                unsigned char *planeV = planeU + chromaWidth*chromaHeight;
+
+                for (int i = 0; i < width*height; i++)
+                {
+                    const unsigned char *p = frame->data + i*4;
+                    planeY[i] = (unsigned char)(((66*p[0] + 129*p[1] + 25*p[2] + 128) >> 8) + 16);
+                }
+
+                for (int cy = 0; cy < chromaHeight; cy++)
+                {
+                    for (int cx = 0; cx < chromaWidth; cx++)
+                    {
+                        int r = 0, g = 0, b = 0, count = 0;
+
+                        for (int y = cy*2; (y < cy*2 + 2) && (y < height); y++)
+                        {
+                            for (int x = cx*2; (x < cx*2 + 2) && (x < width); x++)
+                            {
+                                const unsigned char *p = frame->data + (y*width + x)*4;
+                                r += p[0]; g += p[1]; b += p[2];
+                                count++;
+                            }
+                        }
+
+                        r /= count; g /= count; b /= count;
+
+                        // NOTE: Offset 128<<8 added before shifting to keep values positive
+                        planeU[cy*chromaWidth + cx] = (unsigned char)((-38*r - 74*g + 112*b + 32896) >> 8);
+                        planeV[cy*chromaWidth + cx] = (unsigned char)((112*r - 94*g - 18*b + 32896) >> 8);
+                    }
+                }
+
+                fwrite("FRAME\n", 1, 6, recording->file);
+                fwrite(yuv, 1, width*height + 2*chromaWidth*chromaHeight, recording->file);
+                RL_FREE(yuv);
+            }
+            else fwrite(frame->data, 1, frame->width*frame->height*4, recording->file);
+
+            recording->frameCount++;
+        } break;
+        case CAPTURE_RECORDING_END:
+        {
+            if (recording->format == RECORDING_GIF)
+            {
+            #if defined(SUPPORT_GIF_RECORDING)
+                MsfGifResult result = msf_gif_end(&recording->gifState);
+                SaveFileData(recording->fileName, result.data, (unsigned int)result.dataSize);
+                msf_gif_free(result);
+
+                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
+            #endif
+            }
+            else
+            {
+                fclose(recording->file);
+
+                TRACELOG(LOG_INFO, "SYSTEM: [%s] Finish video recording, frames: %i", recording->fileName, recording->frameCount);
+            }
+
+            RL_FREE(recording);
+        } break;
+        default: break;
+    }
+
+    RL_FREE(frame->data);
+    RL_FREE(frame);
+}
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
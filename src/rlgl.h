@@ -761,6 +761,18 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned char *rlReadFramebufferPixels(unsigned int fboId, int x, int y, int width, int height); // Read framebuffer pixel data (RGBA, bottom-up), no temporary framebuffer required
+
+// Pixel buffers management (pbo), asynchronous pixel data readback
+RLAPI unsigned int rlLoadPixelBuffer(int size);                           // Load pixel pack buffer for readback, returns 0 if not supported
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                          // Unload pixel pack buffer
+RLAPI void rlReadScreenPixelsToBuffer(unsigned int id, int width, int height); // Read screen pixel data (RGBA, bottom-up) into pixel buffer, no wait
+RLAPI void rlReadFramebufferPixelsToBuffer(unsigned int fboId, unsigned int id, int x, int y, int width, int height); // Read framebuffer pixel data (RGBA, bottom-up) into pixel buffer, no wait
+RLAPI void *rlMapPixelBuffer(unsigned int id, int size);                  // Map pixel buffer data for reading (waits for pending readback)
+RLAPI void rlUnmapPixelBuffer(unsigned int id);                           // Unmap pixel buffer data
+RLAPI void *rlLoadFenceSync(void);                                        // Insert fence sync after current GPU commands, returns NULL if not supported
+RLAPI bool rlIsFenceSyncReady(void *fence, bool wait);                   // Check fence sync signaled, optionally wait for it
+RLAPI void rlUnloadFenceSync(void *fence);                                // Unload fence sync
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(void);                               // Load an empty framebuffer
@@ -3710,6 +3722,152 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Read framebuffer pixel data (RGBA, bottom-up)
+// NOTE: Pixels are read directly from the framebuffer color attachment,
+// unlike rlReadTexturePixels() on OpenGL ES 2.0 no temporary framebuffer is created
+unsigned char *rlReadFramebufferPixels(unsigned int fboId, int x, int y, int width, int height)
+{
+    unsigned char *pixels = NULL;
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    pixels = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+
+    GLint prevFboId = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prevFboId);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glBindFramebuffer(GL_FRAMEBUFFER, prevFboId);
+#endif
+
+    return pixels;
+}
+
+// Pixel buffers management (pbo)
+//-----------------------------------------------------------------------------------------
+// Load pixel pack buffer, used as target of asynchronous pixel readbacks
+// NOTE: Returns 0 if pixel pack buffers are not supported (OpenGL 1.1, OpenGL ES 2.0)
+unsigned int rlLoadPixelBuffer(int size)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return id;
+}
+
+// Unload pixel pack buffer
+void rlUnloadPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    if (id > 0) glDeleteBuffers(1, &id);
+#endif
+}
+
+// Read screen pixel data (color buffer) into pixel buffer
+// NOTE: Read is queued on GPU, data is not flipped vertically -> (0,0) is the bottom left corner,
+// use a fence sync to know when data is available without stalling on rlMapPixelBuffer()
+void rlReadScreenPixelsToBuffer(unsigned int id, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Read framebuffer pixel data (RGBA, bottom-up) into pixel buffer
+// NOTE: Readback is queued on the GPU, pixel buffer must be mapped once completed (check with fence sync)
+void rlReadFramebufferPixelsToBuffer(unsigned int fboId, unsigned int id, int x, int y, int width, int height)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    GLint prevFboId = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &prevFboId);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fboId);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, prevFboId);
+#endif
+}
+
+// Map pixel buffer data for reading
+// NOTE: Blocks until the readback into the buffer has been completed
+void *rlMapPixelBuffer(unsigned int id, int size)
+{
+    void *data = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return data;
+}
+
+// Unmap pixel buffer data
+void rlUnmapPixelBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Insert fence sync in GPU commands stream, signaled once all previous commands are completed
+// NOTE: Returns NULL if fence syncs are not supported (OpenGL 1.1, OpenGL ES 2.0)
+void *rlLoadFenceSync(void)
+{
+    void *fence = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();      // Make sure fence (and previous commands) reach the GPU, or waiting on it could never return
+#endif
+
+    return fence;
+}
+
+// Check fence sync signaled, optionally waiting for it (blocking)
+// NOTE: NULL fence is considered signaled
+bool rlIsFenceSyncReady(void *fence, bool wait)
+{
+    bool ready = true;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    if (fence != NULL)
+    {
+        GLenum result = glClientWaitSync((GLsync)fence, 0, 0);
+
+        // Waiting in steps of 100 ms (timeout in nanoseconds) until signaled
+        while (wait && (result == GL_TIMEOUT_EXPIRED)) result = glClientWaitSync((GLsync)fence, 0, 100000000);
+
+        ready = ((result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED));
+    }
+#endif
+
+    return ready;
+}
+
+// Unload fence sync
+void rlUnloadFenceSync(void *fence)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    if (fence != NULL) glDeleteSync((GLsync)fence);
+#endif
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -5121,9 +5279,13 @@ static int rlGetPixelDataSize(int width, int height, int format)
     double bytesPerPixel = (double)bpp/8.0;
     dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
+    // Most compressed formats works on 4x4 blocks, partial blocks are stored as full blocks,
     // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))
+    {
+        dataSize = ((width + 3)/4)*((height + 3)/4)*(bpp*16/8);
+    }
+    else if ((width < 4) && (height < 4))
     {
         if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
         else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
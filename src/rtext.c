@@ -13,8 +13,14 @@
 *       #define SUPPORT_FILEFORMAT_FNT
 *       #define SUPPORT_FILEFORMAT_TTF
 *       #define SUPPORT_FILEFORMAT_BDF
+*       #define SUPPORT_FILEFORMAT_RFNT
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
+*           NOTE: RFNT is a raylib binary font format (pre-baked glyphs and atlas), generated with ExportFont()
+*
+*       #define SUPPORT_FONT_EXPORT_COMPRESSION
+*           Compress font atlas pixel data (DEFLATE) on ExportFont(), requires SUPPORT_COMPRESSION_API.
+*           Uncompressed atlas data is uploaded to GPU directly from loaded file data
 *
 *       #define SUPPORT_FONT_ATLAS_WHITE_REC
 *           On font atlas image generation [GenImageFontAtlas()], add a 3x3 pixels white rectangle
@@ -67,9 +73,16 @@
 
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stdio.h>          // Required for: vsprintf()
-#include <string.h>         // Required for: strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
+#include <string.h>         // Required for: strlen(), strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
+#include <limits.h>         // Required for: INT_MAX [Used in LoadFontRFNT()]
+
+#if defined(RL_SIMD_SSE2)
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics [Used in GetTextAsciiLength(), DecodeTextCodepoints()]
+#elif defined(RL_SIMD_NEON)
+    #include <arm_neon.h>   // Required for: NEON intrinsics [Used in GetTextAsciiLength(), DecodeTextCodepoints()]
+#endif
 
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
     #if defined(__GNUC__) // GCC and Clang
@@ -119,7 +132,32 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// RFNT file header (raylib binary font)
+// NOTE: Data is stored in machine byte order (little-endian on all supported platforms)
+// File layout: [RfntHeader][RfntGlyph x glyphCount][atlas pixel data (atlasDataSize bytes)]
+typedef struct RfntHeader {
+    char id[4];                 // File identifier: "rFNT"
+    int version;                // File version: 100
+    int baseSize;               // Font base size (default chars height)
+    int glyphCount;             // Number of glyph characters
+    int glyphPadding;           // Padding around the glyph characters
+    int atlasWidth;             // Font atlas image width
+    int atlasHeight;            // Font atlas image height
+    int atlasFormat;            // Font atlas image pixel format (PixelFormat type)
+    int atlasDataSize;          // Font atlas pixel data size in bytes (as stored)
+    int atlasCompressed;        // Font atlas pixel data is compressed (DEFLATE)
+} RfntHeader;
+
+// RFNT glyph data (raylib binary font)
+typedef struct RfntGlyph {
+    int value;                  // Character value (Unicode)
+    int offsetX;                // Character offset X when drawing
+    int offsetY;                // Character offset Y when drawing
+    int advanceX;               // Character advance position X
+    Rectangle rec;              // Character rectangle in font atlas
+} RfntGlyph;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -134,7 +172,7 @@ static Font defaultFont = { 0 };
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
-//...
+extern int PackRecsMaxRects(Rectangle *recs, bool *packed, int count, int width, int height); // [Module: textures] Pack rectangles into a bin (MaxRects)
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -145,6 +183,15 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+static Font LoadFontRFNT(const unsigned char *fileData, int dataSize);     // Load font from RFNT file data (raylib binary font)
+#endif
+#if defined(SUPPORT_TEXT_MANIPULATION)
+static int GetTextAsciiLength(const unsigned char *text, int length);   // Get number of consecutive ASCII bytes at text start
+static int DecodeTextCodepoints(const char *text, int length, int *codepoints); // Decode UTF-8 text into codepoints (bulk)
+static int CountTextCodepoints(const char *text, int length);   // Count codepoints in UTF-8 text (bulk)
+#endif
+
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -360,6 +407,10 @@ Font LoadFont(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_BDF)
     if (IsFileExtension(fileName, ".bdf")) font = LoadFontEx(fileName, FONT_TTF_DEFAULT_SIZE, NULL, FONT_TTF_DEFAULT_NUMCHARS);
     else
+#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (IsFileExtension(fileName, ".rfnt")) font = LoadFontEx(fileName, 0, NULL, 0);     // Font parameters stored in file
+    else
 #endif
     {
         Image image = LoadImage(fileName);
@@ -535,6 +586,12 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     char fileExtLower[16] = { 0 };
     strncpy(fileExtLower, TextToLower(fileType), 16 - 1);
 
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    // Pre-baked font, no glyphs rasterization or atlas packing required
+    // NOTE: fontSize and codepoints are ignored, font data is loaded as stored
+    if (TextIsEqual(fileExtLower, ".rfnt")) return LoadFontRFNT(fileData, dataSize);
+#endif
+
     font.baseSize = fontSize;
     font.glyphCount = (codepointCount > 0)? codepointCount : 95;
     font.glyphPadding = 0;
@@ -737,7 +794,7 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 }
 
 // Generate image font atlas using chars info
-// NOTE: Packing method: 0-Default, 1-Skyline
+// NOTE: Packing method: 0-Default, 1-Skyline, 2-MaxRects (tight atlas, not power-of-two: on OpenGL ES 2.0 texture wrap must be clamp)
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
 Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod)
 {
@@ -760,13 +817,72 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
     // Calculate image size based on total glyph width and glyph row count
     int totalWidth = 0;
     int maxGlyphWidth = 0;
+    int maxGlyphHeight = 0;
+    int totalArea = 0;              // Total glyphs area, including padding
 
     for (int i = 0; i < glyphCount; i++)
     {
         if (glyphs[i].image.width > maxGlyphWidth) maxGlyphWidth = glyphs[i].image.width;
+        if (glyphs[i].image.height > maxGlyphHeight) maxGlyphHeight = glyphs[i].image.height;
         totalWidth += glyphs[i].image.width + 2*padding;
+        totalArea += (glyphs[i].image.width + 2*padding)*(glyphs[i].image.height + 2*padding);
     }
 
+    // MaxRects packing rectangles, also used to compute the atlas size
+    Rectangle *packRecs = NULL;
+
+    if (packMethod == 2)
+    {
+        // Atlas size is not required to be square or power-of-two, it is computed from total glyphs area,
+        // starting with a square-like size and growing height until all glyphs fit, finally
+        // height is cropped to the actually used space
+        packRecs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+        bool *packed = (bool *)RL_MALLOC(glyphCount*sizeof(bool));
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            packRecs[i] = (Rectangle){ 0, 0, (float)(glyphs[i].image.width + 2*padding), (float)(glyphs[i].image.height + 2*padding) };
+        }
+
+        atlas.width = (int)ceilf(sqrtf(totalArea*1.05f));
+        if (atlas.width < (maxGlyphWidth + 2*padding)) atlas.width = maxGlyphWidth + 2*padding;
+        atlas.width = (atlas.width + 3) & ~3;       // Keep rows 4-byte aligned
+        atlas.height = totalArea/atlas.width + 1;
+        if (atlas.height < (maxGlyphHeight + 2*padding)) atlas.height = maxGlyphHeight + 2*padding;
+
+        while (true)
+        {
+            memset(packed, 0, glyphCount*sizeof(bool));
+            if (PackRecsMaxRects(packRecs, packed, glyphCount, atlas.width, atlas.height) == glyphCount) break;
+
+            atlas.height += (atlas.height/16 > (maxGlyphHeight + 2*padding))? atlas.height/16 : (maxGlyphHeight + 2*padding);
+        }
+
+        // Crop atlas height to used space
+        int usedHeight = 1;
+        for (int i = 0; i < glyphCount; i++)
+        {
+            if ((int)(packRecs[i].y + packRecs[i].height) > usedHeight) usedHeight = (int)(packRecs[i].y + packRecs[i].height);
+        }
+        atlas.height = usedHeight;
+
+    #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+        // Make sure there is space for the white rectangle at bottom-right corner
+        for (int i = 0; i < glyphCount; i++)
+        {
+            if (((packRecs[i].x + packRecs[i].width) > (atlas.width - 3)) && ((packRecs[i].y + packRecs[i].height) > (atlas.height - 3)) &&
+                (packRecs[i].width > 0) && (packRecs[i].height > 0))
+            {
+                atlas.height += 3;
+                break;
+            }
+        }
+    #endif
+
+        RL_FREE(packed);
+    }
+    else
+    {
 //#define SUPPORT_FONT_ATLAS_SIZE_CONSERVATIVE
 #if defined(SUPPORT_FONT_ATLAS_SIZE_CONSERVATIVE)
     int rowCount = 0;
@@ -784,11 +900,11 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
 #else
     int paddedFontSize = fontSize + 2*padding;
     // No need for a so-conservative atlas generation
-    float totalArea = totalWidth*paddedFontSize*1.2f;
-    float imageMinSize = sqrtf(totalArea);
+    float totalAreaEstimated = totalWidth*paddedFontSize*1.2f;
+    float imageMinSize = sqrtf(totalAreaEstimated);
     int imageSize = (int)powf(2, ceilf(logf(imageMinSize)/logf(2)));
 
-    if (totalArea < ((imageSize*imageSize)/2))
+    if (totalAreaEstimated < ((imageSize*imageSize)/2))
     {
         atlas.width = imageSize;    // Atlas bitmap width
         atlas.height = imageSize/2; // Atlas bitmap height
@@ -799,6 +915,7 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
         atlas.height = imageSize;  // Atlas bitmap height
     }
 #endif
+    }
 
     atlas.data = (unsigned char *)RL_CALLOC(1, atlas.width*atlas.height);   // Create a bitmap to store characters (8 bpp)
     atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
@@ -904,6 +1021,28 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
         RL_FREE(nodes);
         RL_FREE(context);
     }
+    else if (packMethod == 2)  // Use MaxRects packing algorithm (already packed on atlas sizing)
+    {
+        for (int i = 0; i < glyphCount; i++)
+        {
+            recs[i].x = packRecs[i].x + (float)padding;
+            recs[i].y = packRecs[i].y + (float)padding;
+            recs[i].width = (float)glyphs[i].image.width;
+            recs[i].height = (float)glyphs[i].image.height;
+
+            // Copy pixel data from glyph image to atlas, row by row
+            for (int y = 0; y < glyphs[i].image.height; y++)
+            {
+                memcpy((unsigned char *)atlas.data + ((int)recs[i].y + y)*atlas.width + (int)recs[i].x,
+                       (unsigned char *)glyphs[i].image.data + y*glyphs[i].image.width, glyphs[i].image.width);
+            }
+        }
+
+        RL_FREE(packRecs);
+    }
+
+    TRACELOG(LOG_INFO, "FONT: Atlas image generated (%ix%i | %i glyphs | %.1f%% packing efficiency)",
+        atlas.width, atlas.height, glyphCount, 100.0f*(float)totalArea/(float)(atlas.width*atlas.height));
 
 #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
     // Add a 3x3 white rectangle at the bottom-right corner of the generated atlas,
@@ -935,6 +1074,113 @@ Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyp
 
     return atlas;
 }
+
+// Generate font atlas pages images using glyphs info, MaxRects packing, page size limited to pageWidth x pageHeight
+// NOTE: Glyphs not fitting in a page are packed in additional pages, last page height is cropped to used space,
+// glyph page index returned in glyphPages, glyphs not fitting in an empty page get page index -1
+// WARNING: Every page must be unloaded with UnloadImage() and pages, glyphRecs, glyphPages arrays must be freed with MemFree()
+Image *GenImageFontAtlasPages(const GlyphInfo *glyphs, Rectangle **glyphRecs, int **glyphPages, int glyphCount, int padding, int pageWidth, int pageHeight, int *pageCount)
+{
+    Image *pages = NULL;
+    *pageCount = 0;
+    *glyphRecs = NULL;
+    *glyphPages = NULL;
+
+    if ((glyphs == NULL) || (glyphCount <= 0) || (pageWidth <= 0) || (pageHeight <= 0))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Provided chars info not valid, returning no atlas pages");
+        return pages;
+    }
+
+    Rectangle *recs = (Rectangle *)RL_CALLOC(glyphCount, sizeof(Rectangle));
+    int *recPages = (int *)RL_MALLOC(glyphCount*sizeof(int));
+    Rectangle *packRecs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+    bool *packed = (bool *)RL_CALLOC(glyphCount, sizeof(bool));
+    bool *packedPrevious = (bool *)RL_MALLOC(glyphCount*sizeof(bool));
+    int totalArea = 0;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        packRecs[i] = (Rectangle){ 0, 0, (float)(glyphs[i].image.width + 2*padding), (float)(glyphs[i].image.height + 2*padding) };
+        recPages[i] = -1;
+        totalArea += (int)(packRecs[i].width*packRecs[i].height);
+    }
+
+    int packedCount = 0;
+
+    while (packedCount < glyphCount)
+    {
+        memcpy(packedPrevious, packed, glyphCount*sizeof(bool));
+        int pagePackedCount = PackRecsMaxRects(packRecs, packed, glyphCount, pageWidth, pageHeight);
+
+        if (pagePackedCount == 0)
+        {
+            for (int i = 0; i < glyphCount; i++) if (!packed[i]) TRACELOG(LOG_WARNING, "FONT: Failed to package character (%i), bigger than atlas page", i);
+            break;
+        }
+
+        packedCount += pagePackedCount;
+
+        // Create page image, last page cropped to used height
+        Image page = { 0 };
+        page.width = pageWidth;
+        page.height = pageHeight;
+        page.mipmaps = 1;
+        page.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+        if (packedCount == glyphCount)
+        {
+            int usedHeight = 1;
+            for (int i = 0; i < glyphCount; i++)
+            {
+                if (packed[i] && !packedPrevious[i] && ((int)(packRecs[i].y + packRecs[i].height) > usedHeight)) usedHeight = (int)(packRecs[i].y + packRecs[i].height);
+            }
+            page.height = usedHeight;
+        }
+
+        page.data = RL_CALLOC(page.width*page.height, 2);
+        for (int k = 0; k < page.width*page.height; k++) ((unsigned char *)page.data)[k*2] = 255;
+
+        for (int i = 0; i < glyphCount; i++)
+        {
+            if (!packed[i] || packedPrevious[i]) continue;
+
+            recs[i].x = packRecs[i].x + (float)padding;
+            recs[i].y = packRecs[i].y + (float)padding;
+            recs[i].width = (float)glyphs[i].image.width;
+            recs[i].height = (float)glyphs[i].image.height;
+            recPages[i] = *pageCount;
+
+            // Copy glyph pixels (grayscale) to page alpha channel
+            for (int y = 0; y < glyphs[i].image.height; y++)
+            {
+                unsigned char *dst = (unsigned char *)page.data + (((int)recs[i].y + y)*page.width + (int)recs[i].x)*2;
+                const unsigned char *src = (const unsigned char *)glyphs[i].image.data + y*glyphs[i].image.width;
+
+                for (int x = 0; x < glyphs[i].image.width; x++) dst[x*2 + 1] = src[x];
+            }
+        }
+
+        pages = (Image *)RL_REALLOC(pages, (*pageCount + 1)*sizeof(Image));
+        pages[*pageCount] = page;
+        (*pageCount)++;
+    }
+
+    int pagesArea = 0;
+    for (int i = 0; i < *pageCount; i++) pagesArea += pages[i].width*pages[i].height;
+
+    if (pagesArea > 0) TRACELOG(LOG_INFO, "FONT: Atlas pages generated (%i pages | %i glyphs | %.1f%% packing efficiency)",
+        *pageCount, glyphCount, 100.0f*(float)totalArea/(float)pagesArea);
+
+    RL_FREE(packedPrevious);
+    RL_FREE(packed);
+    RL_FREE(packRecs);
+
+    *glyphRecs = recs;
+    *glyphPages = recPages;
+
+    return pages;
+}
 #endif
 
 // Unload font glyphs info data (RAM)
@@ -962,6 +1208,119 @@ void UnloadFont(Font font)
     }
 }
 
+// Export font as binary file (.rfnt), returns true on success
+// NOTE: Glyphs metrics, atlas rectangles and atlas pixel data are stored, ready to be loaded with LoadFont()
+bool ExportFont(Font font, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (!IsFontValid(font)) return success;
+
+    // Get font atlas image data
+    Image atlas = { 0 };
+
+    if (isGpuReady && (font.texture.id > 0)) atlas = LoadImageFromTexture(font.texture);
+    else
+    {
+        // No GPU texture available, rebuild atlas from glyphs images and rectangles
+        // NOTE: Glyphs images are stored without padding, atlas is sized to fit all rectangles
+        int width = 1;
+        int height = 1;
+
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if ((int)(font.recs[i].x + font.recs[i].width) + font.glyphPadding > width) width = (int)(font.recs[i].x + font.recs[i].width) + font.glyphPadding;
+            if ((int)(font.recs[i].y + font.recs[i].height) + font.glyphPadding > height) height = (int)(font.recs[i].y + font.recs[i].height) + font.glyphPadding;
+        }
+
+        atlas.data = RL_CALLOC(width*height*2, 1);
+        atlas.width = width;
+        atlas.height = height;
+        atlas.mipmaps = 1;
+        atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            if (font.glyphs[i].image.data == NULL) continue;
+
+            Image glyph = ImageCopy(font.glyphs[i].image);
+            ImageFormat(&glyph, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+
+            int copyWidth = ((glyph.width < (int)font.recs[i].width)? glyph.width : (int)font.recs[i].width)*2;
+
+            for (int y = 0; (y < glyph.height) && (y < (int)font.recs[i].height); y++)
+            {
+                memcpy((unsigned char *)atlas.data + (((int)font.recs[i].y + y)*width + (int)font.recs[i].x)*2,
+                       (unsigned char *)glyph.data + y*glyph.width*2, copyWidth);
+            }
+
+            UnloadImage(glyph);
+        }
+    }
+
+    if (atlas.data != NULL)
+    {
+        int atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+        unsigned char *atlasData = (unsigned char *)atlas.data;
+        int atlasCompressed = 0;
+
+    #if defined(SUPPORT_FONT_EXPORT_COMPRESSION) && defined(SUPPORT_COMPRESSION_API)
+        int compDataSize = 0;
+        unsigned char *compData = CompressData((const unsigned char *)atlas.data, atlasDataSize, &compDataSize);
+
+        if ((compData != NULL) && (compDataSize < atlasDataSize))
+        {
+            atlasData = compData;
+            atlasDataSize = compDataSize;
+            atlasCompressed = 1;
+        }
+    #endif
+
+        RfntHeader header = { 0 };
+        memcpy(header.id, "rFNT", 4);
+        header.version = 100;
+        header.baseSize = font.baseSize;
+        header.glyphCount = font.glyphCount;
+        header.glyphPadding = font.glyphPadding;
+        header.atlasWidth = atlas.width;
+        header.atlasHeight = atlas.height;
+        header.atlasFormat = atlas.format;
+        header.atlasDataSize = atlasDataSize;
+        header.atlasCompressed = atlasCompressed;
+
+        int fileDataSize = sizeof(RfntHeader) + font.glyphCount*sizeof(RfntGlyph) + atlasDataSize;
+        unsigned char *fileData = (unsigned char *)RL_MALLOC(fileDataSize);
+        unsigned char *ptr = fileData;
+
+        memcpy(ptr, &header, sizeof(RfntHeader));
+        ptr += sizeof(RfntHeader);
+
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            RfntGlyph glyph = { font.glyphs[i].value, font.glyphs[i].offsetX, font.glyphs[i].offsetY, font.glyphs[i].advanceX, font.recs[i] };
+            memcpy(ptr, &glyph, sizeof(RfntGlyph));
+            ptr += sizeof(RfntGlyph);
+        }
+
+        memcpy(ptr, atlasData, atlasDataSize);
+
+        success = SaveFileData(fileName, fileData, fileDataSize);
+
+        RL_FREE(fileData);
+        if (atlasData != atlas.data) RL_FREE(atlasData);
+        UnloadImage(atlas);
+    }
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Font exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export font", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FONT: RFNT file format not supported, font can not be exported");
+#endif
+
+    return success;
+}
+
 // Export font as code file, returns true on success
 bool ExportFontAsCode(Font font, const char *fileName)
 {
@@ -1163,8 +1522,10 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
-        int codepointByteCount = 0;
-        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);
+        // NOTE: ASCII bytes are directly used as codepoints, no decoding required
+        int codepointByteCount = 1;
+        int codepoint = (unsigned char)text[i];
+        if (codepoint >= 0x80) codepoint = GetCodepointNext(&text[i], &codepointByteCount);
         int index = GetGlyphIndex(font, codepoint);
 
         if (codepoint == '\n')
@@ -1306,8 +1667,10 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
     {
         byteCounter++;
 
-        int codepointByteCount = 0;
-        letter = GetCodepointNext(&text[i], &codepointByteCount);
+        // NOTE: ASCII bytes are directly used as codepoints, no decoding required
+        int codepointByteCount = 1;
+        letter = (unsigned char)text[i];
+        if (letter >= 0x80) letter = GetCodepointNext(&text[i], &codepointByteCount);
         index = GetGlyphIndex(font, letter);
 
         i += codepointByteCount;
@@ -1347,6 +1710,10 @@ int GetGlyphIndex(Font font, int codepoint)
 
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
+    // Most fonts are loaded with the default charset (codepoints starting at 32, ordered),
+    // check that position first to avoid the linear search over all glyphs
+    if ((codepoint >= 32) && ((codepoint - 32) < font.glyphCount) && (font.glyphs[codepoint - 32].value == codepoint)) return (codepoint - 32);
+
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
 
     // Look for character index in the unordered charset
@@ -1399,18 +1766,15 @@ unsigned int TextLength(const char *text)
 {
     unsigned int length = 0;
 
-    if (text != NULL)
-    {
-        // NOTE: Alternative: use strlen(text)
-
-        while (*text++) length++;
-    }
+    // NOTE: strlen() is usually vectorized by the standard library
+    if (text != NULL) length = (unsigned int)strlen(text);
 
     return length;
 }
 
 // Formatting of text with variables to 'embed'
-// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
+// WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times (on same thread)
+// NOTE: Buffers are thread-local, use TextBuilderAppendFormat() for longer strings or caller-owned memory
 const char *TextFormat(const char *text, ...)
 {
 #ifndef MAX_TEXTFORMAT_BUFFERS
@@ -1418,11 +1782,11 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    // NOTE: No need to clear buffer before using, vsnprintf() always writes the '\0' terminator
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
-    memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
 
     va_list args;
     va_start(args, text);
@@ -1491,6 +1855,169 @@ float TextToFloat(const char *text)
     return value*sign;
 }
 
+// Init text builder over a caller-owned buffer
+TextBuilder TextBuilderInit(char *buffer, int capacity)
+{
+    TextBuilder builder = { 0 };
+
+    if ((buffer != NULL) && (capacity > 0))
+    {
+        builder.buffer = buffer;
+        builder.capacity = capacity;
+        builder.buffer[0] = '\0';
+    }
+
+    return builder;
+}
+
+// Clear text builder content (buffer is kept)
+void TextBuilderClear(TextBuilder *builder)
+{
+    builder->length = 0;
+    builder->truncated = false;
+    if (builder->capacity > 0) builder->buffer[0] = '\0';
+}
+
+// Append text to text builder
+// NOTE: If text does not fit, it is truncated to remaining capacity and false is returned
+bool TextBuilderAppend(TextBuilder *builder, const char *text)
+{
+    if (text == NULL) return true;
+
+    int textLength = TextLength(text);
+    int available = builder->capacity - builder->length - 1;
+
+    if (available < 0) available = 0;
+    if (textLength > available)
+    {
+        textLength = available;
+        builder->truncated = true;
+    }
+
+    if (textLength > 0)
+    {
+        memcpy(builder->buffer + builder->length, text, textLength);
+        builder->length += textLength;
+        builder->buffer[builder->length] = '\0';
+    }
+
+    return !builder->truncated;
+}
+
+// Append formatted text to text builder (sprintf() style)
+// NOTE: If text does not fit, it is truncated to remaining capacity and false is returned
+bool TextBuilderAppendFormat(TextBuilder *builder, const char *text, ...)
+{
+    int available = builder->capacity - builder->length;
+
+    if (available <= 0)
+    {
+        builder->truncated = true;
+        return false;
+    }
+
+    va_list args;
+    va_start(args, text);
+    int requiredByteCount = vsnprintf(builder->buffer + builder->length, available, text, args);
+    va_end(args);
+
+    if (requiredByteCount >= available)
+    {
+        builder->length = builder->capacity - 1;
+        builder->truncated = true;
+    }
+    else if (requiredByteCount > 0) builder->length += requiredByteCount;
+
+    return !builder->truncated;
+}
+
+// Append one codepoint to text builder, UTF-8 encoded
+// NOTE: Codepoint is not appended if all its bytes do not fit
+bool TextBuilderAppendCodepoint(TextBuilder *builder, int codepoint)
+{
+    char utf8[4] = { 0 };
+    int size = 0;
+
+    if (codepoint <= 0x7f) utf8[size++] = (char)codepoint;
+    else if (codepoint <= 0x7ff)
+    {
+        utf8[size++] = (char)(((codepoint >> 6) & 0x1f) | 0xc0);
+        utf8[size++] = (char)((codepoint & 0x3f) | 0x80);
+    }
+    else if (codepoint <= 0xffff)
+    {
+        utf8[size++] = (char)(((codepoint >> 12) & 0x0f) | 0xe0);
+        utf8[size++] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[size++] = (char)((codepoint & 0x3f) | 0x80);
+    }
+    else if (codepoint <= 0x10ffff)
+    {
+        utf8[size++] = (char)(((codepoint >> 18) & 0x07) | 0xf0);
+        utf8[size++] = (char)(((codepoint >> 12) & 0x3f) | 0x80);
+        utf8[size++] = (char)(((codepoint >>  6) & 0x3f) | 0x80);
+        utf8[size++] = (char)((codepoint & 0x3f) | 0x80);
+    }
+
+    if ((builder->length + size) > (builder->capacity - 1)) builder->truncated = true;
+    else if (size > 0)
+    {
+        memcpy(builder->buffer + builder->length, utf8, size);
+        builder->length += size;
+        builder->buffer[builder->length] = '\0';
+    }
+
+    return !builder->truncated;
+}
+
+// Append text with all occurrences of replace string replaced by another string
+// NOTE: Allocation-free alternative to TextReplace()
+bool TextBuilderAppendReplace(TextBuilder *builder, const char *text, const char *replace, const char *by)
+{
+    if ((text == NULL) || (replace == NULL) || (replace[0] == '\0')) return TextBuilderAppend(builder, text);
+
+    int replaceLen = TextLength(replace);
+    const char *insertPoint = NULL;
+
+    while ((insertPoint = strstr(text, replace)) != NULL)
+    {
+        int lastReplacePos = (int)(insertPoint - text);
+        int available = builder->capacity - builder->length - 1;
+
+        if (available < 0) available = 0;
+        if (lastReplacePos > available)
+        {
+            lastReplacePos = available;
+            builder->truncated = true;
+        }
+
+        // NOTE: Builder could have no buffer (zero capacity), nothing is written then
+        if (lastReplacePos > 0)
+        {
+            memcpy(builder->buffer + builder->length, text, lastReplacePos);
+            builder->length += lastReplacePos;
+            builder->buffer[builder->length] = '\0';
+        }
+
+        if (builder->truncated || !TextBuilderAppend(builder, by)) return false;
+
+        text = insertPoint + replaceLen;     // Move to next "end of replace"
+    }
+
+    return TextBuilderAppend(builder, text);
+}
+
+// Append text strings joined with delimiter to text builder
+bool TextBuilderAppendJoin(TextBuilder *builder, char **textList, int count, const char *delimiter)
+{
+    for (int i = 0; i < count; i++)
+    {
+        TextBuilderAppend(builder, textList[i]);
+        if (i < (count - 1)) TextBuilderAppend(builder, delimiter);
+    }
+
+    return !builder->truncated;
+}
+
 #if defined(SUPPORT_TEXT_MANIPULATION)
 // Copy one string to another, returns bytes copied
 int TextCopy(char *dst, const char *src)
@@ -1533,8 +2060,7 @@ bool TextIsEqual(const char *text1, const char *text2)
 // Get a piece of a text string
 const char *TextSubtext(const char *text, int position, int length)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
     int textLength = TextLength(text);
 
@@ -1545,6 +2071,7 @@ const char *TextSubtext(const char *text, int position, int length)
     }
 
     if (length >= textLength) length = textLength;
+    if (length >= MAX_TEXT_BUFFER_LENGTH) length = MAX_TEXT_BUFFER_LENGTH - 1;
 
     // NOTE: Alternative: memcpy(buffer, text + position, length)
 
@@ -1628,53 +2155,31 @@ char *TextInsert(const char *text, const char *insert, int position)
 }
 
 // Join text strings with delimiter
-// REQUIRES: memset(), memcpy()
+// NOTE: Joined text is truncated to MAX_TEXT_BUFFER_LENGTH, use TextBuilderAppendJoin() for longer text
 char *TextJoin(char **textList, int count, const char *delimiter)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
-    char *textPtr = buffer;
-
-    int totalLength = 0;
-    int delimiterLen = TextLength(delimiter);
-
-    for (int i = 0; i < count; i++)
-    {
-        int textLength = TextLength(textList[i]);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
-        // Make sure joined text could fit inside MAX_TEXT_BUFFER_LENGTH
-        if ((totalLength + textLength) < MAX_TEXT_BUFFER_LENGTH)
-        {
-            memcpy(textPtr, textList[i], textLength);
-            totalLength += textLength;
-            textPtr += textLength;
-
-            if ((delimiterLen > 0) && (i < (count - 1)))
-            {
-                memcpy(textPtr, delimiter, delimiterLen);
-                totalLength += delimiterLen;
-                textPtr += delimiterLen;
-            }
-        }
-    }
+    TextBuilder builder = TextBuilderInit(buffer, MAX_TEXT_BUFFER_LENGTH);
+    TextBuilderAppendJoin(&builder, textList, count, delimiter);
 
     return buffer;
 }
 
 // Split string into multiple strings
-// REQUIRES: memset()
 char **TextSplit(const char *text, char delimiter, int *count)
 {
     // NOTE: Current implementation returns a copy of the provided string with '\0' (string end delimiter)
     // inserted between strings defined by "delimiter" parameter. No memory is dynamically allocated,
-    // all used memory is static... it has some limitations:
+    // all used memory is static (per-thread)... it has some limitations:
     //      1. Maximum number of possible split strings is set by MAX_TEXTSPLIT_COUNT
     //      2. Maximum size of text to split is MAX_TEXT_BUFFER_LENGTH
 
-    static char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char *result[MAX_TEXTSPLIT_COUNT] = { NULL };
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
 
+    buffer[0] = '\0';
+    buffer[MAX_TEXT_BUFFER_LENGTH - 1] = '\0';
     result[0] = buffer;
     int counter = 0;
 
@@ -1683,7 +2188,7 @@ char **TextSplit(const char *text, char delimiter, int *count)
         counter = 1;
 
         // Count how many substrings we have on text and point to every one
-        for (int i = 0; i < MAX_TEXT_BUFFER_LENGTH; i++)
+        for (int i = 0; i < (MAX_TEXT_BUFFER_LENGTH - 1); i++)
         {
             buffer[i] = text[i];
             if (buffer[i] == '\0') break;
@@ -1693,7 +2198,12 @@ char **TextSplit(const char *text, char delimiter, int *count)
                 result[counter] = buffer + i + 1;
                 counter++;
 
-                if (counter == MAX_TEXTSPLIT_COUNT) break;
+                if (counter == MAX_TEXTSPLIT_COUNT)
+                {
+                    // Last substring is left empty, remaining text is not copied
+                    buffer[i + 1] = '\0';
+                    break;
+                }
             }
         }
     }
@@ -1729,18 +2239,20 @@ int TextFindIndex(const char *text, const char *find)
 // TODO: Support UTF-8 diacritics to upper-case, check codepoints
 char *TextToUpper(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    int i = 0;
 
     if (text != NULL)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        for (; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
         {
             if ((text[i] >= 'a') && (text[i] <= 'z')) buffer[i] = text[i] - 32;
             else buffer[i] = text[i];
         }
     }
 
+    buffer[i] = '\0';
+
     return buffer;
 }
 
@@ -1748,18 +2260,20 @@ char *TextToUpper(const char *text)
 // WARNING: Limited functionality, only basic characters set
 char *TextToLower(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    int i = 0;
 
     if (text != NULL)
     {
-        for (int i = 0; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
+        for (; (i < MAX_TEXT_BUFFER_LENGTH - 1) && (text[i] != '\0'); i++)
         {
             if ((text[i] >= 'A') && (text[i] <= 'Z')) buffer[i] = text[i] + 32;
             else buffer[i] = text[i];
         }
     }
 
+    buffer[i] = '\0';
+
     return buffer;
 }
 
@@ -1767,7 +2281,7 @@ char *TextToLower(const char *text)
 // WARNING: Limited functionality, only basic characters set
 char *TextToPascal(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
     if (text != NULL)
@@ -1795,7 +2309,7 @@ char *TextToPascal(const char *text)
 // WARNING: Limited functionality, only basic characters set
 char *TextToSnake(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
     if (text != NULL)
@@ -1823,7 +2337,7 @@ char *TextToSnake(const char *text)
 // WARNING: Limited functionality, only basic characters set
 char *TextToCamel(const char *text)
 {
-    static char buffer[MAX_TEXT_BUFFER_LENGTH] = {0};
+    static RL_THREAD_LOCAL char buffer[MAX_TEXT_BUFFER_LENGTH] = { 0 };
     memset(buffer, 0, MAX_TEXT_BUFFER_LENGTH);
 
     if (text != NULL)
@@ -1884,17 +2398,10 @@ int *LoadCodepoints(const char *text, int *count)
 {
     int textLength = TextLength(text);
 
-    int codepointSize = 0;
-    int codepointCount = 0;
-
     // Allocate a big enough buffer to store as many codepoints as text bytes
     int *codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
 
-    for (int i = 0; i < textLength; codepointCount++)
-    {
-        codepoints[codepointCount] = GetCodepointNext(text + i, &codepointSize);
-        i += codepointSize;
-    }
+    int codepointCount = DecodeTextCodepoints(text, textLength, codepoints);
 
     // Re-allocate buffer to the actual number of codepoints loaded
     codepoints = (int *)RL_REALLOC(codepoints, codepointCount*sizeof(int));
@@ -1914,27 +2421,14 @@ void UnloadCodepoints(int *codepoints)
 // NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
 int GetCodepointCount(const char *text)
 {
-    unsigned int length = 0;
-    char *ptr = (char *)&text[0];
-
-    while (*ptr != '\0')
-    {
-        int next = 0;
-        GetCodepointNext(ptr, &next);
-
-        ptr += next;
-
-        length++;
-    }
-
-    return length;
+    return CountTextCodepoints(text, TextLength(text));
 }
 
 // Encode codepoint into utf8 text (char array length returned as parameter)
 // NOTE: It uses a static array to store UTF-8 bytes
 const char *CodepointToUTF8(int codepoint, int *utf8Size)
 {
-    static char utf8[6] = { 0 };
+    static RL_THREAD_LOCAL char utf8[6] = { 0 };
     memset(utf8, 0, 6); // Clear static array
     int size = 0;       // Byte size of codepoint
 
@@ -2140,6 +2634,125 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_TEXT_MANIPULATION)
+// Get number of consecutive ASCII bytes (0x00..0x7f) at text start, checking up to length bytes
+// NOTE: When available, SIMD instructions are used to check 32 bytes per iteration
+static int GetTextAsciiLength(const unsigned char *text, int length)
+{
+    int count = 0;
+
+#if defined(RL_SIMD_SSE2)
+    for (; (count + 32) <= length; count += 32)
+    {
+        __m128i chunk = _mm_or_si128(_mm_loadu_si128((const __m128i *)(text + count)), _mm_loadu_si128((const __m128i *)(text + count + 16)));
+        if (_mm_movemask_epi8(chunk) != 0) break;   // Some byte has the high bit set
+    }
+    for (; (count + 16) <= length; count += 16)
+    {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(text + count))) != 0) break;
+    }
+#elif defined(RL_SIMD_NEON)
+    for (; (count + 32) <= length; count += 32)
+    {
+        uint8x16_t chunk = vorrq_u8(vld1q_u8(text + count), vld1q_u8(text + count + 16));
+        if (vmaxvq_u8(chunk) >= 0x80) break;        // Some byte has the high bit set
+    }
+    for (; (count + 16) <= length; count += 16)
+    {
+        if (vmaxvq_u8(vld1q_u8(text + count)) >= 0x80) break;
+    }
+#endif
+
+    // Check remaining bytes (or the block containing the first non-ASCII byte)
+    while ((count < length) && (text[count] < 0x80)) count++;
+
+    return count;
+}
+
+// Decode UTF-8 text into codepoints, processing up to length bytes, returns number of codepoints decoded
+// NOTE: Provided codepoints array must fit length elements, invalid sequences are decoded as '?'(0x3f)
+// like GetCodepointNext(), ASCII runs are copied in bulk without per-byte decoding
+static int DecodeTextCodepoints(const char *text, int length, int *codepoints)
+{
+    const unsigned char *bytes = (const unsigned char *)text;
+    int count = 0;
+
+    for (int i = 0; i < length;)
+    {
+        int asciiLength = GetTextAsciiLength(bytes + i, length - i);
+        int k = 0;
+
+#if defined(RL_SIMD_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        for (; (k + 16) <= asciiLength; k += 16)
+        {
+            __m128i chunk = _mm_loadu_si128((const __m128i *)(bytes + i + k));
+            __m128i lo = _mm_unpacklo_epi8(chunk, zero);
+            __m128i hi = _mm_unpackhi_epi8(chunk, zero);
+
+            _mm_storeu_si128((__m128i *)(codepoints + count + k), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(codepoints + count + k + 4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(codepoints + count + k + 8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i *)(codepoints + count + k + 12), _mm_unpackhi_epi16(hi, zero));
+        }
+#elif defined(RL_SIMD_NEON)
+        for (; (k + 16) <= asciiLength; k += 16)
+        {
+            uint8x16_t chunk = vld1q_u8(bytes + i + k);
+            uint16x8_t lo = vmovl_u8(vget_low_u8(chunk));
+            uint16x8_t hi = vmovl_u8(vget_high_u8(chunk));
+
+            vst1q_s32(codepoints + count + k, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(lo))));
+            vst1q_s32(codepoints + count + k + 4, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(lo))));
+            vst1q_s32(codepoints + count + k + 8, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(hi))));
+            vst1q_s32(codepoints + count + k + 12, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(hi))));
+        }
+#endif
+        for (; k < asciiLength; k++) codepoints[count + k] = bytes[i + k];
+
+        count += asciiLength;
+        i += asciiLength;
+
+        // Decode multi-byte sequence (validated by GetCodepointNext())
+        if (i < length)
+        {
+            int codepointSize = 0;
+            codepoints[count] = GetCodepointNext(text + i, &codepointSize);
+            count++;
+            i += codepointSize;
+        }
+    }
+
+    return count;
+}
+
+// Count codepoints in UTF-8 text, processing up to length bytes
+// NOTE: Invalid sequences are counted as one '?'(0x3f) codepoint, like GetCodepointNext()
+static int CountTextCodepoints(const char *text, int length)
+{
+    const unsigned char *bytes = (const unsigned char *)text;
+    int count = 0;
+
+    for (int i = 0; i < length;)
+    {
+        int asciiLength = GetTextAsciiLength(bytes + i, length - i);
+
+        count += asciiLength;
+        i += asciiLength;
+
+        if (i < length)
+        {
+            int codepointSize = 0;
+            GetCodepointNext(text + i, &codepointSize);
+            count++;
+            i += codepointSize;
+        }
+    }
+
+    return count;
+}
+#endif      // SUPPORT_TEXT_MANIPULATION
+
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -2324,6 +2937,107 @@ static Font LoadBMFont(const char *fileName)
 
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// Load font from RFNT file data (raylib binary font)
+// NOTE: Uncompressed atlas pixel data is uploaded to GPU directly from file data, no copy required
+static Font LoadFontRFNT(const unsigned char *fileData, int dataSize)
+{
+    Font font = { 0 };
+    RfntHeader header = { 0 };
+
+    if ((fileData == NULL) || (dataSize < (int)sizeof(RfntHeader)))
+    {
+        TRACELOG(LOG_WARNING, "FONT: RFNT file data not valid");
+        return font;
+    }
+
+    memcpy(&header, fileData, sizeof(RfntHeader));
+
+    // NOTE: Header fields are not trusted, sizes are validated with 64-bit math to avoid overflows
+    if ((memcmp(header.id, "rFNT", 4) != 0) || (header.version != 100) || (header.glyphCount <= 0) ||
+        (header.atlasWidth <= 0) || (header.atlasHeight <= 0) || (header.atlasDataSize <= 0) ||
+        (header.atlasFormat < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (header.atlasFormat > PIXELFORMAT_UNCOMPRESSED_R16G16B16A16) ||
+        (((long long)header.atlasWidth*header.atlasHeight*GetPixelDataSize(1, 1, header.atlasFormat)) > INT_MAX) ||
+        (((long long)sizeof(RfntHeader) + (long long)header.glyphCount*(long long)sizeof(RfntGlyph) + header.atlasDataSize) > dataSize))
+    {
+        TRACELOG(LOG_WARNING, "FONT: RFNT file header not valid or file data size not enough");
+        return font;
+    }
+
+    const unsigned char *glyphData = fileData + sizeof(RfntHeader);
+    const unsigned char *atlasData = glyphData + header.glyphCount*sizeof(RfntGlyph);
+
+    // Get atlas image, pointing to file data when not compressed
+    Image atlas = { 0 };
+    atlas.width = header.atlasWidth;
+    atlas.height = header.atlasHeight;
+    atlas.mipmaps = 1;
+    atlas.format = header.atlasFormat;
+
+    int atlasDataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+
+    if (header.atlasCompressed)
+    {
+    #if defined(SUPPORT_COMPRESSION_API)
+        int decompDataSize = 0;
+        atlas.data = DecompressData(atlasData, header.atlasDataSize, &decompDataSize);
+
+        if (decompDataSize != atlasDataSize)
+        {
+            RL_FREE(atlas.data);
+            atlas.data = NULL;
+        }
+    #else
+        TRACELOG(LOG_WARNING, "FONT: RFNT compressed atlas requires SUPPORT_COMPRESSION_API");
+    #endif
+    }
+    else if (header.atlasDataSize == atlasDataSize) atlas.data = (void *)atlasData;
+
+    if (atlas.data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FONT: RFNT atlas pixel data not valid");
+        return font;
+    }
+
+    font.baseSize = header.baseSize;
+    font.glyphCount = header.glyphCount;
+    font.glyphPadding = header.glyphPadding;
+    font.recs = (Rectangle *)RL_MALLOC(font.glyphCount*sizeof(Rectangle));
+    font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        RfntGlyph glyph = { 0 };
+        memcpy(&glyph, glyphData + i*sizeof(RfntGlyph), sizeof(RfntGlyph));
+
+        // Glyph rectangle must be inside atlas, invalid rectangles are discarded
+        if (!(glyph.rec.x >= 0) || !(glyph.rec.y >= 0) || !(glyph.rec.width >= 0) || !(glyph.rec.height >= 0) ||
+            !((glyph.rec.x + glyph.rec.width) <= atlas.width) || !((glyph.rec.y + glyph.rec.height) <= atlas.height))
+        {
+            TRACELOG(LOG_WARNING, "FONT: RFNT glyph [%i] rectangle out of atlas bounds", i);
+            glyph.rec = (Rectangle){ 0 };
+        }
+
+        font.glyphs[i].value = glyph.value;
+        font.glyphs[i].offsetX = glyph.offsetX;
+        font.glyphs[i].offsetY = glyph.offsetY;
+        font.glyphs[i].advanceX = glyph.advanceX;
+        font.recs[i] = glyph.rec;
+
+        // Glyph image is required by ImageDrawText()
+        font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
+    }
+
+    if (isGpuReady) font.texture = LoadTextureFromImage(atlas);
+
+    if (atlas.data != (void *)atlasData) UnloadImage(atlas);
+
+    TRACELOG(LOG_INFO, "FONT: RFNT data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
+
+    return font;
+}
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_BDF)
 
 // Convert hexadecimal to decimal (single digit)
@@ -70,13 +70,20 @@
 
 #if defined(SUPPORT_MODULE_RTEXTURES)
 
-#include "utils.h"              // Required for: TRACELOG()
+#include "utils.h"              // Required for: TRACELOG(), ParallelFor()
 #include "rlgl.h"               // OpenGL abstraction layer to multiple versions
 
 #include <stdlib.h>             // Required for: malloc(), calloc(), free()
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()/LoadImageAnimFromMemory()/ExportImageToMemory()]
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <limits.h>             // Required for: INT_MAX, UINT_MAX [Used in LoadImageRaw(), LoadImageRawMapped(), LoadImageCacheFile(), AddAsyncLoadRequest()]
+
+#if defined(RL_SIMD_SSE2)
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in BlendColorSpan(), BlendPixelsSpan(), ConvertPixels(), BoxBlurSpan(), ReduceMipmapSpan(), PerlinNoiseSpan(), UnfilterScanlinePNG()]
+#elif defined(RL_SIMD_NEON)
+    #include <arm_neon.h>       // Required for: NEON intrinsics [Used in BlendColorSpan(), BlendPixelsSpan(), ConvertPixels(), BoxBlurSpan(), ReduceMipmapSpan(), PerlinNoiseSpan(), UnfilterScanlinePNG()]
+#endif
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -158,6 +165,16 @@
     #endif
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+    // NOTE: Library implementation compiled in module [rcore], required by DecompressData()
+    #include "external/sinfl.h"             // Required for: sinflate() [Used in LoadImagePNG()]
+    #define PNG_DECODER_AVAILABLE
+#endif
+
+#if defined(PNG_DECODER_AVAILABLE) || defined(SUPPORT_IMAGE_STREAMING)
+    #define PNG_SCANLINES_REQUIRED          // PNG headers parsing, scanlines unfiltering and conversion
+#endif
+
 #if (defined(SUPPORT_FILEFORMAT_DDS) || \
      defined(SUPPORT_FILEFORMAT_PKM) || \
      defined(SUPPORT_FILEFORMAT_KTX) || \
@@ -203,11 +220,17 @@
 
     #define STB_IMAGE_WRITE_IMPLEMENTATION
     #include "external/stb_image_write.h"   // Required for: stbi_write_*()
+
+    #if defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+        // NOTE: Library implementation compiled in module [rcore], required by CompressData()
+        #include "external/sdefl.h"         // Required for: sdeflate(), sdeflate_sync() [Used in ExportImagePNG()]
+        #define PNG_ENCODER_AVAILABLE
+    #endif
 #endif
 
 #if defined(SUPPORT_IMAGE_GENERATION)
     #define STB_PERLIN_IMPLEMENTATION
-    #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3
+    #include "external/stb_perlin.h"        // Required for: stb_perlin_noise3_internal(), stb__perlin_randtab[] [Used in PerlinNoiseSpan()]
 #endif
 
 #define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
@@ -219,7 +242,7 @@
 #endif
 
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
-#include "external/stb_image_resize2.h"     // Required for: stbir_resize_uint8_linear() [ImageResize()]
+#include "external/stb_image_resize2.h"     // Required for: stbir_resize_extended(), stbir_resize_extended_split() [ImageResize()]
 
 #if defined(__GNUC__) // GCC and Clang
     #pragma GCC diagnostic pop
@@ -235,16 +258,500 @@
 #ifndef GAUSSIAN_BLUR_ITERATIONS
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
+#ifndef GAUSSIAN_BLUR_TILE
+    #define GAUSSIAN_BLUR_TILE       16    // Number of columns blurred together on vertical passes
+#endif
+
+#ifndef IMAGE_PARALLEL_MIN_PIXELS
+    #define IMAGE_PARALLEL_MIN_PIXELS  16384   // Minimum pixels processed per worker thread [Used in ParallelFor() image jobs]
+#endif
+
+// Minimum image rows processed per worker thread
+#define IMAGE_PARALLEL_MIN_ROWS(width) (((width) > 0)? (IMAGE_PARALLEL_MIN_PIXELS/(width) + 1) : 1)
+
+#ifndef PIXELS_CONVERT_CHUNK
+    #define PIXELS_CONVERT_CHUNK    256    // Pixels converted per chunk between formats [Used in ConvertPixels()]
+#endif
+
+#ifndef IMAGE_DRAW_SPAN
+    #define IMAGE_DRAW_SPAN         256    // Pixels converted and blended per span [Used in ImageDraw()]
+#endif
+#ifndef NOISE_SPAN_SIZE
+    #define NOISE_SPAN_SIZE         256    // Noise samples evaluated per span [Used in GenImagePerlinNoise(), GenImageNoise()]
+#endif
+#ifndef NOISE_MAX_OCTAVES
+    #define NOISE_MAX_OCTAVES        16    // Max number of noise octaves summed [Used in GenImageNoise()]
+#endif
+#ifndef NOISE_MAX_COORDINATE
+    #define NOISE_MAX_COORDINATE  16777216.0f  // Max noise coordinate (float integer precision), octaves frequency limited [Used in GenImageNoise()]
+#endif
+#ifndef PALETTE_LOOKUP_CACHE_BITS
+    #define PALETTE_LOOKUP_CACHE_BITS    14    // Nearest palette colors cache size (bits) [Used in ImageQuantize(), LoadImagePaletteIndices()]
+#endif
+#define PALETTE_LOOKUP_CACHE_SIZE   (1 << PALETTE_LOOKUP_CACHE_BITS)
+#ifndef IMAGE_RASTER_BAND
+    #define IMAGE_RASTER_BAND        32    // Scanlines accumulated per band for anti-aliased shapes [Used in ImageDrawLineAA(), ImageDrawCircleAA(), ImageDrawTriangleAA()]
+#endif
+
+#ifndef PNG_COMPRESSION_LEVEL
+    #define PNG_COMPRESSION_LEVEL     6    // Default PNG compression level [Used in ExportImage(), ExportImageToMemory()]
+#endif
+#ifndef PNG_COMPRESS_CHUNK_SIZE
+    #define PNG_COMPRESS_CHUNK_SIZE  1048576   // PNG filtered data compressed per independent deflate chunk (parallel) [Used in ExportImagePNG()]
+#endif
+
+#ifndef MAX_ASYNC_LOAD_REQUESTS
+    #define MAX_ASYNC_LOAD_REQUESTS  512   // Max number of simultaneous async loading requests [Used in LoadImageAsync(), LoadTextureAsync()]
+#endif
+#ifndef MAX_ASYNC_LOAD_TASKS
+    #define MAX_ASYNC_LOAD_TASKS       8   // Max number of async tasks loading requests, other requests wait to be loaded (must fit async tasks queue)
+#endif
+#ifndef MAX_ASYNC_UPLOAD_BYTES
+    #define MAX_ASYNC_UPLOAD_BYTES   16777216   // Max texture data uploaded to GPU per frame by async loading, at least one texture is uploaded
+#endif
+
+#ifndef MAX_FILEPATH_LENGTH
+    #define MAX_FILEPATH_LENGTH     4096   // Maximum length for filepaths [Used in SetImageCacheDirectory()]
+#endif
+#define IMAGE_CACHE_VERSION            1   // Image cache file version, part of cache key (entries of other versions are not loaded, left orphaned in cache directory)
+#ifndef MAX_MAPPED_IMAGES
+    #define MAX_MAPPED_IMAGES         64   // Max number of simultaneous memory mapped images [Used in LoadImageMapped(), LoadImageRawMapped()]
+#endif
+
+#ifndef IMAGE_STREAM_TILE_SIZE
+    #define IMAGE_STREAM_TILE_SIZE   256   // Image stream cached tiles size in pixels [Used in LoadImageStreamRec()]
+#endif
+#ifndef IMAGE_STREAM_CACHE_TILES
+    #define IMAGE_STREAM_CACHE_TILES  64   // Max number of cached tiles per image stream [Used in LoadImageStreamRec()]
+#endif
+#ifndef IMAGE_STREAM_INPUT_SIZE
+    #define IMAGE_STREAM_INPUT_SIZE 65536  // Image stream file data read per chunk [Used in LoadImageStream()]
+#endif
+#define INFLATE_FAST_BITS              9   // Huffman codes bits decoded with a single table lookup [Used in LoadImageStream()]
+
+#ifndef MAX_TEXTURE_READBACKS
+    #define MAX_TEXTURE_READBACKS     16   // Max number of simultaneous render texture readback requests [Used in RequestTextureReadback()]
+#endif
+#ifndef TEXTURE_READBACK_LATENCY
+    #define TEXTURE_READBACK_LATENCY   2   // Default frames a readback can be in flight before waiting for it [Used in SetTextureReadbackLatency()]
+#endif
+
+#ifndef GLYPH_COVERAGE_SPAN
+    #define GLYPH_COVERAGE_SPAN     256    // Glyph pixels sampled per blending span [Used in ImageDrawTextGlyphs()]
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Color adjustment operations [Used in AdjustColorsBatch()]
+typedef enum {
+    COLOR_ADJUST_TINT = 0,
+    COLOR_ADJUST_INVERT,
+    COLOR_ADJUST_CONTRAST,
+    COLOR_ADJUST_BRIGHTNESS,
+    COLOR_ADJUST_REPLACE,
+    COLOR_ADJUST_PREMULTIPLY
+} ColorAdjustMode;
+
+// Color adjustment job data [Used in ImageColor*(), ImageAlphaPremultiply()]
+typedef struct ColorAdjustJob {
+    Color *pixels;              // Pixels to adjust
+    unsigned char *data;        // Float or half-float pixel data to adjust [Used in AdjustColorsFloatBatch()]
+    int format;                 // Float or half-float pixel data format
+    int mode;                   // Adjustment operation (ColorAdjustMode)
+    Color color;                // Tint color or color to replace
+    Color replace;              // Replacement color
+    float contrast;             // Contrast factor
+    int brightness;             // Brightness offset
+} ColorAdjustJob;
+
+// Image pipeline operation types [Used in ImagePipeline*()]
+typedef enum {
+    IMAGE_OPERATION_CROP = 0,
+    IMAGE_OPERATION_RESIZE,
+    IMAGE_OPERATION_FORMAT,
+    IMAGE_OPERATION_COLOR
+} ImageOperationType;
+
+// Image pipeline recorded operation
+struct rImageOperation {
+    int type;                   // Operation type (ImageOperationType)
+    int x;                      // Crop rectangle x (clamped to image)
+    int y;                      // Crop rectangle y (clamped to image)
+    int width;                  // Crop or resize width
+    int height;                 // Crop or resize height
+    int format;                 // Pixel format to convert to
+    ColorAdjustJob color;       // Color adjustment
+};
+
+// Image pipeline evaluation job data [Used in LoadImageFromPipeline()]
+// NOTE: Color operations recorded before first resize are applied on source pixels (pre stage),
+// operations after first resize are applied on resized pixels (post stage)
+typedef struct ImagePipelineJob {
+    const unsigned char *source; // Source pixel data
+    int sourceWidth;            // Source image width
+    int sourceFormat;           // Source pixel format
+    int offsetX;                // Source region offset x
+    int offsetY;                // Source region offset y
+    const rImageOperation *operations; // Recorded operations
+    int preCount;               // Pre stage operations count (operations [0, preCount))
+    int postStart;              // Post stage first operation
+    int postEnd;                // Post stage operations end
+    int resizeFormat;           // Pixel format at first resize
+    int resizeLayout;           // Pixel format resampled (resize format, R8G8B8A8 if not 8 bit per channel)
+    bool preColors;             // Color or format operations on pre stage
+    bool postColors;            // Color or format operations on post stage
+    unsigned char *output;      // Output pixel data
+    int outputWidth;            // Output image width
+    int outputHeight;           // Output image height
+    int outputOffsetX;          // Output first column in resampled rows
+    int outputOffsetY;          // Output first row in resampled rows
+    int outputFormat;           // Output pixel format (uncompressed)
+} ImagePipelineJob;
+
+// Gradient generation job data [Used in GenImageGradient*(), GenImageChecked()]
+typedef struct GradientJob {
+    Color *pixels;              // Output pixels
+    int width;                  // Image width
+    int height;                 // Image height
+    Color start;                // Start color (inner color for radial and square gradients)
+    Color end;                  // End color (outer color for radial and square gradients)
+    float density;              // Radial and square gradients density
+    float cosDir;               // Linear gradient direction cosine
+    float sinDir;               // Linear gradient direction sine
+    float startingPos;          // Linear gradient top-left pixel position along direction
+    float maxPosValue;          // Linear gradient farthest position along direction
+    int checksX;                // Checked pattern checks width
+    int checksY;                // Checked pattern checks height
+} GradientJob;
+
+// Noise generation job data [Used in GenImagePerlinNoise(), GenImageCellular(), GenImageNoise()]
+typedef struct NoiseJob {
+    Color *pixels;              // Output pixels
+    float *values;              // Output values (fractal noise)
+    int width;                  // Image width
+    int height;                 // Image height
+    int offsetX;                // Perlin noise offset X
+    int offsetY;                // Perlin noise offset Y
+    float scale;                // Perlin noise scale
+    NoiseParams params;         // Fractal noise parameters
+    const Vector2 *seeds;       // Cellular seeds, one per tile
+    int seedsPerRow;            // Cellular seeds per row
+    int seedsPerCol;            // Cellular seeds per column
+    int tileSize;               // Cellular tile size
+} NoiseJob;
+
+// Box blur job data [Used in ImageBlurGaussian()]
+typedef struct BlurJob {
+    Color *pixels;              // Pixels to blur
+    int width;                  // Image width
+    int height;                 // Image height
+    int blurSize;               // Blur window radius
+    float *values;              // Float RGBA pixels to blur [Used in BlurRowsFloatBatch(), BlurColumnsFloatBatch()]
+    unsigned short *channels;   // Premultiplied 16 bit RGBA pixels being blurred [Used in BlurRowsBatch(), BlurColumnsBatch()]
+} BlurJob;
+
+// Kernel convolution job data [Used in ImageKernelConvolution()]
+typedef struct ConvolutionJob {
+    const Vector4 *pixels;      // Source pixels (normalized)
+    Vector4 *output;            // Convolution output (normalized)
+    int width;                  // Image width
+    int height;                 // Image height
+    const float *kernel;        // Convolution kernel
+    int kernelWidth;            // Convolution kernel width
+    int startRange;             // Kernel start offset
+    int endRange;               // Kernel end offset (not included)
+    bool hdr;                   // Keep color values over 1.0f (float and half-float formats)
+} ConvolutionJob;
+
+// Rotation job data [Used in ImageRotate()]
+typedef struct RotateJob {
+    const unsigned char *src;   // Source pixels
+    unsigned char *dst;         // Rotated pixels
+    int srcWidth;               // Source image width
+    int srcHeight;              // Source image height
+    int width;                  // Rotated image width
+    int height;                 // Rotated image height
+    int bytesPerPixel;          // Bytes per pixel
+    float sinRadius;            // Rotation sine
+    float cosRadius;            // Rotation cosine
+} RotateJob;
+
+// Compression job data [Used in ImageCompress()]
+typedef struct CompressJob {
+    const Color *pixels;        // Source pixels
+    unsigned char *output;      // Compressed blocks
+    int width;                  // Image width
+    int height;                 // Image height
+    int format;                 // Compressed format
+    int quality;                // Compression quality: 0 (fast), 1 (normal), 2 (best)
+} CompressJob;
+
+// Mipmap level reduction job data [Used in ImageMipmapsEx()]
+typedef struct MipmapJob {
+    const unsigned char *src;   // Source level pixels
+    unsigned char *dst;         // Reduced level pixels
+    int srcWidth;               // Source level width
+    int srcHeight;              // Source level height
+    int width;                  // Reduced level width
+    int height;                 // Reduced level height
+    int channels;               // Channels per pixel
+    int channelSize;            // Bytes per channel (1: 8 bit, 2: half-float, 4: float)
+    const unsigned short *toLinear;     // sRGB to linear (16 bit) table, NULL for gamma space filtering
+    const unsigned short *toSrgb;       // Linear (12 bit) to sRGB table
+} MipmapJob;
+
+// PNG encoding job data, rows chunks filtered and compressed independently [Used in ExportImagePNG()]
+typedef struct PNGEncodeJob {
+    const unsigned char *pixels;    // Image pixels (8 bit per channel)
+    int width;                      // Image width
+    int height;                     // Image height
+    int channels;                   // Channels per pixel
+    int level;                      // Compression level: 0 (fastest) to 9 (smallest)
+    int chunkRows;                  // Rows per chunk
+    int chunkCount;                 // Number of chunks
+    unsigned char **chunks;         // Compressed chunks data
+    int *chunkSizes;                // Compressed chunks sizes
+    unsigned int *chunkAdlers;      // Filtered chunks Adler-32 checksums
+} PNGEncodeJob;
+
+// Async loading request state
+typedef enum {
+    ASYNC_LOAD_FREE = 0,        // Request slot available
+    ASYNC_LOAD_QUEUED,          // Waiting for a loading task to be available
+    ASYNC_LOAD_DECODING,        // Image being loaded and decoded on background thread
+    ASYNC_LOAD_UPLOADING,       // Image decoded, waiting to be uploaded to GPU as texture (main thread)
+    ASYNC_LOAD_READY            // Request completed (image or texture available)
+} AsyncLoadState;
+
+// Async loading request [Used in LoadImageAsync(), LoadTextureAsync()]
+// NOTE: State is written by background thread while decoding, it must be accessed with LockAsyncTasks()
+typedef struct AsyncLoadRequest {
+    char *fileName;             // File name to load (copy)
+    bool toTexture;             // Upload image to GPU as texture once decoded
+    int state;                  // Request state (AsyncLoadState)
+    unsigned int order;         // Request order, queued requests are loaded first in first out
+    unsigned int generation;    // Request slot generation, encoded in request id (stale ids not valid)
+    Image image;                // Loaded image
+    Texture2D texture;          // Loaded texture
+} AsyncLoadRequest;
+
+// Texture readback request state
+typedef enum {
+    TEXTURE_READBACK_FREE = 0,  // Request slot available
+    TEXTURE_READBACK_PENDING,   // Pixel data being copied into pixel buffer by GPU
+    TEXTURE_READBACK_READY      // Request completed (image available)
+} TextureReadbackState;
+
+// Texture readback request [Used in RequestTextureReadback()]
+// NOTE: Pixel buffer is kept by the request slot and reused by following requests
+typedef struct TextureReadback {
+    int state;                  // Request state (TextureReadbackState)
+    unsigned int pboId;         // Pixel buffer id (0: not available, synchronous read)
+    int pboSize;                // Pixel buffer size in bytes
+    void *fence;                // Fence sync signaled once pixel data is copied into pixel buffer
+    int frames;                 // Frames elapsed since request
+    Image image;                // Read back image (R8G8B8A8)
+} TextureReadback;
+
+// Rectangles packing free area, integer coordinates [Used in PackRecsMaxRects()]
+typedef struct PackFreeRec {
+    int x;
+    int y;
+    int width;
+    int height;
+} PackFreeRec;
+
+// Rectangles packing sort entry [Used in PackRecsMaxRects()]
+typedef struct PackSortEntry {
+    int longSide;               // Rectangle longer side (first sorting key)
+    int shortSide;              // Rectangle shorter side (second sorting key)
+    int index;                  // Rectangle index
+} PackSortEntry;
+
+// Rectangles packing bin free areas [Used in PackRecsMaxRects(), ImageAtlasAdd()]
+typedef struct PackBin {
+    PackFreeRec *freeRecs;      // Free rectangles (maximal, overlapping)
+    PackFreeRec *splitRecs;     // Free rectangles split buffer
+    int freeCount;              // Free rectangles count
+    int freeCapacity;           // Free rectangles buffers capacity
+} PackBin;
+
+// Color quantization histogram bin, RGBA 5 bit per channel cell or exact color [Used in GenPaletteMedianCut()]
+typedef struct QuantizeBin {
+    unsigned int key;           // Bin key (RGBA 8 bit per channel, cells keep 5 bit per channel)
+    unsigned int count;         // Bin pixels count
+    unsigned int sortValue;     // Bin sorting value (box split channel)
+    unsigned long long sum[4];  // Bin pixels RGBA sums
+} QuantizeBin;
+
+// Color quantization box, histogram bins range [Used in GenPaletteMedianCut()]
+typedef struct QuantizeBox {
+    int start;                  // Box first bin index
+    int count;                  // Box bins count
+    unsigned long long pixels;  // Box pixels count
+    int channel;                // Box channel with widest range
+    int range;                  // Box channel range (8 bit)
+} QuantizeBox;
+
+// Palette nearest color lookup, candidate colors per RGB 5 bit, alpha 3 bit cell [Used in MapPaletteIndices()]
+// NOTE: Cell candidates are the palette colors that can be the nearest for any color in the cell, computed on first use,
+// recently found colors are cached (direct mapped by color hash)
+typedef struct PaletteLookup {
+    const Color *palette;       // Palette colors
+    int paletteSize;            // Palette colors count
+    unsigned int *cacheColors;  // Cached colors (packed)
+    short *cacheIndices;        // Cached colors palette index (-1: empty)
+    int *cellStart;             // Cells candidates start in candidates list (-1: not computed)
+    unsigned short *candidates; // Cells candidates list: candidates count followed by palette indices (sorted by distance to cell)
+    int *candidateDistances;    // Cells candidates min distance to cell
+    int candidateCount;         // Candidates list size
+    int candidateCapacity;      // Candidates list capacity
+} PaletteLookup;
+
+#if defined(PNG_SCANLINES_REQUIRED)
+// PNG image header and color chunks data
+typedef struct PNGInfo {
+    int width;                  // Image width
+    int height;                 // Image height
+    int format;                 // Decoded pixel format (same as stb_image)
+    int bitDepth;               // Bits per sample
+    int colorType;              // Color type
+    int samples;                // Samples per pixel
+    int pitch;                  // Scanline bytes (filter type byte not included)
+    int filterSize;             // Filter bytes per pixel
+    bool interlaced;            // Adam7 interlaced image
+    unsigned char palette[256*4];   // Palette (RGBA)
+    bool transparency;          // Transparency chunk available (adds alpha channel)
+    unsigned short transparentColor[3];     // Transparent color (gray and RGB images)
+} PNGInfo;
+#endif
+
+#if defined(SUPPORT_IMAGE_STREAMING)
+// Image stream decoding types
+typedef enum {
+    IMAGE_STREAM_FULL = 0,      // Image fully loaded on stream loading, regions copied
+    IMAGE_STREAM_PNG            // PNG image scanlines decoded on request
+} ImageStreamType;
+
+// Inflate huffman decoding table (canonical codes)
+typedef struct InflateHuffman {
+    unsigned short fast[1 << INFLATE_FAST_BITS];   // Short codes lookup: (code length << 9) | symbol, 0: longer code
+    unsigned short firstCode[16];   // First code by code length
+    unsigned short firstSymbol[16]; // First sorted symbol by code length
+    int maxCode[17];                // Codes limit by code length (preshifted to 16 bits)
+    unsigned char sizes[288];       // Sorted symbols code length
+    unsigned short symbols[288];    // Sorted symbols
+} InflateHuffman;
+
+// Inflate decoding state, deflate data decoded on request [Used in image streams]
+typedef struct InflateStream {
+    unsigned int bits;          // Bit buffer (LSB first)
+    int bitCount;               // Bits available in bit buffer
+    int paddingBits;            // Bits added to bit buffer past the end of data
+    int state;                  // Decoding state: 0: zlib header, 1: block header, 2: stored block, 3: huffman block, 4: done, 5: error
+    bool lastBlock;             // Current block is the last one
+    int storedLength;           // Stored block bytes remaining
+    int matchLength;            // Match bytes pending to be copied
+    int matchDistance;          // Match distance
+    unsigned char *window;      // Decoded data window (32 KB, circular)
+    unsigned int position;      // Decoded data position (total bytes)
+    InflateHuffman lengths;     // Literal/length codes
+    InflateHuffman distances;   // Distance codes
+} InflateStream;
+
+// Image stream cached tile
+typedef struct ImageStreamTile {
+    Image image;                // Tile pixels (NULL data: unused)
+    int x;                      // Tile column
+    int y;                      // Tile row
+    unsigned int lastUse;       // Last use counter, least recently used tile replaced
+} ImageStreamTile;
+
+// Image tiles pyramid level, one tiles row of scanlines kept [Used in ExportImageStreamTiles()]
+typedef struct ImagePyramidLevel {
+    unsigned char *band;        // Current tiles row scanlines
+    int width;                  // Level width
+    int height;                 // Level height
+    int rows;                   // Scanlines added to level
+} ImagePyramidLevel;
+
+// Image stream decoder
+// NOTE: Only PNG decoding state (file position, inflate window, two scanlines) and cached tiles are kept in memory
+struct rImageStream {
+    int type;                   // Stream decoding type (ImageStreamType)
+    int width;                  // Image width
+    int height;                 // Image height
+    int format;                 // Decoded pixel format
+    Image image;                // Image fully loaded [IMAGE_STREAM_FULL]
+
+    FILE *file;                 // Image file, read by chunks [IMAGE_STREAM_PNG]
+    PNGInfo png;                // PNG header and color chunks data
+    int chunkRemaining;         // PNG image data chunk bytes remaining in file
+    bool dataEnd;               // PNG image data end reached
+    unsigned char *input;       // File data read buffer
+    int inputSize;              // File data read buffer bytes available
+    int inputPosition;          // File data read buffer position
+    InflateStream inflate;      // Image data decompression state
+    unsigned char *scanlines;   // Current and prior unfiltered scanlines
+    int row;                    // Next scanline to decode
+    bool failed;                // Decoding failed, no more data decoded
+
+    ImageStreamTile tiles[IMAGE_STREAM_CACHE_TILES];    // Cached tiles
+    unsigned int useCounter;    // Tiles use counter
+};
+#endif
+
+#if defined(SUPPORT_IMAGE_CACHE)
+// Image cache file header, image data follows (64 bytes)
+// NOTE: Cache files are named by entry key, header is fully compared on loading
+typedef struct ImageCacheHeader {
+    char id[4];                 // Cache file identifier: "rIMC"
+    int version;                // Cache file version
+    unsigned long long key;     // Entry key: source file data hash and processing parameters
+    unsigned long long sourceHash;  // Source file data hash
+    int sourceSize;             // Source file data size
+    int width;                  // Requested width (0: source width)
+    int height;                 // Requested height (0: source height)
+    int format;                 // Requested format (0: source format)
+    int mipmaps;                // Requested mipmaps generation
+    int imageWidth;             // Cached image width
+    int imageHeight;            // Cached image height
+    int imageFormat;            // Cached image format
+    int imageMipmaps;           // Cached image mipmaps
+    int dataSize;               // Cached image data size
+} ImageCacheHeader;
+#endif
+
+#if defined(SUPPORT_IMAGE_MAPPING)
+// Memory mapped image, image data points into file mapping
+// NOTE: Mapped image data is released by UnloadImage() or replaced by image processing functions
+typedef struct MappedImage {
+    void *mapping;              // File mapping base address (NULL: unused)
+    int mappingSize;            // File mapping size in bytes
+    void *data;                 // Image data address (inside mapping)
+} MappedImage;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+#if defined(SUPPORT_ASYNC_LOADING)
+static AsyncLoadRequest asyncRequests[MAX_ASYNC_LOAD_REQUESTS] = { 0 };    // Async loading requests (protected by LockAsyncTasks())
+static unsigned int asyncRequestsOrder = 0; // Async loading requests counter, defines loading order (protected by LockAsyncTasks())
+static int asyncLoadTasks = 0;          // Async tasks loading requests (protected by LockAsyncTasks())
+static int asyncUploadsPending = 0;     // Async loaded textures pending to be uploaded (protected by LockAsyncTasks())
+#endif
+#if defined(SUPPORT_IMAGE_MAPPING)
+static MappedImage mappedImages[MAX_MAPPED_IMAGES] = { 0 };   // Memory mapped images (protected by LockAsyncTasks())
+#endif
+#if defined(SUPPORT_IMAGE_CACHE)
+static char imageCacheDirectory[MAX_FILEPATH_LENGTH] = { 0 };  // Image cache directory (empty: cache disabled)
+#endif
+#if defined(SUPPORT_TEXTURE_READBACK)
+static TextureReadback textureReadbacks[MAX_TEXTURE_READBACKS] = { 0 };    // Render texture readback requests
+static int textureReadbackLatency = TEXTURE_READBACK_LATENCY;   // Frames a readback can be in flight before waiting for it
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -257,6 +764,157 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void ConvertPixelsToRGBA8(const void *srcData, int srcFormat, unsigned char *dstData, int count);     // Convert pixel data from any uncompressed format to R8G8B8A8
+static void ConvertPixelsFromRGBA8(const unsigned char *srcData, void *dstData, int dstFormat, int count);   // Convert pixel data from R8G8B8A8 to any uncompressed format
+static void ConvertPixels(const void *srcData, int srcFormat, void *dstData, int dstFormat, int count);      // Convert pixel data between uncompressed formats
+static bool IsPixelFormatHDR(int format);                   // Check if pixel format stores float or half-float channels
+static void ConvertPixelsToFloat(const void *srcData, int srcFormat, float *dstData, int count);     // Convert pixel data from any uncompressed format to float RGBA (not clamped)
+static void ConvertPixelsFromFloat(const float *srcData, void *dstData, int dstFormat, int count);   // Convert pixel data from float RGBA to any uncompressed format
+static void ResizePixels(const void *input, int width, int height, void *output, int newWidth, int newHeight, int channels, int type); // Resize pixels, 8 bit, half-float or float channels
+static void ResizeExtended(STBIR_RESIZE *resize, int outputPixels); // Resize with stbir resize configuration, output splits processed by worker threads
+static void UnloadImageData(void *data);                    // Unload image data, allocated or memory mapped
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void AdjustImageColors(Image *image, ColorAdjustJob *job);  // Adjust image colors, float and half-float formats adjusted in float precision
+static void AddImageOperation(ImagePipeline *pipeline, rImageOperation operation); // Add operation to image pipeline
+static void ApplyPipelineOperations(const ImagePipelineJob *job, int first, int last, int format, unsigned char *pixels, int count, bool quantize); // Apply pipeline color operations to R8G8B8A8 pixels span
+static void QuantizePixelsSpan(unsigned char *pixels, int format, int count);  // Quantize R8G8B8A8 pixels span to pixel format precision
+static void EvaluatePipelineRowsBatch(int start, int end, void *data);  // Evaluate pipeline rows (no resize)
+static const void *ReadPipelineRow(void *output, const void *input, int count, int x, int y, void *data); // Read pipeline source row span for resize, pre stage applied [stbir input callback]
+static void WritePipelineRow(const void *input, int count, int y, void *data); // Write pipeline resized row, post stage applied [stbir output callback]
+#endif
+#if defined(PNG_SCANLINES_REQUIRED)
+#if defined(SUPPORT_FILEFORMAT_PNG)
+static bool ReadHeaderPNG(PNGInfo *info, const unsigned char *header); // Read PNG signature and header chunk (33 bytes)
+#endif
+static void ReadChunkPNG(PNGInfo *info, const unsigned char *type, const unsigned char *data, int size); // Read PNG color chunk data (palette, transparency)
+#if defined(SUPPORT_FILEFORMAT_PNG)
+static int GetPixelFormatPNG(const PNGInfo *info);         // Get PNG decoded pixel format
+#endif
+static bool UnfilterScanlinePNG(const unsigned char *scanline, const unsigned char *prior, unsigned char *output, int pitch, int size); // Unfilter PNG scanline (filter type byte first)
+static void ConvertScanlinePNG(const PNGInfo *info, const unsigned char *scanline, unsigned char *pixels); // Convert unfiltered PNG scanline to decoded pixel format
+#endif
+#if defined(PNG_DECODER_AVAILABLE)
+static Image LoadImagePNG(const unsigned char *fileData, int dataSize); // Load PNG image data (NULL data: not supported, loaded with stb_image)
+#endif
+#if defined(SUPPORT_IMAGE_STREAMING)
+#if defined(SUPPORT_FILEFORMAT_PNG)
+static bool OpenImageStreamPNG(rImageStream *stream, const char *fileName); // Open PNG image stream, headers read until image data
+#endif
+static bool RestartImageStreamPNG(rImageStream *stream);    // Restart PNG image stream decoding from first scanline
+static bool ReadImageStreamRow(rImageStream *stream, unsigned char *pixels); // Read next image stream scanline (converted to stream format)
+static bool SeekImageStreamRow(rImageStream *stream, int row);  // Seek image stream to scanline, restarting or skipping scanlines
+static ImageStreamTile *FindImageStreamTile(rImageStream *stream, int tileX, int tileY); // Find image stream cached tile (NULL: not cached)
+static bool CacheImageStreamTiles(rImageStream *stream, int tileY, int firstTileX, int lastTileX, unsigned char *row); // Decode and cache image stream tiles row range
+#if defined(SUPPORT_IMAGE_EXPORT)
+static bool AddPyramidRow(ImagePyramidLevel *levels, int level, int levelCount, const unsigned char *row, int format, int tileSize, const char *dirPath); // Add scanline to tiles pyramid level, full tiles rows exported
+#endif
+static int ReadImageStreamByte(rImageStream *stream);       // Read next byte of PNG image data chunks (-1: no more data)
+static unsigned int GetInflateBits(rImageStream *stream, int count); // Get inflate stream bits (up to 16)
+static void FillInflateBits(rImageStream *stream);          // Fill inflate bit buffer, zero bits added past data end
+static int InflateStreamRead(rImageStream *stream, unsigned char *output, int count); // Decode inflate stream bytes, returns bytes decoded
+static bool BuildInflateHuffman(InflateHuffman *huffman, const unsigned char *sizes, int count); // Build inflate huffman table from codes lengths
+static int DecodeInflateSymbol(rImageStream *stream, const InflateHuffman *huffman); // Decode inflate huffman symbol (-1: invalid code)
+static bool ReadInflateTables(rImageStream *stream);        // Read inflate dynamic block huffman tables
+#endif
+#if defined(SUPPORT_IMAGE_CACHE)
+static unsigned long long ComputeHash64(const unsigned char *data, int dataSize, unsigned long long seed); // Compute data 64 bit hash (non cryptographic)
+static Image LoadImageCacheFile(const char *fileName, const ImageCacheHeader *entry); // Load image cache file (NULL data: not cached or not matching entry)
+static bool SaveImageCacheFile(const char *fileName, const ImageCacheHeader *entry, Image image); // Save image cache file
+#endif
+#if defined(SUPPORT_IMAGE_MAPPING)
+static Image LoadImageMappedData(const char *fileName, void *mapping, int mappingSize, int offset, int width, int height, int format, int mipmaps); // Load image pointing to file mapping data
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static bool IsImageDataMapped(const void *data);            // Check if image data is memory mapped
+#endif
+#endif
+
+// Image processing jobs, process items range [start, end) [Used in ParallelFor()]
+static void ResizeBatch(int start, int end, void *data);              // Resize output splits
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void AdjustColorsBatch(int start, int end, void *data);        // Adjust pixels colors
+static void AdjustColorsFloatBatch(int start, int end, void *data);   // Adjust float and half-float pixels colors
+#endif
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenGradientLinearBatch(int start, int end, void *data);   // Generate linear gradient rows
+static void GenGradientRadialBatch(int start, int end, void *data);   // Generate radial gradient rows
+static void GenGradientSquareBatch(int start, int end, void *data);   // Generate square gradient rows
+static void GenCheckedBatch(int start, int end, void *data);          // Generate checked pattern rows
+static void GenCellularBatch(int start, int end, void *data);         // Generate cellular rows
+static void GenPerlinNoiseBatch(int start, int end, void *data);      // Generate perlin noise rows
+static void GenNoiseBatch(int start, int end, void *data);            // Generate fractal noise rows
+static void FractalNoiseSpan(const float *x, const float *y, float *noise, int count, const NoiseParams *params); // Compute fractal noise of samples span
+static void PerlinNoiseSpan(const float *x, const float *y, float z, float *noise, int count, unsigned char seed); // Compute perlin noise of samples span (same z)
+#endif
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void BlurRowsBatch(int start, int end, void *data);            // Box blur rows (horizontal)
+static void BlurColumnsBatch(int start, int end, void *data);         // Box blur column tiles (vertical)
+static void BoxBlurSpan(const unsigned short *src, unsigned short *dst, int count, int radius); // Box blur a span of 16 bit RGBA pixels
+static void BlurRowsFloatBatch(int start, int end, void *data);       // Box blur float RGBA rows (horizontal)
+static void BlurColumnsFloatBatch(int start, int end, void *data);    // Box blur float RGBA column tiles (vertical)
+static void BoxBlurFloatSpan(const float *src, float *dst, int count, int radius); // Box blur a span of float RGBA pixels
+static void ConvolveRowsBatch(int start, int end, void *data);        // Kernel convolution rows
+static void RotateRowsBatch(int start, int end, void *data);          // Rotate rows
+#endif
+static void ReduceMipmapRowsBatch(int start, int end, void *data);    // Reduce mipmap level rows (2x2 box filter)
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void ReduceMipmapRowsFloatBatch(int start, int end, void *data); // Reduce float and half-float mipmap level rows (2x2 box filter)
+#endif
+static int ReduceMipmapSpan(const unsigned char *row0, const unsigned char *row1, unsigned char *dst, int count, int channels); // Reduce two rows span to half width
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static float GetAlphaCoverage(const unsigned char *pixels, int count, int channels, float alphaCutoff); // Get alpha test coverage of pixels
+static void ScaleAlphaCoverage(unsigned char *pixels, int count, int channels, float alphaCutoff, float coverage); // Scale pixels alpha to match alpha test coverage
+#endif
+#if defined(PNG_ENCODER_AVAILABLE)
+static unsigned char *EncodePNG(const unsigned char *pixels, int width, int height, int channels, int level, int *dataSize); // Encode 8 bit per channel pixels as PNG file data
+static void EncodePNGChunksBatch(int start, int end, void *data);     // Filter and compress PNG rows chunks
+static void FilterPNGRow(const unsigned char *row, const unsigned char *prior, unsigned char *output, unsigned char *scratch, int pitch, int bpp, int filters); // Filter PNG row, choosing best of first filters types
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int dataSize); // Update Adler-32 checksum with data
+#endif
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+static void CompressBlocksBatch(int start, int end, void *data);      // Compress blocks rows
+static void CompressBlockBC1(const unsigned char *block, unsigned char *output, bool alpha, int quality);   // Compress 4x4 pixels block to BC1 (DXT1)
+static void CompressBlockBC3Alpha(const unsigned char *block, unsigned char *output, int quality);         // Compress 4x4 pixels block alpha to BC3 (DXT5) alpha
+static void CompressBlockETC1(const unsigned char *block, unsigned char *output, int quality);             // Compress 4x4 pixels block to ETC1
+static void CompressBlockEACAlpha(const unsigned char *block, unsigned char *output, int quality);         // Compress 4x4 pixels block alpha to ETC2 EAC alpha
+#endif
+
+static void BlendColorSpan(unsigned char *dst, const unsigned char *coverage, int count, Color color); // Blend color with coverage into R8G8B8A8 pixels span
+static void BlendPixelsSpan(unsigned char *dst, const unsigned char *src, int count);  // Blend R8G8B8A8 pixels span into R8G8B8A8 pixels span
+static void TintPixelsSpan(unsigned char *pixels, int count, Color tint);              // Apply color tint to R8G8B8A8 pixels span
+static void DrawPixelsSpan(unsigned char *dst, int dstFormat, const unsigned char *src, int count, bool blend); // Draw R8G8B8A8 pixels span into any uncompressed format
+static void BlendPixelsFloatSpan(float *dst, const float *src, int count);             // Blend float RGBA pixels span into float RGBA pixels span
+static void TintPixelsFloatSpan(float *pixels, int count, Color tint);                 // Apply color tint to float RGBA pixels span
+static void DrawPixelsFloatSpan(unsigned char *dst, int dstFormat, const float *src, int count, bool blend); // Draw float RGBA pixels span into any uncompressed format
+static void ImageDrawScaled(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, bool blend); // Draw source rectangle scaled into destination (bilinear)
+static void DrawAtlasImage(Image *page, Image image, int posX, int posY, int extrude);   // Draw image into atlas page, extruding image borders
+static void GetPixelColorData(Color color, int format, unsigned char *pixel);           // Get color pixel data in provided uncompressed format
+static int GetPaletteExact(const Color *pixels, int count, Color *palette, int maxColors); // Get exact colors palette (hash set), -1 if more colors than maxColors
+static int GenPaletteMedianCut(const Color *pixels, int count, Color *palette, int maxColors); // Generate reduced colors palette (median cut)
+static int GetQuantizeBinsExact(const Color *pixels, int count, int maxBins, QuantizeBin **bins); // Get color quantization bins for exact colors
+static void MapPaletteIndices(const Color *pixels, int width, int height, const Color *palette, int paletteSize, bool dither, bool skipTransparent, unsigned char *indices); // Map pixels to nearest palette colors indices
+static int FindPaletteIndex(PaletteLookup *lookup, Color color);                        // Find nearest palette color index
+static void GetEdgeSpan(int wRow, int xStep, int *start, int *end);                      // Clip scanline span to pixels on the inner side of a triangle edge
+static void FillPixelsSpan(unsigned char *dst, const unsigned char *pixel, int bytesPerPixel, int count); // Fill span repeating pixel data
+static void BlendCoverageSpan(Image *dst, int x, int y, const unsigned char *coverage, int count, Color color); // Blend color with coverage into image pixels span (any uncompressed format)
+static void ImageFillPolygon(Image *dst, const Vector2 *points, int pointCount, Color color); // Fill polygon with anti-aliased edges (nonzero winding), color blended
+static void AccumulateEdgeCoverage(float *accum, int stride, int bandStart, int bandEnd, Vector2 p0, Vector2 p1, float maxX); // Accumulate polygon edge area coverage in band scanlines
+static void AccumulateRowCoverage(float *row, float xa, float xb, float d, float maxX);   // Accumulate polygon edge area coverage in a scanline
+
+int PackRecsMaxRects(Rectangle *recs, bool *packed, int count, int width, int height);   // Pack rectangles into a bin (MaxRects), required by GenImageFontAtlas()
+static void InitPackBin(PackBin *bin, int width, int height);           // Init rectangles packing bin (full bin free)
+static void UnloadPackBin(PackBin *bin);                                // Unload rectangles packing bin
+static int FindPackBinFreeRec(const PackBin *bin, int width, int height); // Find best free rectangle to place a rectangle
+static void PlacePackBinRec(PackBin *bin, PackFreeRec placed);          // Place rectangle in bin, updating free rectangles
+
+#if defined(SUPPORT_ASYNC_LOADING)
+static void LoadAsyncRequestTask(void *data);   // Load queued async requests images (background thread)
+extern void UpdateAsyncLoading(void);           // Upload async loaded textures to GPU, required by EndDrawing()
+extern void CloseAsyncLoading(void);            // Wait for async loading and unload requests, required by CloseWindow()
+#endif
+#if defined(SUPPORT_MODULE_RTEXT)
+static bool ImageDrawTextGlyphs(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text glyphs directly into R8G8B8A8 image
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -267,6 +925,11 @@ Image LoadImage(const char *fileName)
 {
     Image image = { 0 };
 
+#if defined(SUPPORT_IMAGE_CACHE)
+    // Decoded image data cached when image cache is enabled (compressed and raw formats are not cached)
+    if ((imageCacheDirectory[0] != '\0') && IsFileExtension(fileName, ".png;.bmp;.tga;.jpg;.jpeg;.gif;.pic;.psd;.hdr;.ppm;.pgm;.qoi")) return LoadImageProcessed(fileName, 0, 0, 0, false);
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_PNG) || \
     defined(SUPPORT_FILEFORMAT_BMP) || \
     defined(SUPPORT_FILEFORMAT_TGA) || \
@@ -306,12 +969,14 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
     if (fileData != NULL)
     {
         unsigned char *dataPtr = fileData;
-        int size = GetPixelDataSize(width, height, format);
 
-        if (size <= dataSize)   // Security check
+        // NOTE: Dimensions limited so data size can not overflow (16 bytes per pixel at most)
+        int size = ((width > 0) && (height > 0) && (((long long)width*height) <= (INT_MAX/16)))? GetPixelDataSize(width, height, format) : 0;
+
+        if ((size > 0) && (size <= dataSize))   // Security check
         {
             // Offset file data to expected raw image by header size
-            if ((headerSize > 0) && ((headerSize + size) <= dataSize)) dataPtr += headerSize;
+            if ((headerSize > 0) && (((long long)headerSize + size) <= dataSize)) dataPtr += headerSize;
 
             image.data = RL_MALLOC(size);      // Allocate required memory in bytes
             memcpy(image.data, dataPtr, size); // Copy required data to image
@@ -327,6 +992,177 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
     return image;
 }
 
+// Load an image from RAW file data, pixel data memory mapped (no copy)
+// NOTE: File pages are loaded on demand and shared with OS file cache, data is private (copy-on-write),
+// image data is loaded with LoadImageRaw() if memory mapping is not available
+Image LoadImageRawMapped(const char *fileName, int width, int height, int format, int headerSize)
+{
+    Image image = { 0 };
+
+#if defined(SUPPORT_IMAGE_MAPPING)
+    int dataSize = 0;
+    void *mapping = MapFileData(fileName, &dataSize);
+
+    if (mapping != NULL)
+    {
+        int size = ((width > 0) && (height > 0) && (((long long)width*height) <= (INT_MAX/16)))? GetPixelDataSize(width, height, format) : 0;
+        if (headerSize < 0) headerSize = 0;
+
+        if ((size > 0) && (((long long)headerSize + size) <= dataSize))   // Security check, no overflow
+        {
+            image = LoadImageMappedData(fileName, mapping, dataSize, headerSize, width, height, format, 1);
+        }
+        else UnmapFileData(mapping, dataSize);  // Loaded below, same checks as LoadImageRaw()
+    }
+
+    if (image.data == NULL) image = LoadImageRaw(fileName, width, height, format, headerSize);
+#else
+    image = LoadImageRaw(fileName, width, height, format, headerSize);
+#endif
+
+    return image;
+}
+
+// Load image from file, pixel data memory mapped (no copy) if stored in file as loaded
+// NOTE: Memory mapped files: DDS (DXT1, DXT3, DXT5, R5G6B5, R8G8B8), KTX (single mipmap level), PVR v3,
+// other files or pixel data layouts requiring conversion are loaded with LoadImage()
+Image LoadImageMapped(const char *fileName)
+{
+    Image image = { 0 };
+
+#if defined(SUPPORT_IMAGE_MAPPING) && \
+    (defined(SUPPORT_FILEFORMAT_DDS) || defined(SUPPORT_FILEFORMAT_KTX) || defined(SUPPORT_FILEFORMAT_PVR))
+    if (IsFileExtension(fileName, ".dds;.ktx;.pvr"))
+    {
+        int dataSize = 0;
+        void *mapping = MapFileData(fileName, &dataSize);
+
+        if (mapping != NULL)
+        {
+            int width = 0, height = 0, format = 0, mipmaps = 0, size = 0;
+            unsigned int offset = rl_get_gputex_data_offset((const unsigned char *)mapping, dataSize, &width, &height, &format, &mipmaps, &size);
+
+            if (offset > 0) image = LoadImageMappedData(fileName, mapping, dataSize, (int)offset, width, height, format, mipmaps);
+            else UnmapFileData(mapping, dataSize);
+        }
+    }
+#endif
+
+    if (image.data == NULL) image = LoadImage(fileName);
+
+    return image;
+}
+
+// Load image resized (0: keep size), converted to format (0: keep format) and mipmaps generated
+// NOTE: Processed image data is cached when image cache is enabled, keyed by source file content
+// and processing parameters, cached data is loaded without decoding (memory mapped if possible)
+Image LoadImageProcessed(const char *fileName, int width, int height, int format, bool mipmaps)
+{
+    Image image = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData == NULL) return image;
+
+#if defined(SUPPORT_IMAGE_CACHE)
+    char cacheFileName[MAX_FILEPATH_LENGTH + 32] = { 0 };
+    ImageCacheHeader entry = { 0 };
+    bool cached = (imageCacheDirectory[0] != '\0');
+
+    if (cached)
+    {
+        entry.version = IMAGE_CACHE_VERSION;
+        entry.sourceHash = ComputeHash64(fileData, dataSize, 0);
+        entry.sourceSize = dataSize;
+        entry.width = (width > 0)? width : 0;
+        entry.height = (height > 0)? height : 0;
+        entry.format = (format > 0)? format : 0;
+        entry.mipmaps = mipmaps? 1 : 0;
+
+        int parameters[5] = { entry.sourceSize, entry.width, entry.height, entry.format, entry.mipmaps };
+        entry.key = ComputeHash64((const unsigned char *)parameters, sizeof(parameters), entry.sourceHash ^ IMAGE_CACHE_VERSION);
+
+        snprintf(cacheFileName, sizeof(cacheFileName), "%s/%016llx.rimg", imageCacheDirectory, entry.key);
+        image = LoadImageCacheFile(cacheFileName, &entry);
+
+        if (image.data != NULL)
+        {
+            UnloadFileData(fileData);
+            TRACELOG(LOG_INFO, "IMAGE: [%s] Data loaded from cache (%ix%i | %s | %i mipmaps)", fileName, image.width, image.height, rlGetPixelFormatName(image.format), image.mipmaps);
+            return image;
+        }
+    }
+#endif
+
+    image = LoadImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
+    UnloadFileData(fileData);
+
+    if (image.data == NULL) return image;
+
+    // Resize and uncompressed format conversion, applied in a single pass if possible
+    bool resize = ((width > 0) && (width != image.width)) || ((height > 0) && (height != image.height));
+    bool compress = (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB);
+    int newWidth = (width > 0)? width : image.width;
+    int newHeight = (height > 0)? height : image.height;
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+    if (resize || ((format > 0) && !compress && (format != image.format)))
+    {
+        ImagePipeline pipeline = LoadImagePipeline(image);
+
+        if (resize) ImagePipelineResize(&pipeline, newWidth, newHeight);
+        if ((format > 0) && !compress) ImagePipelineFormat(&pipeline, format);
+
+        Image processed = LoadImageFromPipeline(pipeline);
+        UnloadImagePipeline(pipeline);
+        UnloadImage(image);
+        image = processed;
+    }
+
+    if (mipmaps) ImageMipmaps(&image);
+#else
+    if (resize) ImageResize(&image, newWidth, newHeight);
+    if ((format > 0) && !compress) ImageFormat(&image, format);
+    if (mipmaps) TRACELOG(LOG_WARNING, "IMAGE: Mipmaps generation requires SUPPORT_IMAGE_MANIPULATION");
+#endif
+
+    // GPU compressed formats, mipmaps also compressed
+    if (compress) ImageFormat(&image, format);
+
+#if defined(SUPPORT_IMAGE_CACHE)
+    if (cached && (image.data != NULL))
+    {
+        if (SaveImageCacheFile(cacheFileName, &entry, image)) TRACELOG(LOG_INFO, "IMAGE: [%s] Data saved to cache", fileName);
+        else TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to save data to cache", fileName);
+    }
+#endif
+
+    return image;
+}
+
+// Set decoded images cache directory, loaded images data cached by file content (NULL: disabled)
+// NOTE: Cache entries are never removed, entries of modified files are just not used anymore
+void SetImageCacheDirectory(const char *dirPath)
+{
+#if defined(SUPPORT_IMAGE_CACHE)
+    imageCacheDirectory[0] = '\0';
+
+    if ((dirPath != NULL) && (dirPath[0] != '\0'))
+    {
+        if (!DirectoryExists(dirPath) && (MakeDirectory(dirPath) != 0)) TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to create image cache directory", dirPath);
+        else if (strlen(dirPath) >= MAX_FILEPATH_LENGTH) TRACELOG(LOG_WARNING, "IMAGE: [%s] Image cache directory path too long", dirPath);
+        else
+        {
+            strcpy(imageCacheDirectory, dirPath);
+            TRACELOG(LOG_INFO, "IMAGE: [%s] Image cache enabled", dirPath);
+        }
+    }
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: Image cache not supported, SUPPORT_IMAGE_CACHE required");
+#endif
+}
+
 // Load animated image data
 //  - Image.data buffer includes all frames: [image#0][image#1][image#2][...]
 //  - Number of frames is returned through 'frames' parameter
@@ -457,10 +1293,14 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
 #endif
         )
     {
+#if defined(PNG_DECODER_AVAILABLE)
+        // NOTE: PNG images decoded with sinfl, images not supported (interlaced) loaded with stb_image
+        if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0)) image = LoadImagePNG(fileData, dataSize);
+#endif
 #if defined(STBI_REQUIRED)
         // NOTE: Using stb_image to load images (Supports multiple image formats)
 
-        if (fileData != NULL)
+        if ((fileData != NULL) && (image.data == NULL))
         {
             int comp = 0;
             image.data = stbi_load_from_memory(fileData, dataSize, &image.width, &image.height, &comp, 0);
@@ -616,7 +1456,7 @@ bool IsImageValid(Image image)
 // Unload image from CPU memory (RAM)
 void UnloadImage(Image image)
 {
-    RL_FREE(image.data);
+    UnloadImageData(image.data);
 }
 
 // Export image data to file
@@ -637,9 +1477,10 @@ bool ExportImage(Image image, const char *fileName)
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-    else
+    else if (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
         // NOTE: Getting Color array as RGBA unsigned char values
+        // Compressed formats can only be exported as raw data containers (.dds, .ktx, .raw)
         imgData = (unsigned char *)LoadImageColors(image);
         allocatedData = true;
     }
@@ -648,7 +1489,11 @@ bool ExportImage(Image image, const char *fileName)
     if (IsFileExtension(fileName, ".png"))
     {
         int dataSize = 0;
+    #if defined(PNG_ENCODER_AVAILABLE)
+        unsigned char *fileData = EncodePNG(imgData, image.width, image.height, channels, PNG_COMPRESSION_LEVEL, &dataSize);
+    #else
         unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
+    #endif
         result = SaveFileData(fileName, fileData, dataSize);
         RL_FREE(fileData);
     }
@@ -685,6 +1530,24 @@ bool ExportImage(Image image, const char *fileName)
         }
     }
 #endif
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    else if (IsFileExtension(fileName, ".dds"))
+    {
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+            ((image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (image.format <= PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+        {
+            result = rl_save_dds(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
+        }
+        else if (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
+        {
+            // NOTE: Other uncompressed formats are exported as R8G8B8A8, without mipmaps
+            unsigned char *colors = allocatedData? imgData : (unsigned char *)LoadImageColors(image);
+            result = rl_save_dds(fileName, colors, image.width, image.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+            if (!allocatedData) RL_FREE(colors);
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported for DDS export, use KTX");
+    }
+#endif
 #if defined(SUPPORT_FILEFORMAT_KTX)
     else if (IsFileExtension(fileName, ".ktx"))
     {
@@ -727,10 +1590,71 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0))
     {
+    #if defined(PNG_ENCODER_AVAILABLE)
+        fileData = EncodePNG((const unsigned char *)image.data, image.width, image.height, channels, PNG_COMPRESSION_LEVEL, dataSize);
+    #else
         fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+    #endif
+    }
+#endif
+
+#endif
+
+    return fileData;
+}
+
+// Export image as PNG file with compression level: 0 (fastest) to 9 (smallest)
+bool ExportImagePNG(Image image, const char *fileName, int level)
+{
+    bool result = false;
+    int dataSize = 0;
+    unsigned char *fileData = ExportImagePNGToMemory(image, level, &dataSize);
+
+    if (fileData != NULL)
+    {
+        result = SaveFileData(fileName, fileData, dataSize);
+        RL_FREE(fileData);
+    }
+
+    if (result) TRACELOG(LOG_INFO, "FILEIO: [%s] Image exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image", fileName);
+
+    return result;
+}
+
+// Export image to memory buffer as PNG file data with compression level: 0 (fastest) to 9 (smallest)
+// NOTE: Large images are compressed in parallel, in chunks of PNG_COMPRESS_CHUNK_SIZE
+unsigned char *ExportImagePNGToMemory(Image image, int level, int *fileSize)
+{
+    unsigned char *fileData = NULL;
+    *fileSize = 0;
+
+    // Security check for input data
+    if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return NULL;
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported for PNG export");
+        return NULL;
     }
+
+    int channels = 4;
+    unsigned char *imgData = (unsigned char *)image.data;
+
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+    else if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) imgData = (unsigned char *)LoadImageColors(image);
+
+#if defined(PNG_ENCODER_AVAILABLE)
+    fileData = EncodePNG(imgData, image.width, image.height, channels, level, fileSize);
+#else
+    // NOTE: stb_image_write compression level is fixed, level is not considered
+    fileData = stbi_write_png_to_mem(imgData, image.width*channels, image.width, image.height, channels, fileSize);
 #endif
 
+    if (imgData != image.data) RL_FREE(imgData);
 #endif
 
     return fileData;
@@ -794,34 +1718,364 @@ bool ExportImageAsCode(Image image, const char *fileName)
 }
 
 //------------------------------------------------------------------------------------
-// Image generation functions
+// Image streaming functions
 //------------------------------------------------------------------------------------
-// Generate image: plain color
-Image GenImageColor(int width, int height, Color color)
+// Load image stream from file, image data decoded on request
+// NOTE: Non-interlaced PNG images are decoded by scanlines keeping only decoding state in memory,
+// other formats (and interlaced PNG images) are fully loaded, memory mapped if possible
+ImageStream LoadImageStream(const char *fileName)
 {
-    Color *pixels = (Color *)RL_CALLOC(width*height, sizeof(Color));
+    ImageStream stream = { 0 };
 
-    for (int i = 0; i < width*height; i++) pixels[i] = color;
+#if defined(SUPPORT_IMAGE_STREAMING)
+    rImageStream *decoder = (rImageStream *)RL_CALLOC(1, sizeof(rImageStream));
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (IsFileExtension(fileName, ".png") && OpenImageStreamPNG(decoder, fileName)) decoder->type = IMAGE_STREAM_PNG;
+    else
+#endif
+    {
+        decoder->type = IMAGE_STREAM_FULL;
+        decoder->image = LoadImageMapped(fileName);
 
-    return image;
-}
+        if (decoder->image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: [%s] Image stream not supported for compressed formats", fileName);
+            UnloadImage(decoder->image);
+            decoder->image = (Image){ 0 };
+        }
 
-#if defined(SUPPORT_IMAGE_GENERATION)
-// Generate image: linear gradient
-// The direction value specifies the direction of the gradient (in degrees)
-// with 0 being vertical (from top to bottom), 90 being horizontal (from left to right)
-// The gradient effectively rotates counter-clockwise by the specified amount
-Image GenImageGradientLinear(int width, int height, int direction, Color start, Color end)
-{
-    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
+        if (decoder->image.data != NULL)
+        {
+            decoder->width = decoder->image.width;
+            decoder->height = decoder->image.height;
+            decoder->format = decoder->image.format;
+        }
+    }
+
+    if ((decoder->width > 0) && (decoder->height > 0))
+    {
+        stream.width = decoder->width;
+        stream.height = decoder->height;
+        stream.format = decoder->format;
+        stream.decoder = decoder;
+
+        TRACELOG(LOG_INFO, "IMAGE: [%s] Image stream loaded successfully (%ix%i | %s)", fileName, stream.width, stream.height,
+            (decoder->type == IMAGE_STREAM_PNG)? "scanlines decoded on request" : "fully loaded");
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to load image stream", fileName);
+        RL_FREE(decoder);
+    }
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: Image streaming not supported");
+#endif
+
+    return stream;
+}
+
+// Check if an image stream is valid
+bool IsImageStreamValid(ImageStream stream)
+{
+    return ((stream.decoder != NULL) && (stream.width > 0) && (stream.height > 0));
+}
+
+// Unload image stream (decoder and cached tiles)
+void UnloadImageStream(ImageStream stream)
+{
+#if defined(SUPPORT_IMAGE_STREAMING)
+    rImageStream *decoder = stream.decoder;
+    if (decoder == NULL) return;
+
+    for (int i = 0; i < IMAGE_STREAM_CACHE_TILES; i++) UnloadImage(decoder->tiles[i].image);
+
+    if (decoder->file != NULL) fclose(decoder->file);
+    RL_FREE(decoder->input);
+    RL_FREE(decoder->inflate.window);
+    RL_FREE(decoder->scanlines);
+    UnloadImage(decoder->image);
+    RL_FREE(decoder);
+#endif
+}
+
+// Load image scanlines band from stream
+// NOTE: Successive bands continue decoding, previous scanlines require decoding again from image start
+Image LoadImageStreamRows(ImageStream stream, int startRow, int rowCount)
+{
+    Image image = { 0 };
+
+#if defined(SUPPORT_IMAGE_STREAMING)
+    if (!IsImageStreamValid(stream)) return image;
+
+    rImageStream *decoder = stream.decoder;
+
+    // Security checks to validate scanlines band, computed in 64 bit (no overflow)
+    long long firstRow = (startRow > 0)? startRow : 0;
+    long long lastRow = (long long)startRow + rowCount;     // Last row (not included)
+    if (lastRow > stream.height) lastRow = stream.height;
+    if (lastRow <= firstRow)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to load image stream scanlines, out of bounds");
+        return image;
+    }
+
+    startRow = (int)firstRow;
+    rowCount = (int)(lastRow - firstRow);
+
+    size_t rowSize = (size_t)GetPixelDataSize(stream.width, 1, stream.format);
+    unsigned char *data = (unsigned char *)RL_MALLOC(rowSize*rowCount);
+    bool success = true;
+
+    if (data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate image stream scanlines memory");
+        return image;
+    }
+
+    if (decoder->type == IMAGE_STREAM_FULL) memcpy(data, (unsigned char *)decoder->image.data + rowSize*startRow, rowSize*rowCount);
+    else
+    {
+        success = SeekImageStreamRow(decoder, startRow);
+        for (int y = 0; success && (y < rowCount); y++) success = ReadImageStreamRow(decoder, data + rowSize*y);
+    }
+
+    if (success)
+    {
+        image.data = data;
+        image.width = stream.width;
+        image.height = rowCount;
+        image.format = stream.format;
+        image.mipmaps = 1;
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to decode image stream scanlines");
+        RL_FREE(data);
+    }
+#endif
+
+    return image;
+}
+
+// Load image region from stream
+// NOTE: Regions are composed from cached tiles (decoded by tiles rows), regions covering
+// more than half the tiles cache are decoded directly (not cached)
+Image LoadImageStreamRec(ImageStream stream, Rectangle rec)
+{
+    Image image = { 0 };
+
+#if defined(SUPPORT_IMAGE_STREAMING)
+    if (!IsImageStreamValid(stream)) return image;
+
+    rImageStream *decoder = stream.decoder;
+
+    // Security checks to validate region rectangle, computed in 64 bit (no overflow),
+    // not valid values (NaN) or values out of 64 bit range are out of bounds
+    if (!(fabsf(rec.x) < 1e18f) || !(fabsf(rec.y) < 1e18f) || !(fabsf(rec.width) < 1e18f) || !(fabsf(rec.height) < 1e18f))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to load image stream region, rectangle out of bounds");
+        return image;
+    }
+
+    long long left = (long long)rec.x;
+    long long top = (long long)rec.y;
+    long long right = left + (long long)rec.width;      // Region right limit (not included)
+    long long bottom = top + (long long)rec.height;     // Region bottom limit (not included)
+    if (left < 0) left = 0;
+    if (top < 0) top = 0;
+    if (right > stream.width) right = stream.width;
+    if (bottom > stream.height) bottom = stream.height;
+    if ((right <= left) || (bottom <= top))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to load image stream region, rectangle out of bounds");
+        return image;
+    }
+
+    int x = (int)left;
+    int y = (int)top;
+    int width = (int)(right - left);
+    int height = (int)(bottom - top);
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, stream.format);
+    size_t pitch = (size_t)width*bytesPerPixel;
+    unsigned char *data = (unsigned char *)RL_MALLOC(pitch*height);
+    bool success = true;
+
+    if (data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate image stream region memory");
+        return image;
+    }
+
+    if (decoder->type == IMAGE_STREAM_FULL)
+    {
+        size_t imagePitch = (size_t)stream.width*bytesPerPixel;
+        for (int j = 0; j < height; j++) memcpy(data + pitch*j, (unsigned char *)decoder->image.data + imagePitch*(y + j) + (size_t)x*bytesPerPixel, pitch);
+    }
+    else
+    {
+        int firstTileX = x/IMAGE_STREAM_TILE_SIZE;
+        int lastTileX = (x + width - 1)/IMAGE_STREAM_TILE_SIZE;
+        int firstTileY = y/IMAGE_STREAM_TILE_SIZE;
+        int lastTileY = (y + height - 1)/IMAGE_STREAM_TILE_SIZE;
+        unsigned char *row = (unsigned char *)RL_MALLOC((size_t)stream.width*bytesPerPixel);
+
+        if (row == NULL) success = false;
+        else if ((lastTileX - firstTileX + 1)*(lastTileY - firstTileY + 1) > IMAGE_STREAM_CACHE_TILES/2)
+        {
+            success = SeekImageStreamRow(decoder, y);
+
+            for (int j = 0; success && (j < height); j++)
+            {
+                success = ReadImageStreamRow(decoder, row);
+                if (success) memcpy(data + pitch*j, row + (size_t)x*bytesPerPixel, pitch);
+            }
+        }
+        else
+        {
+            decoder->useCounter++;
+
+            for (int tileY = firstTileY; success && (tileY <= lastTileY); tileY++)
+            {
+                success = CacheImageStreamTiles(decoder, tileY, firstTileX, lastTileX, row);
+
+                for (int tileX = firstTileX; success && (tileX <= lastTileX); tileX++)
+                {
+                    Image tile = FindImageStreamTile(decoder, tileX, tileY)->image;
+
+                    // Tile and region intersection copied
+                    int startX = (x > tileX*IMAGE_STREAM_TILE_SIZE)? x : tileX*IMAGE_STREAM_TILE_SIZE;
+                    int startY = (y > tileY*IMAGE_STREAM_TILE_SIZE)? y : tileY*IMAGE_STREAM_TILE_SIZE;
+                    int endX = ((x + width) < (tileX*IMAGE_STREAM_TILE_SIZE + tile.width))? (x + width) : (tileX*IMAGE_STREAM_TILE_SIZE + tile.width);
+                    int endY = ((y + height) < (tileY*IMAGE_STREAM_TILE_SIZE + tile.height))? (y + height) : (tileY*IMAGE_STREAM_TILE_SIZE + tile.height);
+
+                    for (int j = startY; j < endY; j++)
+                    {
+                        memcpy(data + pitch*(j - y) + (size_t)(startX - x)*bytesPerPixel,
+                            (unsigned char *)tile.data + ((size_t)(j - tileY*IMAGE_STREAM_TILE_SIZE)*tile.width + (startX - tileX*IMAGE_STREAM_TILE_SIZE))*bytesPerPixel,
+                            (size_t)(endX - startX)*bytesPerPixel);
+                    }
+                }
+            }
+        }
+
+        RL_FREE(row);
+    }
+
+    if (success)
+    {
+        image.data = data;
+        image.width = width;
+        image.height = height;
+        image.format = stream.format;
+        image.mipmaps = 1;
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to decode image stream region");
+        RL_FREE(data);
+    }
+#endif
+
+    return image;
+}
+
+// Export image stream as tiled mip pyramid PNG files: dirPath/level/x_y.png
+// NOTE: Image is decoded once by scanlines, every level keeps only one tiles row of scanlines,
+// levels are reduced by 2x2 box filter (odd sizes rounded up) until the level fits one tile,
+// pixel formats with more than 8 bit per channel are exported as R8G8B8A8
+bool ExportImageStreamTiles(ImageStream stream, const char *dirPath, int tileSize)
+{
+    bool success = false;
+
+#if defined(SUPPORT_IMAGE_STREAMING) && defined(SUPPORT_IMAGE_EXPORT)
+    if (!IsImageStreamValid(stream)) return success;
+
+    if ((tileSize < 2) || ((tileSize%2) != 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Image stream tile size must be even");
+        return success;
+    }
+
+    rImageStream *decoder = stream.decoder;
+
+    int channels = 4;
+    int format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    if ((stream.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (stream.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+        (stream.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)) { channels = GetPixelDataSize(1, 1, stream.format); format = stream.format; }
+
+    ImagePyramidLevel levels[32] = { 0 };
+    int levelCount = 0;
+
+    for (int width = stream.width, height = stream.height; levelCount < 32; width = (width + 1)/2, height = (height + 1)/2)
+    {
+        levels[levelCount].width = width;
+        levels[levelCount].height = height;
+        levels[levelCount].band = (unsigned char *)RL_MALLOC((size_t)width*tileSize*channels);
+        levelCount++;
+
+        if ((width <= tileSize) && (height <= tileSize)) break;
+    }
+
+    success = true;
+    for (int i = 0; success && (i < levelCount); i++) success = (MakeDirectory(TextFormat("%s/%i", dirPath, i)) == 0);
+
+    size_t streamPitch = (size_t)GetPixelDataSize(stream.width, 1, stream.format);
+    unsigned char *streamRow = (unsigned char *)RL_MALLOC(streamPitch);
+    unsigned char *row = (format == stream.format)? streamRow : (unsigned char *)RL_MALLOC((size_t)stream.width*channels);
+
+    if (success && (decoder->type == IMAGE_STREAM_PNG)) success = SeekImageStreamRow(decoder, 0);
+
+    for (int y = 0; success && (y < stream.height); y++)
+    {
+        if (decoder->type == IMAGE_STREAM_FULL) memcpy(streamRow, (unsigned char *)decoder->image.data + streamPitch*y, streamPitch);
+        else success = ReadImageStreamRow(decoder, streamRow);
+
+        if (row != streamRow) ConvertPixelsToRGBA8(streamRow, stream.format, row, stream.width);
+        if (success) success = AddPyramidRow(levels, 0, levelCount, row, format, tileSize, dirPath);
+    }
+
+    if (row != streamRow) RL_FREE(row);
+    RL_FREE(streamRow);
+    for (int i = 0; i < levelCount; i++) RL_FREE(levels[i].band);
+
+    if (success) TRACELOG(LOG_INFO, "IMAGE: [%s] Image stream tiles exported successfully (%i levels)", dirPath, levelCount);
+    else TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to export image stream tiles", dirPath);
+#endif
+
+    return success;
+}
+
+//------------------------------------------------------------------------------------
+// Image generation functions
+//------------------------------------------------------------------------------------
+// Generate image: plain color
+Image GenImageColor(int width, int height, Color color)
+{
+    Color *pixels = (Color *)RL_CALLOC(width*height, sizeof(Color));
+
+    for (int i = 0; i < width*height; i++) pixels[i] = color;
+
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
+
+    return image;
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate image: linear gradient
+// The direction value specifies the direction of the gradient (in degrees)
+// with 0 being vertical (from top to bottom), 90 being horizontal (from left to right)
+// The gradient effectively rotates counter-clockwise by the specified amount
+Image GenImageGradientLinear(int width, int height, int direction, Color start, Color end)
+{
+    Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
     float radianDirection = (float)(90 - direction)/180.f*3.14159f;
     float cosDir = cosf(radianDirection);
@@ -834,25 +2088,10 @@ Image GenImageGradientLinear(int width, int height, int direction, Color start,
     // (i.e. the pixel which should become one of the gradient's ends color); while for
     // directions that lie in the second or fourth quadrant, that point is pixel (width, 0).
     float maxPosValue = ((signbit(sinDir) != 0) == (signbit(cosDir) != 0))? fabsf(startingPos) : fabsf(startingPos + width*cosDir);
-    for (int i = 0; i < width; i++)
-    {
-        for (int j = 0; j < height; j++)
-        {
-            // Calculate the relative position of the pixel along the gradient direction
-            float pos = (startingPos + (i*cosDir + j*sinDir))/maxPosValue;
-
-            float factor = pos;
-            factor = (factor > 1.0f)? 1.0f : factor;  // Clamp to [-1,1]
-            factor = (factor < -1.0f)? -1.0f : factor;  // Clamp to [-1,1]
-            factor = factor/2.0f + 0.5f;
 
-            // Generate the color for this pixel
-            pixels[j*width + i].r = (int)((float)end.r*factor + (float)start.r*(1.0f - factor));
-            pixels[j*width + i].g = (int)((float)end.g*factor + (float)start.g*(1.0f - factor));
-            pixels[j*width + i].b = (int)((float)end.b*factor + (float)start.b*(1.0f - factor));
-            pixels[j*width + i].a = (int)((float)end.a*factor + (float)start.a*(1.0f - factor));
-        }
-    }
+    GradientJob job = { .pixels = pixels, .width = width, .height = height, .start = start, .end = end,
+                        .cosDir = cosDir, .sinDir = sinDir, .startingPos = startingPos, .maxPosValue = maxPosValue };
+    ParallelFor(height, IMAGE_PARALLEL_MIN_ROWS(width), GenGradientLinearBatch, &job);
 
     Image image = {
         .data = pixels,
@@ -869,27 +2108,9 @@ Image GenImageGradientLinear(int width, int height, int direction, Color start,
 Image GenImageGradientRadial(int width, int height, float density, Color inner, Color outer)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
-    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
-
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float dist = hypotf((float)x - centerX, (float)y - centerY);
-            float factor = (dist - radius*density)/(radius*(1.0f - density));
-
-            factor = (float)fmax(factor, 0.0f);
-            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
 
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    GradientJob job = { .pixels = pixels, .width = width, .height = height, .start = inner, .end = outer, .density = density };
+    ParallelFor(height, IMAGE_PARALLEL_MIN_ROWS(width), GenGradientRadialBatch, &job);
 
     Image image = {
         .data = pixels,
@@ -907,38 +2128,8 @@ Image GenImageGradientSquare(int width, int height, float density, Color inner,
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    float centerX = (float)width/2.0f;
-    float centerY = (float)height/2.0f;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            // Calculate the Manhattan distance from the center
-            float distX = fabsf(x - centerX);
-            float distY = fabsf(y - centerY);
-
-            // Normalize the distances by the dimensions of the gradient rectangle
-            float normalizedDistX = distX/centerX;
-            float normalizedDistY = distY/centerY;
-
-            // Calculate the total normalized Manhattan distance
-            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
-
-            // Subtract the density from the manhattanDist, then divide by (1 - density)
-            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
-            float factor = (manhattanDist - density)/(1.0f - density);
-
-            // Clamp the factor between 0 and 1
-            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
-
-            // Blend the colors based on the calculated factor
-            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
-            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
-            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
-            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
-        }
-    }
+    GradientJob job = { .pixels = pixels, .width = width, .height = height, .start = inner, .end = outer, .density = density };
+    ParallelFor(height, IMAGE_PARALLEL_MIN_ROWS(width), GenGradientSquareBatch, &job);
 
     Image image = {
         .data = pixels,
@@ -956,14 +2147,8 @@ Image GenImageChecked(int width, int height, int checksX, int checksY, Color col
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = col1;
-            else pixels[y*width + x] = col2;
-        }
-    }
+    GradientJob job = { .pixels = pixels, .width = width, .height = height, .start = col1, .end = col2, .checksX = checksX, .checksY = checksY };
+    ParallelFor(height, IMAGE_PARALLEL_MIN_ROWS(width), GenCheckedBatch, &job);
 
     Image image = {
         .data = pixels,
@@ -1004,40 +2189,8 @@ Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    float aspectRatio = (float)width/(float)height;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
-
-            // Apply aspect ratio compensation to wider side
-            if (width > height) nx *= aspectRatio;
-            else ny /= aspectRatio;
-
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
-
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
-
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
-
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
-
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    NoiseJob job = { .pixels = pixels, .width = width, .height = height, .offsetX = offsetX, .offsetY = offsetY, .scale = scale };
+    ParallelFor(height, IMAGE_PARALLEL_MIN_ROWS(width), GenPerlinNoiseBatch, &job);
 
     Image image = {
         .data = pixels,
@@ -1068,49 +2221,75 @@ Image GenImageCellular(int width, int height, int tileSize)
         seeds[i] = (Vector2){ (float)x, (float)y };
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
+    NoiseJob job = { .pixels = pixels, .width = width, .height = height, .seeds = seeds,
+                     .seedsPerRow = seedsPerRow, .seedsPerCol = seedsPerCol, .tileSize = tileSize };
+    ParallelFor(height, IMAGE_PARALLEL_MIN_ROWS(width), GenCellularBatch, &job);
 
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
+    RL_FREE(seeds);
 
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+    Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
 
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+    return image;
+}
 
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
-
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
-
-    RL_FREE(seeds);
+// Generate image: fractal noise (fbm, ridged multifractal, turbulence), optionally domain warped
+// NOTE: Values generated as R32 in range [0..1] (use ImageFormat() for 8 bit), rows generated in parallel
+Image GenImageNoise(int width, int height, NoiseParams params)
+{
+    Image image = { 0 };
 
-    Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    if ((width <= 0) || (height <= 0)) return image;
+
+    // Zero parameters use default values, not valid parameters (NaN) too
+    if (params.octaves <= 0) params.octaves = 6;
+    if ((params.lacunarity == 0.0f) || (params.lacunarity != params.lacunarity)) params.lacunarity = 2.0f;
+    if ((params.gain == 0.0f) || (params.gain != params.gain)) params.gain = 0.5f;
+    if ((params.ridgeOffset == 0.0f) || (params.ridgeOffset != params.ridgeOffset)) params.ridgeOffset = 1.0f;
+    if (params.offset.x != params.offset.x) params.offset.x = 0.0f;
+    if (params.offset.y != params.offset.y) params.offset.y = 0.0f;
+    if (params.scale != params.scale) params.scale = 0.0f;
+    if (params.warp != params.warp) params.warp = 0.0f;
+    params.offset.x = fmaxf(-NOISE_MAX_COORDINATE, fminf(params.offset.x, NOISE_MAX_COORDINATE));
+    params.offset.y = fmaxf(-NOISE_MAX_COORDINATE, fminf(params.offset.y, NOISE_MAX_COORDINATE));
+    params.scale = fmaxf(-NOISE_MAX_COORDINATE, fminf(params.scale, NOISE_MAX_COORDINATE));
+    params.warp = fmaxf(-NOISE_MAX_COORDINATE, fminf(params.warp, NOISE_MAX_COORDINATE));
+
+    // Parameters limited so noise values and coordinates are finite: coordinates in float integer precision,
+    // octaves reduced until last octave frequency keeps coordinates (warp displacement included) in range
+    if (params.octaves > NOISE_MAX_OCTAVES) params.octaves = NOISE_MAX_OCTAVES;
+    if (params.gain > 16.0f) params.gain = 16.0f;
+    else if (params.gain < -16.0f) params.gain = -16.0f;
+    if (params.ridgeOffset > 16.0f) params.ridgeOffset = 16.0f;
+    else if (params.ridgeOffset < -16.0f) params.ridgeOffset = -16.0f;
+
+    double amplitudes = 0.0;      // Warp fields amplitudes sum
+    for (int o = 0; o < params.octaves; o++) amplitudes += pow(fabs(params.gain), o);
+
+    double maxSize = (width > height)? width : height;
+    double coordinate = (maxSize + fabs(params.offset.x) + fabs(params.offset.y) + 8.0)*fabs(params.scale)/((width < height)? width : height);
+    if (coordinate > NOISE_MAX_COORDINATE) params.scale *= (float)(NOISE_MAX_COORDINATE/coordinate);
+    coordinate = fmin(coordinate, NOISE_MAX_COORDINATE);
+    if ((coordinate + fabs(params.warp)*amplitudes) > NOISE_MAX_COORDINATE) params.warp = copysignf((float)((NOISE_MAX_COORDINATE - coordinate)/amplitudes), params.warp);
+    coordinate += fabs(params.warp)*amplitudes;
+
+    while ((params.octaves > 1) && ((coordinate*pow(fabs(params.lacunarity), params.octaves - 1)) > NOISE_MAX_COORDINATE)) params.octaves--;
+
+    float *values = (float *)RL_MALLOC(width*height*sizeof(float));
+
+    NoiseJob job = { .values = values, .width = width, .height = height, .params = params };
+    ParallelFor(height, IMAGE_PARALLEL_MIN_ROWS(width), GenNoiseBatch, &job);
+
+    image.data = values;
+    image.width = width;
+    image.height = height;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R32;
+    image.mipmaps = 1;
 
     return image;
 }
@@ -1241,7 +2420,7 @@ void ImageCrop(Image *image, Rectangle crop)
         }
         */
 
-        RL_FREE(image->data);
+        UnloadImageData(image->data);
         image->data = croppedData;
         image->width = (int)crop.width;
         image->height = (int)crop.height;
@@ -1256,11 +2435,38 @@ void ImageFormat(Image *image, int newFormat)
 
     if ((newFormat != 0) && (image->format != newFormat))
     {
-        if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        // Direct conversion (no float intermediate) when 8 bit per channel is enough precision:
+        // conversions between formats up to 8 bit per channel, from 8 bit per channel formats and to R8G8B8A8
+        bool srcFormat8bit = ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+                              (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+        bool directConversion = (image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB) &&
+            (srcFormat8bit || (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+             ((image->format <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (newFormat <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)));
+
+        if (directConversion)
+        {
+            void *data = RL_MALLOC(GetPixelDataSize(image->width, image->height, newFormat));
+            ConvertPixels(image->data, image->format, data, newFormat, image->width*image->height);
+
+            UnloadImageData(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+            image->data = data;
+            image->format = newFormat;
+
+            // In case original image had mipmaps, generate mipmaps for formatted image
+            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+            if (image->mipmaps > 1)
+            {
+                image->mipmaps = 1;
+            #if defined(SUPPORT_IMAGE_MANIPULATION)
+                if (image->data != NULL) ImageMipmaps(image);
+            #endif
+            }
+        }
+        else if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
             Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+            UnloadImageData(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
             image->data = NULL;
             image->format = newFormat;
 
@@ -1452,10 +2658,80 @@ void ImageFormat(Image *image, int newFormat)
             #endif
             }
         }
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+        else if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) ImageCompress(image, newFormat, 1);
+#endif
         else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
 }
 
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+// Compress image data to GPU compressed format
+// NOTE: Supported formats: DXT1 (RGB, RGBA), DXT3, DXT5, ETC1, ETC2 (RGB, EAC RGBA),
+// quality: 0 (fast), 1 (normal), 2 (best), image mipmaps are also compressed
+void ImageCompress(Image *image, int newFormat, int quality)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be compressed");
+        return;
+    }
+
+    if ((newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB) || (newFormat > PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported for compression");
+        return;
+    }
+
+    if (quality < 0) quality = 0;
+    else if (quality > 2) quality = 2;
+
+    int dataSize = 0;
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++)
+    {
+        dataSize += GetPixelDataSize(width, height, newFormat);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    Color *pixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
+
+    CompressJob job = { 0 };
+    job.pixels = pixels;
+    job.format = newFormat;
+    job.quality = quality;
+    job.width = image->width;
+    job.height = image->height;
+
+    int srcOffset = 0;
+    int dstOffset = 0;
+
+    // Compress every mipmap level, blocks rows are compressed in parallel
+    for (int i = 0; i < image->mipmaps; i++)
+    {
+        ConvertPixelsToRGBA8((unsigned char *)image->data + srcOffset, image->format, (unsigned char *)pixels, job.width*job.height);
+
+        job.output = data + dstOffset;
+        ParallelFor((job.height + 3)/4, IMAGE_PARALLEL_MIN_ROWS(4*job.width), CompressBlocksBatch, &job);
+
+        srcOffset += GetPixelDataSize(job.width, job.height, image->format);
+        dstOffset += GetPixelDataSize(job.width, job.height, newFormat);
+        job.width = (job.width > 1)? job.width/2 : 1;
+        job.height = (job.height > 1)? job.height/2 : 1;
+    }
+
+    RL_FREE(pixels);
+    UnloadImageData(image->data);
+
+    image->data = data;
+    image->format = newFormat;
+}
+#endif
+
 // Create an image from text (default font)
 Image ImageText(const char *text, int fontSize, Color color)
 {
@@ -1485,6 +2761,20 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
 
     // NOTE: Text image is generated at font base size, later scaled to desired font size
     Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);  // WARNING: Module required: rtext
+
+    // Fast path: Font glyphs are alpha coverage masks, they can be scaled and blended directly
+    // into the text image at the desired size, no per-glyph copies or full image resize required
+    if ((font.glyphCount > 0) && (font.glyphs[0].image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA))
+    {
+        Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
+        float scaleFactor = (imSize.y > 0.0f)? textSize.y/imSize.y : 1.0f;
+
+        imText = GenImageColor((int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor), BLANK);
+        ImageDrawTextGlyphs(&imText, font, text, (Vector2){ 0.0f, 0.0f }, fontSize, spacing, tint);
+
+        return imText;
+    }
+
     Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
 
     // Create image to store text
@@ -1527,7 +2817,7 @@ Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Co
 
         // Using nearest-neighbor scaling algorithm for default font
         // TODO: Allow defining the preferred scaling mechanism externally
-        if (font.texture.id == GetFontDefault().texture.id) ImageResizeNN(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
+        if (font.glyphs == GetFontDefault().glyphs) ImageResizeNN(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
         else ImageResize(&imText, (int)(imSize.x*scaleFactor), (int)(imSize.y*scaleFactor));
     }
 #else
@@ -1711,8 +3001,18 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-    Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+        return;
+    }
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+
+    // NOTE: Pixels are copied in image format (no conversion), float and half-float values are kept unchanged
+    int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    const unsigned char *pixels = (const unsigned char *)image->data;
+    unsigned char *output = (unsigned char *)RL_MALLOC(GetPixelDataSize(newWidth, newHeight, image->format));
 
     // EDIT: added +1 to account for an early rounding problem
     int xRatio = (int)((image->width << 16)/newWidth) + 1;
@@ -1726,22 +3026,16 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
             x2 = ((x*xRatio) >> 16);
             y2 = ((y*yRatio) >> 16);
 
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
+            memcpy(output + ((size_t)y*newWidth + x)*bytesPerPixel, pixels + ((size_t)y2*image->width + x2)*bytesPerPixel, bytesPerPixel);
         }
     }
 
-    int format = image->format;
-
-    RL_FREE(image->data);
+    UnloadImageData(image->data);
 
     image->data = output;
     image->width = newWidth;
     image->height = newHeight;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
-
-    UnloadImageColors(pixels);
+    image->mipmaps = 1;
 }
 
 // Resize and image to new size
@@ -1754,25 +3048,33 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
     // Check if we can use a fast path on image scaling
-    // It can be for 8 bit per channel images with 1 to 4 channels per pixel
-    if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    // It can be for 8 bit per channel, half-float and float images with 1 to 4 channels per pixel,
+    // float and half-float images are resized in float precision, no 8 bit per channel intermediate
+    int channels = 0;
+    int type = STBIR_TYPE_UINT8;
+
+    switch (image->format)
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: channels = 1; type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: channels = 3; type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: channels = 4; type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: channels = 1; type = STBIR_TYPE_HALF_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: channels = 3; type = STBIR_TYPE_HALF_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: channels = 4; type = STBIR_TYPE_HALF_FLOAT; break;
+        default: break;
+    }
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+    if (channels > 0)
+    {
+        unsigned char *output = (unsigned char *)RL_MALLOC(GetPixelDataSize(newWidth, newHeight, image->format));
+
+        ResizePixels(image->data, image->width, image->height, output, newWidth, newHeight, channels, type);
 
-        RL_FREE(image->data);
+        UnloadImageData(image->data);
         image->data = output;
         image->width = newWidth;
         image->height = newHeight;
@@ -1784,12 +3086,12 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ResizePixels(pixels, image->width, image->height, output, newWidth, newHeight, 4, STBIR_TYPE_UINT8);
 
         int format = image->format;
 
         UnloadImageColors(pixels);
-        RL_FREE(image->data);
+        UnloadImageData(image->data);
 
         image->data = output;
         image->width = newWidth;
@@ -1860,7 +3162,7 @@ void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, i
             dstOffsetSize += (newWidth*bytesPerPixel);
         }
 
-        RL_FREE(image->data);
+        UnloadImageData(image->data);
         image->data = resizedData;
         image->width = newWidth;
         image->height = newHeight;
@@ -2032,7 +3334,7 @@ void ImageAlphaMask(Image *image, Image alphaMask)
                 data[k + 1] = ((unsigned char *)mask.data)[i];
             }
 
-            RL_FREE(image->data);
+            UnloadImageData(image->data);
             image->data = data;
             image->format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
         }
@@ -2058,33 +3360,9 @@ void ImageAlphaPremultiply(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    float alpha = 0.0f;
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        if (pixels[i].a == 0)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-        }
-        else if (pixels[i].a < 255)
-        {
-            alpha = (float)pixels[i].a/255.0f;
-            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
-            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
-            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
-        }
-    }
-
-    RL_FREE(image->data);
-
-    int format = image->format;
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ColorAdjustJob job = { 0 };
+    job.mode = COLOR_ADJUST_PREMULTIPLY;
+    AdjustImageColors(image, &job);
 }
 
 // Apply box blur to image
@@ -2093,142 +3371,52 @@ void ImageBlurGaussian(Image *image, int blurSize)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    ImageAlphaPremultiply(image);
-
-    Color *pixels = LoadImageColors(*image);
-
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    if (blurSize < 0) blurSize = 0;
 
-    for (int i = 0; i < (image->height*image->width); i++)
-    {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
+    int tiles = (image->width + GAUSSIAN_BLUR_TILE - 1)/GAUSSIAN_BLUR_TILE;
 
     // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
+    if (IsPixelFormatHDR(image->format))
     {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
+        // Float and half-float formats blurred as float RGBA pixels, alpha premultiplied,
+        // using double precision sliding sums, values out of [0..1] range are preserved
+        float *values = (float *)RL_MALLOC((size_t)image->width*image->height*4*sizeof(float));
+        ConvertPixelsToFloat(image->data, image->format, values, image->width*image->height);
 
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
+        BlurJob job = { NULL, image->width, image->height, blurSize, values, NULL };
+        ParallelFor(image->height, IMAGE_PARALLEL_MIN_ROWS(image->width), BlurRowsFloatBatch, &job);
+        ParallelFor(tiles, IMAGE_PARALLEL_MIN_ROWS(GAUSSIAN_BLUR_TILE*image->height), BlurColumnsFloatBatch, &job);
 
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
+        ConvertPixelsFromFloat(values, image->data, image->format, image->width*image->height);
+        RL_FREE(values);
+    }
+    else
+    {
+        Color *pixels = LoadImageColors(*image);
 
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
+        // NOTE: Pixels are blurred with alpha premultiplied in 16 bit per channel, using integer sliding sums,
+        // alpha premultiply is only reverted at the end, window is limited to keep 32 bit sums exact
+        if (blurSize > 32767) blurSize = 32767;
 
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
+        unsigned short *channels = (unsigned short *)RL_MALLOC((size_t)image->width*image->height*4*sizeof(unsigned short));
+        BlurJob job = { pixels, image->width, image->height, blurSize, NULL, channels };
 
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
+        // Horizontal motion blur, row by row
+        ParallelFor(image->height, IMAGE_PARALLEL_MIN_ROWS(image->width), BlurRowsBatch, &job);
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
-    }
+        // Vertical motion blur, by tiles of columns
+        ParallelFor(tiles, IMAGE_PARALLEL_MIN_ROWS(GAUSSIAN_BLUR_TILE*image->height), BlurColumnsBatch, &job);
 
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
-    {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
-    }
+        RL_FREE(channels);
 
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
+        int format = image->format;
+        UnloadImageData(image->data);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image->data = pixels;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-    ImageFormat(image, format);
+        ImageFormat(image, format);
+    }
 }
 
 // Apply custom square convolution kernel to image
@@ -2245,23 +3433,12 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
         return;
     }
 
-    Color *pixels = LoadImageColors(*image);
+    // NOTE: Source pixels loaded in float precision, float and half-float values are not clamped to [0..1] range
+    bool hdr = IsPixelFormatHDR(image->format);
+    Vector4 *source = (Vector4 *)RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
+    ConvertPixelsToFloat(image->data, image->format, (float *)source, image->width*image->height);
 
     Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
-
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
-
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
 
     int startRange = 0, endRange = 0;
 
@@ -2276,89 +3453,39 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
         endRange = kernelWidth/2 + 1;
     }
 
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
+    ConvolutionJob job = { source, imageCopy2, image->width, image->height, kernel, kernelWidth, startRange, endRange, hdr };
+    ParallelFor(image->height, IMAGE_PARALLEL_MIN_ROWS(image->width*kernelSize), ConvolveRowsBatch, &job);
 
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
+    RL_FREE(source);
 
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
+    if (hdr)
+    {
+        // Float and half-float formats stored back directly, no 8 bit per channel round trip
+        ConvertPixelsFromFloat((const float *)imageCopy2, image->data, image->format, image->width*image->height);
+        RL_FREE(imageCopy2);
+    }
+    else
+    {
+        Color *pixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
 
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
+        for (int i = 0; i < (image->width*image->height); i++)
+        {
+            float alpha = (float)imageCopy2[i].w;
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
+            pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
+            pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
+            pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
+            pixels[i].a = (unsigned char)((alpha)*255.0f);
         }
-    }
 
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
+        int format = image->format;
+        UnloadImageData(image->data);
+        RL_FREE(imageCopy2);
 
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
+        image->data = pixels;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        ImageFormat(image, format);
     }
-
-    int format = image->format;
-    RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    ImageFormat(image, format);
 }
 
 // Generate all mipmap levels for a provided image
@@ -2366,6 +3493,15 @@ void ImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 // NOTE 2: image.data is scaled to include mipmap levels
 // NOTE 3: Mipmaps format is the same as base image
 void ImageMipmaps(Image *image)
+{
+    ImageMipmapsEx(image, false, 0.0f);
+}
+
+// Compute all mipmap levels for a provided image, with options
+// NOTE: 8 bit per channel, half-float and float formats are reduced with a 2x2 box filter from previous level,
+// srgb: color channels are filtered in linear space (alpha is always linear), only 8 bit per channel formats,
+// alphaCutoff: alpha test reference value [0.0f..1.0f] to preserve alpha coverage of base level (0.0f: disabled), only 8 bit per channel formats
+void ImageMipmapsEx(Image *image, bool srgb, float alphaCutoff)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2391,23 +3527,103 @@ void ImageMipmaps(Image *image)
         mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
     }
 
-    if (image->mipmaps < mipCount)
+    if (image->mipmaps >= mipCount)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
+        return;
+    }
+
+    // NOTE: All mipmap levels are stored in the same data buffer, after base level
+    void *temp = NULL;
+#if defined(SUPPORT_IMAGE_MAPPING)
+    bool mapped = IsImageDataMapped(image->data);
+#else
+    bool mapped = false;
+#endif
+
+    if (mapped)
+    {
+        // Memory mapped data can not be reallocated, base level is copied
+        temp = RL_MALLOC(mipSize);
+        if (temp != NULL)
+        {
+            memcpy(temp, image->data, GetPixelDataSize(image->width, image->height, image->format));
+            UnloadImageData(image->data);
+        }
+    }
+    else temp = RL_REALLOC(image->data, mipSize);
+
+    if (temp == NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+        return;
+    }
+
+    image->data = temp;
+
+    int channels = 0;
+    int channelSize = 1;
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+    else if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+    else if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+    else if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+    else if (IsPixelFormatHDR(image->format))
     {
-        void *temp = RL_REALLOC(image->data, mipSize);
+        // Float and half-float values are linear, reduced in float precision
+        channelSize = ((image->format == PIXELFORMAT_UNCOMPRESSED_R16) || (image->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
+                       (image->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16))? 2 : 4;
+        channels = GetPixelDataSize(1, 1, image->format)/channelSize;
+    }
 
-        if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+    // Pointer to allocated memory point where store next mipmap level data
+    unsigned char *nextmip = image->data;
 
-        // Pointer to allocated memory point where store next mipmap level data
-        unsigned char *nextmip = image->data;
+    mipWidth = image->width;
+    mipHeight = image->height;
+    mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
 
-        mipWidth = image->width;
-        mipHeight = image->height;
-        mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
+    if (channels > 0)
+    {
+        MipmapJob job = { 0 };
+        job.channels = channels;
+        job.channelSize = channelSize;
+
+        // Conversion tables for linear space filtering: sRGB to linear (16 bit) and linear (12 bit) to sRGB
+        unsigned short *tables = NULL;
+
+        if (srgb && (channelSize == 1))
+        {
+            tables = (unsigned short *)RL_MALLOC((256 + 4096)*sizeof(unsigned short));
+
+            for (int i = 0; i < 256; i++)
+            {
+                float value = (float)i/255.0f;
+                value = (value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f);
+                tables[i] = (unsigned short)(value*65535.0f + 0.5f);
+            }
+
+            for (int i = 0; i < 4096; i++)
+            {
+                float value = (float)i/4095.0f;
+                value = (value <= 0.0031308f)? value*12.92f : 1.055f*powf(value, 1.0f/2.4f) - 0.055f;
+                tables[256 + i] = (unsigned short)(value*255.0f + 0.5f);
+            }
+
+            job.toLinear = tables;
+            job.toSrgb = tables + 256;
+        }
+
+        // Alpha test coverage of base level, preserved on generated levels
+        bool alphaCoverage = ((channels == 2) || (channels == 4)) && (channelSize == 1) && (alphaCutoff > 0.0f);
+        float coverage = 0.0f;
+        if (alphaCoverage) coverage = GetAlphaCoverage(nextmip, mipWidth*mipHeight, channels, alphaCutoff);
 
         for (int i = 1; i < mipCount; i++)
         {
+            job.src = nextmip;
+            job.srcWidth = mipWidth;
+            job.srcHeight = mipHeight;
+
             nextmip += mipSize;
 
             mipWidth /= 2;
@@ -2419,20 +3635,52 @@ void ImageMipmaps(Image *image)
 
             mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
 
-            if (i < image->mipmaps) continue;
+            if (i < image->mipmaps) continue;   // Keep available mipmap levels
 
             TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
 
-            ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
+            // Reduce previous level, rows processed in parallel
+            job.dst = nextmip;
+            job.width = mipWidth;
+            job.height = mipHeight;
+            ParallelFor(mipHeight, IMAGE_PARALLEL_MIN_ROWS(4*mipWidth), (channelSize == 1)? ReduceMipmapRowsBatch : ReduceMipmapRowsFloatBatch, &job);
 
-            memcpy(nextmip, imCopy.data, mipSize);
+            if (alphaCoverage) ScaleAlphaCoverage(nextmip, mipWidth*mipHeight, channels, alphaCutoff, coverage);
         }
 
-        UnloadImage(imCopy);
-
-        image->mipmaps = mipCount;
+        RL_FREE(tables);
     }
-    else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
+    else
+    {
+        // Other formats: every level resized from base level copy
+        Image imCopy = ImageCopy(*image);
+
+        for (int i = 1; i < mipCount; i++)
+        {
+            nextmip += mipSize;
+
+            mipWidth /= 2;
+            mipHeight /= 2;
+
+            // Security check for NPOT textures
+            if (mipWidth < 1) mipWidth = 1;
+            if (mipHeight < 1) mipHeight = 1;
+
+            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+
+            if (i < image->mipmaps) continue;
+
+            TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
+
+            ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
+
+            memcpy(nextmip, imCopy.data, mipSize);
+        }
+
+        UnloadImage(imCopy);
+    }
+
+    image->mipmaps = mipCount;
 }
 
 // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
@@ -2457,7 +3705,7 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     {
         Color *pixels = LoadImageColors(*image);
 
-        RL_FREE(image->data);      // free old image data
+        UnloadImageData(image->data);      // free old image data
 
         if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
         {
@@ -2547,6 +3795,46 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     }
 }
 
+// Quantize image colors to a palette of colorCount colors (median cut), optional Floyd-Steinberg dithering
+// NOTE: Image format is kept, fully transparent pixels are not modified, colorCount limited to [2..256]
+void ImageQuantize(Image *image, int colorCount, bool dither)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be quantized");
+        return;
+    }
+
+    if (colorCount < 2) colorCount = 2;
+    if (colorCount > 256) colorCount = 256;
+
+    int pixelCount = image->width*image->height;
+    Color *pixels = LoadImageColors(*image);
+    Color palette[256] = { 0 };
+
+    // Images with less colors than required keep exact colors
+    int paletteSize = GetPaletteExact(pixels, pixelCount, palette, colorCount);
+
+    if (paletteSize < 0)
+    {
+        paletteSize = GenPaletteMedianCut(pixels, pixelCount, palette, colorCount);
+
+        unsigned char *indices = (unsigned char *)RL_MALLOC(pixelCount);
+        MapPaletteIndices(pixels, image->width, image->height, palette, paletteSize, dither, true, indices);
+
+        for (int i = 0; i < pixelCount; i++) if (pixels[i].a > 0) pixels[i] = palette[indices[i]];
+
+        ConvertPixelsFromRGBA8((unsigned char *)pixels, image->data, image->format, pixelCount);
+
+        RL_FREE(indices);
+    }
+
+    UnloadImageColors(pixels);
+}
+
 // Flip image vertically
 void ImageFlipVertical(Image *image)
 {
@@ -2566,7 +3854,7 @@ void ImageFlipVertical(Image *image)
             offsetSize += image->width*bytesPerPixel;
         }
 
-        RL_FREE(image->data);
+        UnloadImageData(image->data);
         image->data = flippedData;
     }
 }
@@ -2596,7 +3884,7 @@ void ImageFlipHorizontal(Image *image)
             }
         }
 
-        RL_FREE(image->data);
+        UnloadImageData(image->data);
         image->data = flippedData;
 
         /*
@@ -2636,39 +3924,10 @@ void ImageRotate(Image *image, int degrees)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
 
-        for (int y = 0; y < height; y++)
-        {
-            for (int x = 0; x < width; x++)
-            {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
-
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
-                {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = MIN(x1 + 1, image->width - 1);
-                    int y2 = MIN(y1 + 1, image->height - 1);
-
-                    float px = oldX - x1;
-                    float py = oldY - y1;
-
-                    for (int i = 0; i < bytesPerPixel; i++)
-                    {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
-
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
-
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
-                    }
-                }
-            }
-        }
+        RotateJob job = { image->data, rotatedData, image->width, image->height, width, height, bytesPerPixel, sinRadius, cosRadius };
+        ParallelFor(height, IMAGE_PARALLEL_MIN_ROWS(width), RotateRowsBatch, &job);
 
-        RL_FREE(image->data);
+        UnloadImageData(image->data);
         image->data = rotatedData;
         image->width = width;
         image->height = height;
@@ -2697,7 +3956,7 @@ void ImageRotateCW(Image *image)
             }
         }
 
-        RL_FREE(image->data);
+        UnloadImageData(image->data);
         image->data = rotatedData;
         int width = image->width;
         int height = image-> height;
@@ -2729,7 +3988,7 @@ void ImageRotateCCW(Image *image)
             }
         }
 
-        RL_FREE(image->data);
+        UnloadImageData(image->data);
         image->data = rotatedData;
         int width = image->width;
         int height = image-> height;
@@ -2745,28 +4004,10 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
-        unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
-        unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
-        unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
-
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ColorAdjustJob job = { 0 };
+    job.mode = COLOR_ADJUST_TINT;
+    job.color = color;
+    AdjustImageColors(image, &job);
 }
 
 // Modify image color: invert
@@ -2775,28 +4016,25 @@ void ImageColorInvert(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        pixels[i].r = 255 - pixels[i].r;
-        pixels[i].g = 255 - pixels[i].g;
-        pixels[i].b = 255 - pixels[i].b;
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ColorAdjustJob job = { 0 };
+    job.mode = COLOR_ADJUST_INVERT;
+    AdjustImageColors(image, &job);
 }
 
 // Modify image color: grayscale
+// NOTE: Float and half-float images are converted to one channel of same precision (values not clamped)
 void ImageColorGrayscale(Image *image)
 {
-    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R32); break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R16); break;
+        default: ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE); break;
+    }
 }
 
 // Modify image color: contrast
@@ -2812,46 +4050,10 @@ void ImageColorContrast(Image *image, float contrast)
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
-
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
-
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
-    }
-
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    ColorAdjustJob job = { 0 };
+    job.mode = COLOR_ADJUST_CONTRAST;
+    job.contrast = contrast;
+    AdjustImageColors(image, &job);
 }
 
 // Modify image color: brightness
@@ -2864,265 +4066,442 @@ void ImageColorBrightness(Image *image, int brightness)
     if (brightness < -255) brightness = -255;
     if (brightness > 255) brightness = 255;
 
-    Color *pixels = LoadImageColors(*image);
-
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
-
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
+    ColorAdjustJob job = { 0 };
+    job.mode = COLOR_ADJUST_BRIGHTNESS;
+    job.brightness = brightness;
+    AdjustImageColors(image, &job);
+}
 
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
+// Modify image color: replace color
+void ImageColorReplace(Image *image, Color color, Color replace)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
+    ColorAdjustJob job = { 0 };
+    job.mode = COLOR_ADJUST_REPLACE;
+    job.color = color;
+    job.replace = replace;
+    AdjustImageColors(image, &job);
+}
 
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
-    }
+// Load image operations pipeline for source image
+// NOTE: Source image is not copied, it must be valid until pipeline is applied with LoadImageFromPipeline()
+ImagePipeline LoadImagePipeline(Image image)
+{
+    ImagePipeline pipeline = { 0 };
 
-    int format = image->format;
-    RL_FREE(image->data);
+    pipeline.image = image;
+    pipeline.width = image.width;
+    pipeline.height = image.height;
+    pipeline.format = image.format;
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    return pipeline;
+}
 
-    ImageFormat(image, format);
+// Unload image operations pipeline, source image is not unloaded
+void UnloadImagePipeline(ImagePipeline pipeline)
+{
+    RL_FREE(pipeline.operations);
 }
 
-// Modify image color: replace color
-void ImageColorReplace(Image *image, Color color, Color replace)
+// Load image applying pipeline recorded operations
+// NOTE: Operations are fused in a single pass over source region, processed by spans of rows in parallel:
+// crop operations select the source region read (or resized region kept), consecutive resizes are composed in a
+// single resampling, color operations are applied on pixels spans as they are read (before first resize) or resampled,
+// output is written once, same results as applying operations one by one with image functions (except for composed resizes),
+// pipelines with float or half-float formats (or compressed formats not as last operation) apply operations one by one
+Image LoadImageFromPipeline(ImagePipeline pipeline)
 {
+    Image image = { 0 };
+    Image source = pipeline.image;
+    const rImageOperation *operations = pipeline.operations;
+    int count = pipeline.operationCount;
+
     // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((source.data == NULL) || (source.width == 0) || (source.height == 0)) return image;
 
-    Color *pixels = LoadImageColors(*image);
+    if (source.mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
+
+    // Check if operations can be fused, pixels are processed as R8G8B8A8 (quantized to current format after every operation)
+    bool fused = (source.format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && !IsPixelFormatHDR(source.format);
 
-    for (int i = 0; i < image->width*image->height; i++)
+    for (int i = 0; fused && (i < count); i++)
     {
-        if ((pixels[i].r == color.r) &&
-            (pixels[i].g == color.g) &&
-            (pixels[i].b == color.b) &&
-            (pixels[i].a == color.a))
+        if (operations[i].type == IMAGE_OPERATION_FORMAT)
         {
-            pixels[i].r = replace.r;
-            pixels[i].g = replace.g;
-            pixels[i].b = replace.b;
-            pixels[i].a = replace.a;
+            if (IsPixelFormatHDR(operations[i].format)) fused = false;
+            else if ((operations[i].format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (i < (count - 1))) fused = false;
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    if (!fused)
+    {
+        image = ImageCopy(source);
 
-    ImageFormat(image, format);
-}
-#endif      // SUPPORT_IMAGE_MANIPULATION
+        for (int i = 0; i < count; i++)
+        {
+            const rImageOperation *operation = &operations[i];
 
-// Load color data from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImageColors();
-Color *LoadImageColors(Image image)
-{
-    if ((image.width == 0) || (image.height == 0)) return NULL;
+            switch (operation->type)
+            {
+                case IMAGE_OPERATION_CROP: ImageCrop(&image, (Rectangle){ (float)operation->x, (float)operation->y, (float)operation->width, (float)operation->height }); break;
+                case IMAGE_OPERATION_RESIZE: ImageResize(&image, operation->width, operation->height); break;
+                case IMAGE_OPERATION_FORMAT: ImageFormat(&image, operation->format); break;
+                case IMAGE_OPERATION_COLOR:
+                {
+                    ColorAdjustJob job = operation->color;
+                    if (image.data != NULL) AdjustImageColors(&image, &job);
+                } break;
+                default: break;
+            }
+        }
 
-    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
+        return image;
+    }
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    // Compose geometry operations: source region read, resampled to resize size, resized region kept
+    int regionX = 0;                        // Source region read (crops before first resize)
+    int regionY = 0;
+    int regionWidth = source.width;
+    int regionHeight = source.height;
+    double s0 = 0.0, t0 = 0.0, s1 = 1.0, t1 = 1.0; // Source region resampled (normalized, consecutive resizes)
+    int resizeWidth = 0;                    // Resampled image size
+    int resizeHeight = 0;
+    int subX = 0;                           // Resampled image region kept (crops after resize)
+    int subY = 0;
+    int width = source.width;               // Current image size
+    int height = source.height;
+    int format = source.format;             // Current uncompressed format
+    int resizeFormat = source.format;       // Format at first resize
+    int compressedFormat = 0;               // Compressed format (last operation)
+    int firstResize = -1;
+    bool preColors = false;                 // Color or format operations before first resize
+    bool postColors = false;                // Color or format operations after first resize
+
+    for (int i = 0; i < count; i++)
     {
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+        const rImageOperation *operation = &operations[i];
 
-        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
-
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        switch (operation->type)
         {
-            switch (image.format)
+            case IMAGE_OPERATION_CROP:
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                if (firstResize < 0)
                 {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                    regionX += operation->x;
+                    regionY += operation->y;
+                    regionWidth = operation->width;
+                    regionHeight = operation->height;
+                }
+                else
                 {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+                    subX += operation->x;
+                    subY += operation->y;
+                }
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                width = operation->width;
+                height = operation->height;
+            } break;
+            case IMAGE_OPERATION_RESIZE:
+            {
+                if (firstResize < 0)
                 {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+                    firstResize = i;
+                    resizeFormat = format;
+                }
+                else
+                {
+                    // Kept region of previous resize is resampled directly from source region
+                    double ds = s1 - s0;
+                    double dt = t1 - t0;
+
+                    s0 += ds*subX/resizeWidth;
+                    t0 += dt*subY/resizeHeight;
+                    s1 = s0 + ds*width/resizeWidth;
+                    t1 = t0 + dt*height/resizeHeight;
+                }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                resizeWidth = operation->width;
+                resizeHeight = operation->height;
+                subX = 0;
+                subY = 0;
+                width = operation->width;
+                height = operation->height;
+            } break;
+            case IMAGE_OPERATION_FORMAT:
+            {
+                if (operation->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) compressedFormat = operation->format;
+                else
                 {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+                    format = operation->format;
+                    if (firstResize < 0) preColors = true;
+                    else postColors = true;
+                }
+            } break;
+            case IMAGE_OPERATION_COLOR:
+            {
+                if (firstResize < 0) preColors = true;
+                else postColors = true;
+            } break;
+            default: break;
+        }
+    }
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
+    image.data = RL_MALLOC(GetPixelDataSize(width, height, format));
+    image.width = width;
+    image.height = height;
+    image.mipmaps = 1;
+    image.format = format;
+
+    ImagePipelineJob job = { 0 };
+    job.source = (const unsigned char *)source.data;
+    job.sourceWidth = source.width;
+    job.sourceFormat = source.format;
+    job.offsetX = regionX;
+    job.offsetY = regionY;
+    job.operations = operations;
+    job.preCount = (firstResize < 0)? count : firstResize;
+    job.postStart = firstResize + 1;
+    job.postEnd = count;
+    job.preColors = preColors;
+    job.postColors = postColors;
+    job.resizeFormat = resizeFormat;
+    job.output = (unsigned char *)image.data;
+    job.outputWidth = width;
+    job.outputHeight = height;
+    job.outputFormat = format;
+
+    if (firstResize < 0) ParallelFor(height, IMAGE_PARALLEL_MIN_ROWS(width), EvaluatePipelineRowsBatch, &job);
+    else
+    {
+        // Resampled with stbir as image resize does, 8 bit per channel formats resampled directly,
+        // other formats (or R8G8B8A8 with pre stage operations) read by input callback converted to R8G8B8A8,
+        // resampled rows written by output callback
+        int channels = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+        switch (resizeFormat)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+            default: break;
+        }
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+        int sourcePitch = source.width*GetPixelDataSize(1, 1, source.format);
+        const unsigned char *input = job.source + regionY*sourcePitch + regionX*GetPixelDataSize(1, 1, source.format);
+        unsigned char *region = NULL;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+        if (preColors && (channels > 0) && (channels < 4))
+        {
+            // WARNING: stbir decodes input callback rows in place, less than 4 channels rows could be overwritten,
+            // pre stage is applied to source region in a separate pass
+            ImagePipelineJob regionJob = job;
+            region = (unsigned char *)RL_MALLOC(GetPixelDataSize(regionWidth, regionHeight, resizeFormat));
+            regionJob.output = region;
+            regionJob.outputWidth = regionWidth;
+            regionJob.outputFormat = resizeFormat;
+            ParallelFor(regionHeight, IMAGE_PARALLEL_MIN_ROWS(regionWidth), EvaluatePipelineRowsBatch, &regionJob);
+
+            input = region;
+            sourcePitch = regionWidth*channels;
+        }
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
+        bool readSource = (channels > 0) && (!preColors || (region != NULL));
+        job.resizeLayout = readSource? resizeFormat : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        if (!readSource) channels = 4;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+        STBIR_RESIZE resize = { 0 };
+        stbir_resize_init(&resize, input, regionWidth, regionHeight, sourcePitch, image.data, resizeWidth, resizeHeight, 0, (stbir_pixel_layout)channels, STBIR_TYPE_UINT8);
+        stbir_set_pixel_callbacks(&resize, readSource? NULL : ReadPipelineRow, WritePipelineRow);
+        stbir_set_user_data(&resize, &job);
 
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
+        // NOTE: Full resampled rows are produced, output callback only writes kept region (crops after resize),
+        // stbir output subrects are not used, filtering would not match image resize and upsampling is not supported
+        stbir_set_input_subrect(&resize, s0, t0, s1, t1);
+        job.outputOffsetX = subX;
+        job.outputOffsetY = subY;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k + 3]*255.0f);
+        ResizeExtended(&resize, width*height);
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+        RL_FREE(region);
+    }
 
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
+    if (compressedFormat != 0) ImageFormat(&image, compressedFormat);
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 3])*255.0f);
+    return image;
+}
 
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
+// Record image operation: crop
+void ImagePipelineCrop(ImagePipeline *pipeline, Rectangle crop)
+{
+    // Security checks to validate crop rectangle, same as ImageCrop()
+    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
+    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
+    if ((crop.x + crop.width) > pipeline->width) crop.width = pipeline->width - crop.x;
+    if ((crop.y + crop.height) > pipeline->height) crop.height = pipeline->height - crop.y;
+    if ((crop.x > pipeline->width) || (crop.y > pipeline->height) || ((int)crop.width <= 0) || ((int)crop.height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to crop, rectangle out of bounds");
+        return;
     }
 
-    return pixels;
+    rImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_CROP;
+    operation.x = (int)crop.x;
+    operation.y = (int)crop.y;
+    operation.width = (int)crop.width;
+    operation.height = (int)crop.height;
+    AddImageOperation(pipeline, operation);
 }
 
-// Load colors palette from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImagePalette()
-Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
+// Record image operation: resize
+void ImagePipelineResize(ImagePipeline *pipeline, int newWidth, int newHeight)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+    if ((newWidth <= 0) || (newHeight <= 0)) return;
 
-    int palCount = 0;
-    Color *palette = NULL;
-    Color *pixels = LoadImageColors(image);
+    rImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_RESIZE;
+    operation.width = newWidth;
+    operation.height = newHeight;
+    AddImageOperation(pipeline, operation);
+}
 
-    if (pixels != NULL)
-    {
-        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+// Record image operation: convert to format
+void ImagePipelineFormat(ImagePipeline *pipeline, int newFormat)
+{
+    if ((newFormat == 0) || (newFormat == pipeline->format)) return;
 
-        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+    rImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_FORMAT;
+    operation.format = newFormat;
+    AddImageOperation(pipeline, operation);
+}
 
-        for (int i = 0; i < image.width*image.height; i++)
-        {
-            if (pixels[i].a > 0)
-            {
-                bool colorInPalette = false;
+// Record image operation: premultiply alpha channel
+void ImagePipelineAlphaPremultiply(ImagePipeline *pipeline)
+{
+    rImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR;
+    operation.color.mode = COLOR_ADJUST_PREMULTIPLY;
+    AddImageOperation(pipeline, operation);
+}
 
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
-                {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
-                    {
-                        colorInPalette = true;
-                        break;
-                    }
-                }
+// Record image operation: color tint
+void ImagePipelineColorTint(ImagePipeline *pipeline, Color color)
+{
+    rImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR;
+    operation.color.mode = COLOR_ADJUST_TINT;
+    operation.color.color = color;
+    AddImageOperation(pipeline, operation);
+}
 
-                // Store color if not on the palette
-                if (!colorInPalette)
-                {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
+// Record image operation: color invert
+void ImagePipelineColorInvert(ImagePipeline *pipeline)
+{
+    rImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR;
+    operation.color.mode = COLOR_ADJUST_INVERT;
+    AddImageOperation(pipeline, operation);
+}
 
-                    // We reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
-                    {
-                        i = image.width*image.height;   // Finish palette get
-                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
-                    }
-                }
-            }
+// Record image operation: color grayscale
+void ImagePipelineColorGrayscale(ImagePipeline *pipeline)
+{
+    ImagePipelineFormat(pipeline, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+}
+
+// Record image operation: color contrast
+// NOTE: Contrast values between -100 and 100
+void ImagePipelineColorContrast(ImagePipeline *pipeline, float contrast)
+{
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+
+    contrast = (100.0f + contrast)/100.0f;
+    contrast *= contrast;
+
+    rImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR;
+    operation.color.mode = COLOR_ADJUST_CONTRAST;
+    operation.color.contrast = contrast;
+    AddImageOperation(pipeline, operation);
+}
+
+// Record image operation: color brightness
+// NOTE: Brightness values between -255 and 255
+void ImagePipelineColorBrightness(ImagePipeline *pipeline, int brightness)
+{
+    if (brightness < -255) brightness = -255;
+    if (brightness > 255) brightness = 255;
+
+    rImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR;
+    operation.color.mode = COLOR_ADJUST_BRIGHTNESS;
+    operation.color.brightness = brightness;
+    AddImageOperation(pipeline, operation);
+}
+
+// Record image operation: replace color
+void ImagePipelineColorReplace(ImagePipeline *pipeline, Color color, Color replace)
+{
+    rImageOperation operation = { 0 };
+    operation.type = IMAGE_OPERATION_COLOR;
+    operation.color.mode = COLOR_ADJUST_REPLACE;
+    operation.color.color = color;
+    operation.color.replace = replace;
+    AddImageOperation(pipeline, operation);
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+// Load color data from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImageColors();
+Color *LoadImageColors(Image image)
+{
+    if ((image.width == 0) || (image.height == 0)) return NULL;
+
+    Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R16) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
+
+        ConvertPixelsToRGBA8(image.data, image.format, (unsigned char *)pixels, image.width*image.height);
+    }
+
+    return pixels;
+}
+
+// Load colors palette from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImagePalette()
+Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
+{
+    int palCount = 0;
+    Color *palette = NULL;
+    Color *pixels = (maxPaletteSize > 0)? LoadImageColors(image) : NULL;
+
+    if (pixels != NULL)
+    {
+        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+
+        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+
+        // Exact colors (translucent pixels only), reduced with median cut if palette is greater than maxPaletteSize
+        palCount = GetPaletteExact(pixels, image.width*image.height, palette, maxPaletteSize);
+
+        if (palCount < 0)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors, reduced with median cut", maxPaletteSize);
+            palCount = GenPaletteMedianCut(pixels, image.width*image.height, palette, maxPaletteSize);
         }
 
         UnloadImageColors(pixels);
@@ -3145,6 +4524,36 @@ void UnloadImagePalette(Color *colors)
     RL_FREE(colors);
 }
 
+// Load palette indices from image, every pixel mapped to nearest palette color (RGBA distance)
+// NOTE: Palette is limited to 256 colors, optional Floyd-Steinberg dithering
+unsigned char *LoadImagePaletteIndices(Image image, const Color *palette, int paletteSize, bool dither)
+{
+    if ((palette == NULL) || (paletteSize <= 0) || (paletteSize > 256))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Palette not valid, 1 to 256 colors supported");
+        return NULL;
+    }
+
+    unsigned char *indices = NULL;
+    Color *pixels = LoadImageColors(image);
+
+    if (pixels != NULL)
+    {
+        indices = (unsigned char *)RL_MALLOC(image.width*image.height);
+        MapPaletteIndices(pixels, image.width, image.height, palette, paletteSize, dither, false, indices);
+
+        UnloadImageColors(pixels);
+    }
+
+    return indices;
+}
+
+// Unload palette indices loaded with LoadImagePaletteIndices()
+void UnloadImagePaletteIndices(unsigned char *indices)
+{
+    RL_FREE(indices);
+}
+
 // Get image alpha border rectangle
 // NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
 Rectangle GetImageAlphaBorder(Image image, float threshold)
@@ -3193,120 +4602,13 @@ Color GetImageColor(Image image, int x, int y)
 
     if ((x >=0) && (x < image.width) && (y >= 0) && (y < image.height))
     {
-        switch (image.format)
+        // NOTE: Pixel is converted the same way as LoadImageColors()
+        if (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)
         {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-            {
-                color.r = ((unsigned char *)image.data)[y*image.width + x];
-                color.g = ((unsigned char *)image.data)[y*image.width + x];
-                color.b = ((unsigned char *)image.data)[y*image.width + x];
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-            {
-                color.r = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.g = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.b = ((unsigned char *)image.data)[(y*image.width + x)*2];
-                color.a = ((unsigned char *)image.data)[(y*image.width + x)*2 + 1];
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                color.g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                color.b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                color.a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                color.g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                color.b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-            {
-                unsigned short pixel = ((unsigned short *)image.data)[y*image.width + x];
-
-                color.r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                color.g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                color.b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                color.a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-            {
-                color.r = ((unsigned char *)image.data)[(y*image.width + x)*4];
-                color.g = ((unsigned char *)image.data)[(y*image.width + x)*4 + 1];
-                color.b = ((unsigned char *)image.data)[(y*image.width + x)*4 + 2];
-                color.a = ((unsigned char *)image.data)[(y*image.width + x)*4 + 3];
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-            {
-                color.r = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3];
-                color.g = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 1];
-                color.b = (unsigned char)((unsigned char *)image.data)[(y*image.width + x)*3 + 2];
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[y*image.width + x]*255.0f);
-                color.g = 0;
-                color.b = 0;
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*3]*255.0f);
-                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 1]*255.0f);
-                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*3 + 2]*255.0f);
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-            {
-                color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.a = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16:
-            {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[y*image.width + x])*255.0f);
-                color.g = 0;
-                color.b = 0;
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-            {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 1])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 2])*255.0f);
-                color.a = 255;
-
-            } break;
-            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-            {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-
-            } break;
-            default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
+            int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+            ConvertPixelsToRGBA8((unsigned char *)image.data + ((size_t)y*image.width + x)*bytesPerPixel, image.format, (unsigned char *)&color, 1);
         }
+        else TRACELOG(LOG_WARNING, "Compressed image format does not support color reading");
     }
     else TRACELOG(LOG_WARNING, "Requested image pixel (%i, %i) out of bounds", x, y);
 
@@ -3322,17 +4624,13 @@ void ImageClearBackground(Image *dst, Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    // Fill in first pixel based on image format
-    ImageDrawPixel(dst, 0, 0, color);
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) return;
 
-    unsigned char *pSrcPixel = (unsigned char *)dst->data;
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    // Get pixel data based on image format and repeat it throughout the image
+    unsigned char pixel[16] = { 0 };
+    GetPixelColorData(color, dst->format, pixel);
 
-    // Repeat the first pixel data throughout the image
-    for (int i = 1; i < dst->width*dst->height; i++)
-    {
-        memcpy(pSrcPixel + i*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
+    FillPixelsSpan((unsigned char *)dst->data, pixel, GetPixelDataSize(1, 1, dst->format), dst->width*dst->height);
 }
 
 // Draw pixel within an image
@@ -3514,24 +4812,23 @@ void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int en
     // Calculate fixed-point increment for shorter length
     int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
 
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return;
+
+    // Get pixel data based on image format, copied to every line pixel
+    unsigned char pixel[16] = { 0 };
+    GetPixelColorData(color, dst->format, pixel);
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    unsigned char *pixels = (unsigned char *)dst->data;
+
     // Draw the line pixel by pixel
-    if (yLonger)
-    {
-        // If line is more vertical, iterate over y-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
-        {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + (j >> 16), startPosY + i, color);
-        }
-    }
-    else
+    for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
     {
-        // If line is more horizontal, iterate over x-axis
-        for (int i = 0, j = 0; i != endVal; i += sgnInc, j += decInc)
-        {
-            // Calculate pixel position and draw it
-            ImageDrawPixel(dst, startPosX + i, startPosY + (j >> 16), color);
-        }
+        // Calculate pixel position: iterate over y-axis if line is more vertical, x-axis otherwise
+        int x = yLonger? (startPosX + (j >> 16)) : (startPosX + i);
+        int y = yLonger? (startPosY + i) : (startPosY + (j >> 16));
+
+        if ((x >= 0) && (x < dst->width) && (y >= 0) && (y < dst->height)) memcpy(pixels + ((size_t)y*dst->width + x)*bytesPerPixel, pixel, bytesPerPixel);
     }
 }
 
@@ -3596,16 +4893,35 @@ void ImageDrawLineEx(Image *dst, Vector2 start, Vector2 end, int thick, Color co
 // Draw circle within an image
 void ImageDrawCircle(Image* dst, int centerX, int centerY, int radius, Color color)
 {
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) || (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return;
+
+    // Get pixel data based on image format, filled in circle scanlines spans
+    unsigned char pixel[16] = { 0 };
+    GetPixelColorData(color, dst->format, pixel);
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
     while (y >= x)
     {
-        ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
-        ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
+        // Scanlines spans: [centerX - x, centerX + x) at rows centerY +/- y, [centerX - y, centerX + y) at rows centerY +/- x
+        int spans[4][3] = {
+            { centerY + y, centerX - x, x*2 }, { centerY - y, centerX - x, x*2 },
+            { centerY + x, centerX - y, y*2 }, { centerY - x, centerX - y, y*2 }
+        };
+
+        for (int i = 0; i < 4; i++)
+        {
+            int row = spans[i][0];
+            int start = (spans[i][1] < 0)? 0 : spans[i][1];
+            int end = ((spans[i][1] + spans[i][2]) > dst->width)? dst->width : (spans[i][1] + spans[i][2]);
+
+            if ((row >= 0) && (row < dst->height) && (end > start)) FillPixelsSpan((unsigned char *)dst->data + ((size_t)row*dst->width + start)*bytesPerPixel, pixel, bytesPerPixel, end - start);
+        }
+
         x++;
 
         if (decesionParameter > 0)
@@ -3630,16 +4946,29 @@ void ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Colo
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return;
+
+    // Get pixel data based on image format, copied to every outline pixel
+    unsigned char pixel[16] = { 0 };
+    GetPixelColorData(color, dst->format, pixel);
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+
     while (y >= x)
     {
-        ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        int points[8][2] = {
+            { centerX + x, centerY + y }, { centerX - x, centerY + y }, { centerX + x, centerY - y }, { centerX - x, centerY - y },
+            { centerX + y, centerY + x }, { centerX - y, centerY + x }, { centerX + y, centerY - x }, { centerX - y, centerY - x }
+        };
+
+        for (int i = 0; i < 8; i++)
+        {
+            if ((points[i][0] >= 0) && (points[i][0] < dst->width) && (points[i][1] >= 0) && (points[i][1] < dst->height))
+            {
+                memcpy((unsigned char *)dst->data + ((size_t)points[i][1]*dst->width + points[i][0])*bytesPerPixel, pixel, bytesPerPixel);
+            }
+        }
+
         x++;
 
         if (decesionParameter > 0)
@@ -3692,19 +5021,18 @@ void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
     int sy = (int)rec.y;
     int sx = (int)rec.x;
 
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) return;
+
     int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
 
-    // Fill in the first pixel of the first row based on image format
-    ImageDrawPixel(dst, sx, sy, color);
+    // Fill in the first row based on image format
+    unsigned char pixel[16] = { 0 };
+    GetPixelColorData(color, dst->format, pixel);
 
     int bytesOffset = ((sy*dst->width) + sx)*bytesPerPixel;
     unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
 
-    // Repeat the first pixel data throughout the row
-    for (int x = 1; x < (int)rec.width; x++)
-    {
-        memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
+    FillPixelsSpan(pSrcPixel, pixel, bytesPerPixel, (int)rec.width);
 
     // Repeat the first row data for all other rows
     int bytesPerRow = bytesPerPixel*(int)rec.width;
@@ -3763,25 +5091,26 @@ void ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color col
     int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
     int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
 
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return;
+
+    // Get pixel data based on image format, filled in triangle scanlines spans
+    unsigned char pixel[16] = { 0 };
+    GetPixelColorData(color, dst->format, pixel);
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+
     // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
+    // Iterate through each row in the bounding box, pixels inside the triangle (barycentric coordinates >= 0) form a span
+    for (int y = yMin; (y <= yMax) && (y < dst->height); y++)
     {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+        int start = 0;
+        int end = ((xMax < dst->width)? xMax : (dst->width - 1)) - xMin;
 
-        for (int x = xMin; x <= xMax; x++)
-        {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            // If it is then we can draw the pixel with the given color
-            if ((w1 | w2 | w3) >= 0) ImageDrawPixel(dst, x, y, color);
+        GetEdgeSpan(w1Row, w1XStep, &start, &end);
+        GetEdgeSpan(w2Row, w2XStep, &start, &end);
+        GetEdgeSpan(w3Row, w3XStep, &start, &end);
 
-            // Increment the barycentric coordinates for the next pixel
-            w1 += w1XStep;
-            w2 += w2XStep;
-            w3 += w3XStep;
-        }
+        if (end >= start) FillPixelsSpan((unsigned char *)dst->data + ((size_t)y*dst->width + xMin + start)*bytesPerPixel, pixel, bytesPerPixel, end - start + 1);
 
         // Move to the next row in the bounding box
         w1Row += w1YStep;
@@ -3830,6 +5159,9 @@ void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c
     int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
     int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
 
+    // Security check to avoid program crash
+    if (dst->data == NULL) return;
+
     // Calculate the inverse of the sum of the barycentric coordinates for normalization
     // NOTE 1: Here, we act as if we multiply by 255 the reciprocal, which avoids additional
     //         calculations in the loop. This is acceptable because we are only interpolating colors.
@@ -3837,33 +5169,37 @@ void ImageDrawTriangleEx(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color c
     float wInvSum = 255.0f/(w1Row + w2Row + w3Row);
 
     // Rasterization loop
-    // Iterate through each pixel in the bounding box
-    for (int y = yMin; y <= yMax; y++)
+    // Iterate through each row in the bounding box, pixels inside the triangle (barycentric coordinates >= 0) form a span
+    for (int y = yMin; (y <= yMax) && (y < dst->height); y++)
     {
-        int w1 = w1Row;
-        int w2 = w2Row;
-        int w3 = w3Row;
+        int start = 0;
+        int end = ((xMax < dst->width)? xMax : (dst->width - 1)) - xMin;
 
-        for (int x = xMin; x <= xMax; x++)
-        {
-            // Check if the pixel is inside the triangle using barycentric coordinates
-            if ((w1 | w2 | w3) >= 0)
-            {
-                // Compute the normalized barycentric coordinates
-                unsigned char aW1 = (unsigned char)((float)w1*wInvSum);
-                unsigned char aW2 = (unsigned char)((float)w2*wInvSum);
-                unsigned char aW3 = (unsigned char)((float)w3*wInvSum);
+        GetEdgeSpan(w1Row, w1XStep, &start, &end);
+        GetEdgeSpan(w2Row, w2XStep, &start, &end);
+        GetEdgeSpan(w3Row, w3XStep, &start, &end);
 
-                // Interpolate the color using the barycentric coordinates
-                Color finalColor = { 0 };
-                finalColor.r = (c1.r*aW1 + c2.r*aW2 + c3.r*aW3)/255;
-                finalColor.g = (c1.g*aW1 + c2.g*aW2 + c3.g*aW3)/255;
-                finalColor.b = (c1.b*aW1 + c2.b*aW2 + c3.b*aW3)/255;
-                finalColor.a = (c1.a*aW1 + c2.a*aW2 + c3.a*aW3)/255;
+        int w1 = w1Row + start*w1XStep;
+        int w2 = w2Row + start*w2XStep;
+        int w3 = w3Row + start*w3XStep;
 
-                // Draw the pixel with the interpolated color
-                ImageDrawPixel(dst, x, y, finalColor);
-            }
+        for (int x = xMin + start; x <= (xMin + end); x++)
+        {
+            // Compute the normalized barycentric coordinates
+            unsigned char aW1 = (unsigned char)((float)w1*wInvSum);
+            unsigned char aW2 = (unsigned char)((float)w2*wInvSum);
+            unsigned char aW3 = (unsigned char)((float)w3*wInvSum);
+
+            // Interpolate the color using the barycentric coordinates
+            Color finalColor = { 0 };
+            finalColor.r = (c1.r*aW1 + c2.r*aW2 + c3.r*aW3)/255;
+            finalColor.g = (c1.g*aW1 + c2.g*aW2 + c3.g*aW3)/255;
+            finalColor.b = (c1.b*aW1 + c2.b*aW2 + c3.b*aW3)/255;
+            finalColor.a = (c1.a*aW1 + c2.a*aW2 + c3.a*aW3)/255;
+
+            // Draw the pixel with the interpolated color
+            if (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ((Color *)dst->data)[(size_t)y*dst->width + x] = finalColor;
+            else ImageDrawPixel(dst, x, y, finalColor);
 
             // Increment the barycentric coordinates for the next pixel
             w1 += w1XStep;
@@ -3911,6 +5247,61 @@ void ImageDrawTriangleStrip(Image *dst, Vector2 *points, int pointCount, Color c
     }
 }
 
+// Draw a line defining thickness within an image, anti-aliased edges (color blended)
+void ImageDrawLineAA(Image *dst, Vector2 start, Vector2 end, float thick, Color color)
+{
+    float dx = end.x - start.x;
+    float dy = end.y - start.y;
+    float length = sqrtf(dx*dx + dy*dy);
+
+    if ((length <= 0.0f) || (thick <= 0.0f)) return;
+
+    // Line quad, offset by half thickness along line normal
+    float nx = -dy*thick*0.5f/length;
+    float ny = dx*thick*0.5f/length;
+
+    Vector2 points[4] = {
+        { start.x + nx, start.y + ny }, { end.x + nx, end.y + ny },
+        { end.x - nx, end.y - ny }, { start.x - nx, start.y - ny }
+    };
+
+    ImageFillPolygon(dst, points, 4, color);
+}
+
+// Draw circle within an image, anti-aliased edges (color blended)
+void ImageDrawCircleAA(Image *dst, Vector2 center, float radius, Color color)
+{
+    if (radius <= 0.0f) return;
+
+    // Circle polygon segments, max distance error to circle of 0.1 pixels
+    int segments = (radius > 0.1f)? (int)ceilf(PI/acosf(1.0f - 0.1f/radius)) : 8;
+    if (segments < 8) segments = 8;
+
+    // Polygon radius scaled to match circle area
+    float step = 2.0f*PI/(float)segments;
+    float polyRadius = radius*sqrtf(step/sinf(step));
+
+    Vector2 *points = (Vector2 *)RL_MALLOC(segments*sizeof(Vector2));
+
+    for (int i = 0; i < segments; i++)
+    {
+        float angle = step*(float)i;
+        points[i] = (Vector2){ center.x + cosf(angle)*polyRadius, center.y + sinf(angle)*polyRadius };
+    }
+
+    ImageFillPolygon(dst, points, segments, color);
+
+    RL_FREE(points);
+}
+
+// Draw triangle within an image, anti-aliased edges (color blended)
+void ImageDrawTriangleAA(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    Vector2 points[3] = { v1, v2, v3 };
+
+    ImageFillPolygon(dst, points, 3, color);
+}
+
 // Draw an image (source) within an image (destination)
 // NOTE: Color tint is applied to source image
 void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
@@ -3919,119 +5310,119 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
         (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
 
-    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+    if ((dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || (src.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
     else
     {
-        Image srcMod = { 0 };       // Source copy (in case it was required)
-        Image *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
-
         // Source rectangle out-of-bounds security checks
         if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
         if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
         if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
         if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
 
-        // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, we make a copy of source, and we apply all required transform
+        // Blend is required if source has alpha to blend, tint is applied to source in any case
+        bool blendRequired = (tint.a < 255) ||
+            ((src.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) &&
+            (src.format != PIXELFORMAT_UNCOMPRESSED_R5G6B5) &&
+            (src.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) &&
+            (src.format != PIXELFORMAT_UNCOMPRESSED_R32) &&
+            (src.format != PIXELFORMAT_UNCOMPRESSED_R32G32B32) &&
+            (src.format != PIXELFORMAT_UNCOMPRESSED_R16) &&
+            (src.format != PIXELFORMAT_UNCOMPRESSED_R16G16B16));
+        bool tinted = ((tint.r < 255) || (tint.g < 255) || (tint.b < 255) || (tint.a < 255));
+
+        // Check if source rectangle needs to be scaled to destination rectangle
+        // In that case, source pixels are sampled directly while drawing, no source copy required
         if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
         {
-            srcMod = ImageFromImage(src, srcRec);   // Create image from another image
-            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
-            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
-
-            srcPtr = &srcMod;
-            useSrcMod = true;
-        }
+            if (IsPixelFormatHDR(dst->format))
+            {
+                // Float and half-float destination: source rectangle resized in float precision, then drawn unscaled
+                if (((int)srcRec.width > 0) && ((int)srcRec.height > 0) && ((int)dstRec.width > 0) && ((int)dstRec.height > 0))
+                {
+                    Image scaled = ImageFromImage(src, srcRec);
+                    if (!IsPixelFormatHDR(scaled.format)) ImageFormat(&scaled, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32);
+                    ImageResize(&scaled, (int)dstRec.width, (int)dstRec.height);
 
-        // Destination rectangle out-of-bounds security checks
-        if (dstRec.x < 0)
-        {
-            srcRec.x -= dstRec.x;
-            srcRec.width += dstRec.x;
-            dstRec.x = 0;
+                    ImageDraw(dst, scaled, (Rectangle){ 0, 0, (float)scaled.width, (float)scaled.height }, dstRec, tint);
+                    UnloadImage(scaled);
+                }
+            }
+            else ImageDrawScaled(dst, src, srcRec, dstRec, tint, blendRequired);
         }
-        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
-
-        if (dstRec.y < 0)
+        else
         {
-            srcRec.y -= dstRec.y;
-            srcRec.height += dstRec.y;
-            dstRec.y = 0;
-        }
-        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
-
-        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
-        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
-
-        // This blitting method is quite fast! The process followed is:
-        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
-        // Some optimization ideas:
-        //    [x] Avoid creating source copy if not required (no resize required)
-        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
-        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
-        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
-        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
-        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
-        //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
-        //    [ ] Support f32bit channels drawing
-
-        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and PIXELFORMAT_UNCOMPRESSED_R1616B16A16
-
-        Color colSrc, colDst, blend;
-        bool blendRequired = true;
+            // Destination rectangle out-of-bounds security checks
+            if (dstRec.x < 0)
+            {
+                srcRec.x -= dstRec.x;
+                srcRec.width += dstRec.x;
+                dstRec.x = 0;
+            }
+            else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
 
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) &&
-            ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R32) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R16) ||
-            (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16)))
-            blendRequired = false;
+            if (dstRec.y < 0)
+            {
+                srcRec.y -= dstRec.y;
+                srcRec.height += dstRec.y;
+                dstRec.y = 0;
+            }
+            else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
 
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
+            if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
+            if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+            // Blitting is done by spans of pixels: [src_format -> R8G8B8A8 -> tint -> blend -> dst_format]
+            // NOTE: R8G8B8A8 destination is blended in place using SIMD (when available),
+            // float and half-float destinations use float RGBA spans instead, no 8 bit per channel round trip
+            bool hdr = IsPixelFormatHDR(dst->format);
+            int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
+            int bytesPerPixelDst = strideDst/(dst->width);
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+            int strideSrc = GetPixelDataSize(src.width, 1, src.format);
+            int bytesPerPixelSrc = strideSrc/(src.width);
 
-        for (int y = 0; y < (int)srcRec.height; y++)
-        {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+            unsigned char *pSrcBase = (unsigned char *)src.data + ((int)srcRec.y*src.width + (int)srcRec.x)*bytesPerPixelSrc;
+            unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+            unsigned char span[IMAGE_DRAW_SPAN*4] = { 0 };
+            float spanFloat[IMAGE_DRAW_SPAN*4] = { 0 };
 
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
+            for (int y = 0; y < (int)srcRec.height; y++)
             {
-                for (int x = 0; x < (int)srcRec.width; x++)
+                // Fast path: Avoid moving pixel by pixel if no blend required and same format
+                if (!blendRequired && !tinted && (src.format == dst->format)) memcpy(pDstBase, pSrcBase, (int)(srcRec.width)*bytesPerPixelSrc);
+                else
                 {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
-
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
-
-                    SetPixelColor(pDst, blend, dst->format);
+                    for (int x = 0; x < (int)srcRec.width; x += IMAGE_DRAW_SPAN)
+                    {
+                        int count = (((int)srcRec.width - x) < IMAGE_DRAW_SPAN)? ((int)srcRec.width - x) : IMAGE_DRAW_SPAN;
+                        const unsigned char *pSrc = pSrcBase + x*bytesPerPixelSrc;
 
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
+                        if (hdr)
+                        {
+                            ConvertPixelsToFloat(pSrc, src.format, spanFloat, count);
+                            if (tinted) TintPixelsFloatSpan(spanFloat, count, tint);
+                            DrawPixelsFloatSpan(pDstBase + x*bytesPerPixelDst, dst->format, spanFloat, count, blendRequired);
+                        }
+                        else
+                        {
+                            // Fast path: R8G8B8A8 source pixels used directly if not tinted
+                            if (tinted || (src.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+                            {
+                                ConvertPixelsToRGBA8(pSrc, src.format, span, count);
+                                if (tinted) TintPixelsSpan(span, count, tint);
+                                pSrc = span;
+                            }
+
+                            DrawPixelsSpan(pDstBase + x*bytesPerPixelDst, dst->format, pSrc, count, blendRequired);
+                        }
+                    }
                 }
-            }
 
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
+                pSrcBase += strideSrc;
+                pDstBase += strideDst;
+            }
         }
 
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
-
         if ((dst->mipmaps > 1) && (src.mipmaps > 1))
         {
             Image mipmapDst = *dst;
@@ -4080,6 +5471,11 @@ void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSiz
 // Draw text (custom sprite font) within an image (destination)
 void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
 {
+#if defined(SUPPORT_MODULE_RTEXT)
+    // Fast path: Glyphs drawn directly into destination, no intermediate text image
+    if (ImageDrawTextGlyphs(dst, font, text, position, fontSize, spacing, tint)) return;
+#endif
+
     Image imText = ImageTextEx(font, text, fontSize, spacing, tint);
 
     Rectangle srcRec = { 0.0f, 0.0f, (float)imText.width, (float)imText.height };
@@ -4090,6 +5486,196 @@ void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position,
     UnloadImage(imText);
 }
 
+//------------------------------------------------------------------------------------
+// Image atlas functions
+//------------------------------------------------------------------------------------
+// Load image atlas, packing images into pages of limited size (MaxRects packing)
+// NOTE: Images not fitting in a page are packed in additional pages, pages are R8G8B8A8 and keep full size
+// (free space is available for ImageAtlasAdd()), images not packed get page index -1,
+// padding adds pixels around every image, extrude repeats image border pixels into padding (avoids filtering bleeding)
+// WARNING: Provided images are copied, they can be unloaded after atlas loading
+ImageAtlas LoadImageAtlas(const Image *images, int imageCount, int pageWidth, int pageHeight, int padding, int extrude)
+{
+    ImageAtlas atlas = { 0 };
+
+    if ((pageWidth <= 0) || (pageHeight <= 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Atlas page size not valid");
+        return atlas;
+    }
+
+    if (padding < 0) padding = 0;
+    if (extrude < 0) extrude = 0;
+    if (extrude > padding) extrude = padding;   // Extruded pixels limited to padding
+
+    atlas.pageWidth = pageWidth;
+    atlas.pageHeight = pageHeight;
+    atlas.padding = padding;
+    atlas.extrude = extrude;
+
+    if ((images == NULL) || (imageCount <= 0)) return atlas;    // Empty atlas, images can be added with ImageAtlasAdd()
+
+    atlas.recs = (Rectangle *)RL_CALLOC(imageCount, sizeof(Rectangle));
+    atlas.recPages = (int *)RL_MALLOC(imageCount*sizeof(int));
+    atlas.recCount = imageCount;
+
+    Rectangle *packRecs = (Rectangle *)RL_MALLOC(imageCount*sizeof(Rectangle));
+    bool *packed = (bool *)RL_CALLOC(imageCount, sizeof(bool));
+    bool *packedPrevious = (bool *)RL_MALLOC(imageCount*sizeof(bool));
+    int packedCount = 0;
+    int totalArea = 0;
+
+    for (int i = 0; i < imageCount; i++)
+    {
+        packRecs[i] = (Rectangle){ 0, 0, (float)(images[i].width + 2*padding), (float)(images[i].height + 2*padding) };
+        atlas.recPages[i] = -1;
+
+        // Images not valid are skipped (flagged as packed, no page)
+        if ((images[i].data == NULL) || (images[i].width <= 0) || (images[i].height <= 0) || (images[i].format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Atlas image (%i) not valid, compressed formats not supported", i);
+            packed[i] = true;
+            packedCount++;
+        }
+        else totalArea += images[i].width*images[i].height;
+    }
+
+    while (packedCount < imageCount)
+    {
+        memcpy(packedPrevious, packed, imageCount*sizeof(bool));
+        int pagePackedCount = PackRecsMaxRects(packRecs, packed, imageCount, pageWidth, pageHeight);
+
+        if (pagePackedCount == 0)
+        {
+            for (int i = 0; i < imageCount; i++) if (!packed[i]) TRACELOG(LOG_WARNING, "IMAGE: Failed to pack atlas image (%i), bigger than atlas page", i);
+            break;
+        }
+
+        packedCount += pagePackedCount;
+
+        Image page = { 0 };
+        page.data = RL_CALLOC(pageWidth*pageHeight, 4);
+        page.width = pageWidth;
+        page.height = pageHeight;
+        page.mipmaps = 1;
+        page.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        for (int i = 0; i < imageCount; i++)
+        {
+            if (!packed[i] || packedPrevious[i]) continue;
+
+            atlas.recs[i] = (Rectangle){ packRecs[i].x + (float)padding, packRecs[i].y + (float)padding, (float)images[i].width, (float)images[i].height };
+            atlas.recPages[i] = atlas.pageCount;
+
+            DrawAtlasImage(&page, images[i], (int)atlas.recs[i].x, (int)atlas.recs[i].y, extrude);
+        }
+
+        atlas.pages = (Image *)RL_REALLOC(atlas.pages, (atlas.pageCount + 1)*sizeof(Image));
+        atlas.pages[atlas.pageCount] = page;
+        atlas.pageCount++;
+    }
+
+    if (atlas.pageCount > 0) TRACELOG(LOG_INFO, "IMAGE: Atlas generated (%i pages | %i images | %.1f%% packing efficiency)",
+        atlas.pageCount, imageCount, 100.0f*(float)totalArea/((float)pageWidth*(float)pageHeight*(float)atlas.pageCount));
+
+    RL_FREE(packedPrevious);
+    RL_FREE(packed);
+    RL_FREE(packRecs);
+
+    return atlas;
+}
+
+// Unload image atlas pages and rectangles data
+void UnloadImageAtlas(ImageAtlas atlas)
+{
+    for (int i = 0; i < atlas.pageCount; i++) UnloadImage(atlas.pages[i]);
+
+    RL_FREE(atlas.pages);
+    RL_FREE(atlas.recs);
+    RL_FREE(atlas.recPages);
+}
+
+// Add image to atlas, packed in the first page with enough free space (new page added if required)
+// NOTE: Returns added image index for atlas.recs/atlas.recPages, -1 on failure,
+// updated page textures must be reloaded or updated with UpdateTexture()
+int ImageAtlasAdd(ImageAtlas *atlas, Image image)
+{
+    if ((atlas == NULL) || (atlas->pageWidth <= 0) || (atlas->pageHeight <= 0)) return -1;
+
+    if ((image.data == NULL) || (image.width <= 0) || (image.height <= 0) || (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Atlas image not valid, compressed formats not supported");
+        return -1;
+    }
+
+    int padding = atlas->padding;
+    int width = image.width + 2*padding;
+    int height = image.height + 2*padding;
+
+    if ((width > atlas->pageWidth) || (height > atlas->pageHeight))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to pack atlas image, bigger than atlas page");
+        return -1;
+    }
+
+    PackFreeRec placed = { 0, 0, width, height };
+    int pageIndex = -1;
+
+    // Rebuild pages free space from packed images, first page with a free rectangle is used
+    for (int p = 0; (p < atlas->pageCount) && (pageIndex == -1); p++)
+    {
+        PackBin bin = { 0 };
+        InitPackBin(&bin, atlas->pageWidth, atlas->pageHeight);
+
+        for (int i = 0; i < atlas->recCount; i++)
+        {
+            if (atlas->recPages[i] != p) continue;
+
+            PackFreeRec used = { (int)atlas->recs[i].x - padding, (int)atlas->recs[i].y - padding, (int)atlas->recs[i].width + 2*padding, (int)atlas->recs[i].height + 2*padding };
+            PlacePackBinRec(&bin, used);
+        }
+
+        int freeIndex = FindPackBinFreeRec(&bin, width, height);
+
+        if (freeIndex != -1)
+        {
+            placed.x = bin.freeRecs[freeIndex].x;
+            placed.y = bin.freeRecs[freeIndex].y;
+            pageIndex = p;
+        }
+
+        UnloadPackBin(&bin);
+    }
+
+    if (pageIndex == -1)
+    {
+        // No free space available, add a new page
+        Image page = { 0 };
+        page.data = RL_CALLOC(atlas->pageWidth*atlas->pageHeight, 4);
+        page.width = atlas->pageWidth;
+        page.height = atlas->pageHeight;
+        page.mipmaps = 1;
+        page.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        atlas->pages = (Image *)RL_REALLOC(atlas->pages, (atlas->pageCount + 1)*sizeof(Image));
+        atlas->pages[atlas->pageCount] = page;
+        pageIndex = atlas->pageCount;
+        atlas->pageCount++;
+    }
+
+    atlas->recs = (Rectangle *)RL_REALLOC(atlas->recs, (atlas->recCount + 1)*sizeof(Rectangle));
+    atlas->recPages = (int *)RL_REALLOC(atlas->recPages, (atlas->recCount + 1)*sizeof(int));
+
+    int index = atlas->recCount;
+    atlas->recs[index] = (Rectangle){ (float)(placed.x + padding), (float)(placed.y + padding), (float)image.width, (float)image.height };
+    atlas->recPages[index] = pageIndex;
+    atlas->recCount++;
+
+    DrawAtlasImage(&atlas->pages[pageIndex], image, placed.x + padding, placed.y + padding, atlas->extrude);
+
+    return index;
+}
+
 //------------------------------------------------------------------------------------
 // Texture loading functions
 //------------------------------------------------------------------------------------
@@ -4344,6 +5930,434 @@ void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
     rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
 }
 
+#if defined(SUPPORT_ASYNC_LOADING)
+//------------------------------------------------------------------------------------
+// Async loading functions
+//------------------------------------------------------------------------------------
+// Get async loading request slot index from request id, -1 if id is not valid (stale or free)
+// NOTE: Request id encodes slot index and slot generation: generation*MAX_ASYNC_LOAD_REQUESTS + index + 1,
+// requires LockAsyncTasks()
+static int GetAsyncLoadRequestIndex(unsigned int asyncId)
+{
+    if (asyncId == 0) return -1;
+
+    int index = (int)((asyncId - 1)%MAX_ASYNC_LOAD_REQUESTS);
+    unsigned int generation = (asyncId - 1)/MAX_ASYNC_LOAD_REQUESTS;
+
+    if ((asyncRequests[index].state == ASYNC_LOAD_FREE) || (asyncRequests[index].generation != generation)) return -1;
+
+    return index;
+}
+
+// Add async loading request for a file, returns request id (0 on failure)
+static unsigned int AddAsyncLoadRequest(const char *fileName, bool toTexture)
+{
+    unsigned int id = 0;
+    bool startTask = false;
+
+    if (fileName == NULL) return id;
+
+    // NOTE: Requests are queued and loaded by a limited number of async tasks, so async tasks queue is never
+    // exhausted (requests would be loaded on calling thread), a new task is only started if all tasks are busy
+    LockAsyncTasks();
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++)
+    {
+        if (asyncRequests[i].state == ASYNC_LOAD_FREE)
+        {
+            AsyncLoadRequest *request = &asyncRequests[i];
+
+            request->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+            strcpy(request->fileName, fileName);
+            request->toTexture = toTexture;
+            request->image = (Image){ 0 };
+            request->texture = (Texture2D){ 0 };
+            request->state = ASYNC_LOAD_QUEUED;
+            request->order = asyncRequestsOrder++;
+            request->generation = (request->generation + 1)%(UINT_MAX/MAX_ASYNC_LOAD_REQUESTS);
+
+            if (asyncLoadTasks < MAX_ASYNC_LOAD_TASKS)
+            {
+                asyncLoadTasks++;
+                startTask = true;
+            }
+
+            if (toTexture) asyncUploadsPending++;
+            id = request->generation*MAX_ASYNC_LOAD_REQUESTS + i + 1;
+            break;
+        }
+    }
+
+    UnlockAsyncTasks();
+
+    if (startTask) RunAsyncTask(LoadAsyncRequestTask, NULL);
+
+    if (id == 0) TRACELOG(LOG_WARNING, "IMAGE: [%s] Async loading requests limit reached (%i)", fileName, MAX_ASYNC_LOAD_REQUESTS);
+
+    return id;
+}
+
+// Get async loading request state (free: request id not valid)
+static int GetAsyncLoadState(unsigned int asyncId)
+{
+    int state = ASYNC_LOAD_FREE;
+
+    LockAsyncTasks();
+    int index = GetAsyncLoadRequestIndex(asyncId);
+    if (index >= 0) state = asyncRequests[index].state;
+    UnlockAsyncTasks();
+
+    return state;
+}
+
+// Release async loading request slot, loaded data is owned by the user
+static void ReleaseAsyncLoadRequest(int index)
+{
+    AsyncLoadRequest *request = &asyncRequests[index];
+
+    LockAsyncTasks();
+    RL_FREE(request->fileName);
+    request->fileName = NULL;
+    request->state = ASYNC_LOAD_FREE;
+    UnlockAsyncTasks();
+}
+
+// Load image from file asynchronously, image is loaded and decoded on a background thread
+// NOTE: Returned request id must be used to get the image with GetAsyncImage() once IsAssetReady()
+unsigned int LoadImageAsync(const char *fileName)
+{
+    return AddAsyncLoadRequest(fileName, false);
+}
+
+// Load texture from file asynchronously, image is loaded and decoded on a background thread
+// and uploaded to GPU on main thread at EndDrawing(), limited to MAX_ASYNC_UPLOAD_BYTES per frame
+// NOTE: Returned request id must be used to get the texture with GetAsyncTexture() once IsAssetReady()
+unsigned int LoadTextureAsync(const char *fileName)
+{
+    return AddAsyncLoadRequest(fileName, true);
+}
+
+// Check if async loading request is completed: image decoded or texture uploaded to GPU
+// NOTE: Failed requests are also completed, returning invalid image or texture
+bool IsAssetReady(unsigned int asyncId)
+{
+    return (GetAsyncLoadState(asyncId) == ASYNC_LOAD_READY);
+}
+
+// Get async loaded image, request is released
+// NOTE: Image must be unloaded by the user with UnloadImage()
+Image GetAsyncImage(unsigned int asyncId)
+{
+    Image image = { 0 };
+    int state = GetAsyncLoadState(asyncId);
+
+    // NOTE: Ready requests are only released by the user, slot index is valid after state check
+    int index = (int)((asyncId - 1)%MAX_ASYNC_LOAD_REQUESTS);
+
+    if ((state == ASYNC_LOAD_READY) && !asyncRequests[index].toTexture)
+    {
+        image = asyncRequests[index].image;
+        ReleaseAsyncLoadRequest(index);
+    }
+    else if (state == ASYNC_LOAD_FREE) TRACELOG(LOG_WARNING, "IMAGE: [ID %u] Async loading request not valid", asyncId);
+    else if (state != ASYNC_LOAD_READY) TRACELOG(LOG_WARNING, "IMAGE: [ID %u] Async loading request not ready", asyncId);
+    else TRACELOG(LOG_WARNING, "IMAGE: [ID %u] Async loading request is a texture, use GetAsyncTexture()", asyncId);
+
+    return image;
+}
+
+// Get async loaded texture, request is released
+// NOTE: Texture must be unloaded by the user with UnloadTexture()
+Texture2D GetAsyncTexture(unsigned int asyncId)
+{
+    Texture2D texture = { 0 };
+    int state = GetAsyncLoadState(asyncId);
+
+    // NOTE: Ready requests are only released by the user, slot index is valid after state check
+    int index = (int)((asyncId - 1)%MAX_ASYNC_LOAD_REQUESTS);
+
+    if ((state == ASYNC_LOAD_READY) && asyncRequests[index].toTexture)
+    {
+        texture = asyncRequests[index].texture;
+        ReleaseAsyncLoadRequest(index);
+    }
+    else if (state == ASYNC_LOAD_FREE) TRACELOG(LOG_WARNING, "TEXTURE: [ID %u] Async loading request not valid", asyncId);
+    else if (state != ASYNC_LOAD_READY) TRACELOG(LOG_WARNING, "TEXTURE: [ID %u] Async loading request not ready", asyncId);
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %u] Async loading request is an image, use GetAsyncImage()", asyncId);
+
+    return texture;
+}
+
+// Upload async loaded textures to GPU, limited to MAX_ASYNC_UPLOAD_BYTES per frame
+// NOTE: Called on EndDrawing(), GPU uploads are only possible from main thread
+void UpdateAsyncLoading(void)
+{
+    LockAsyncTasks();
+    int uploadsPending = asyncUploadsPending;
+    UnlockAsyncTasks();
+
+    if (uploadsPending == 0) return;
+
+    int uploadedSize = 0;
+
+    for (int i = 0; (i < MAX_ASYNC_LOAD_REQUESTS) && (uploadsPending > 0); i++)
+    {
+        AsyncLoadRequest *request = &asyncRequests[i];
+
+        // NOTE: Requests in uploading state are no longer accessed by background threads
+        LockAsyncTasks();
+        int state = request->state;
+        UnlockAsyncTasks();
+
+        if (state != ASYNC_LOAD_UPLOADING) continue;
+
+        int dataSize = 0;
+
+        for (int m = 0, width = request->image.width, height = request->image.height; m < request->image.mipmaps; m++)
+        {
+            dataSize += GetPixelDataSize(width, height, request->image.format);
+            width = (width > 1)? width/2 : 1;
+            height = (height > 1)? height/2 : 1;
+        }
+
+        if ((uploadedSize > 0) && ((uploadedSize + dataSize) > MAX_ASYNC_UPLOAD_BYTES)) break;
+
+        if (request->image.data != NULL) request->texture = LoadTextureFromImage(request->image);
+        UnloadImage(request->image);
+        request->image = (Image){ 0 };
+
+        LockAsyncTasks();
+        request->state = ASYNC_LOAD_READY;
+        asyncUploadsPending--;
+        UnlockAsyncTasks();
+
+        uploadsPending--;
+        uploadedSize += dataSize;
+    }
+}
+
+// Wait for async loading tasks and unload not retrieved requests data
+// NOTE: Called on CloseWindow(), before GPU context is closed
+void CloseAsyncLoading(void)
+{
+    CloseAsyncTasks();
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++)
+    {
+        if (asyncRequests[i].state != ASYNC_LOAD_FREE)
+        {
+            UnloadImage(asyncRequests[i].image);
+            UnloadTexture(asyncRequests[i].texture);
+            ReleaseAsyncLoadRequest(i);
+        }
+    }
+
+    LockAsyncTasks();
+    asyncUploadsPending = 0;
+    UnlockAsyncTasks();
+}
+#endif      // SUPPORT_ASYNC_LOADING
+
+#if defined(SUPPORT_TEXTURE_READBACK)
+//------------------------------------------------------------------------------------
+// Texture readback functions
+//------------------------------------------------------------------------------------
+// Get texture readback request, NULL if id is not valid
+static TextureReadback *GetTextureReadback(unsigned int readbackId)
+{
+    TextureReadback *readback = NULL;
+
+    if ((readbackId > 0) && (readbackId <= MAX_TEXTURE_READBACKS) &&
+        (textureReadbacks[readbackId - 1].state != TEXTURE_READBACK_FREE)) readback = &textureReadbacks[readbackId - 1];
+
+    return readback;
+}
+
+// Complete pending texture readback, pixel data is copied from pixel buffer into image
+// NOTE: Mapping the pixel buffer waits for the GPU copy if fence sync is not signaled yet
+static void CompleteTextureReadback(TextureReadback *readback)
+{
+    int size = readback->image.width*readback->image.height*4;
+    void *data = rlMapPixelBuffer(readback->pboId, size);
+
+    if (data != NULL)
+    {
+        readback->image.data = RL_MALLOC(size);
+        memcpy(readback->image.data, data, size);
+        rlUnmapPixelBuffer(readback->pboId);
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to map readback pixel buffer");
+
+    rlUnloadFenceSync(readback->fence);
+    readback->fence = NULL;
+    readback->state = TEXTURE_READBACK_READY;
+}
+
+// Request render texture pixels readback, returns request id (0 on failure)
+// NOTE: Rectangle is defined in render texture coordinates, (0, 0) is the bottom-left corner (OpenGL convention),
+// zero size rectangle reads the full texture; retrieved image rows are bottom-up, same as LoadImageFromTexture().
+// Pixels are read directly from the render texture framebuffer into a pixel buffer without stalling the GPU pipeline,
+// synchronous read is used if pixel buffers are not supported (OpenGL 1.1, OpenGL ES 2.0) or latency is 0
+unsigned int RequestTextureReadback(RenderTexture2D target, Rectangle rec)
+{
+    unsigned int id = 0;
+
+    if ((target.id == 0) || (target.texture.id == 0))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Readback requested for an invalid render texture");
+        return id;
+    }
+
+    if ((rec.width <= 0) || (rec.height <= 0)) rec = (Rectangle){ 0, 0, (float)target.texture.width, (float)target.texture.height };
+
+    // Security check to validate rectangle, not valid values (NaN) or values out of 64 bit range are out of bounds
+    if (!(fabsf(rec.x) < 1e18f) || !(fabsf(rec.y) < 1e18f) || !(fabsf(rec.width) < 1e18f) || !(fabsf(rec.height) < 1e18f))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Readback rectangle out of render texture bounds", target.id);
+        return id;
+    }
+
+    // Clamp rectangle to render texture bounds, computed in 64 bit (no overflow)
+    long long left = (long long)rec.x;
+    long long bottom = (long long)rec.y;
+    long long right = left + (long long)rec.width;      // Rectangle right limit (not included)
+    long long top = bottom + (long long)rec.height;     // Rectangle top limit (not included)
+    if (left < 0) left = 0;
+    if (bottom < 0) bottom = 0;
+    if (right > target.texture.width) right = target.texture.width;
+    if (top > target.texture.height) top = target.texture.height;
+
+    if ((right <= left) || (top <= bottom))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Readback rectangle out of render texture bounds", target.id);
+        return id;
+    }
+
+    int x = (int)left;
+    int y = (int)bottom;
+    int width = (int)(right - left);
+    int height = (int)(top - bottom);
+
+    for (int i = 0; i < MAX_TEXTURE_READBACKS; i++)
+    {
+        if (textureReadbacks[i].state == TEXTURE_READBACK_FREE)
+        {
+            id = i + 1;
+            break;
+        }
+    }
+
+    if (id == 0)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Readback requests limit reached (%i)", target.id, MAX_TEXTURE_READBACKS);
+        return id;
+    }
+
+    TextureReadback *readback = &textureReadbacks[id - 1];
+    int size = width*height*4;
+
+    readback->image = (Image){ NULL, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    readback->frames = 0;
+
+    // Make sure render texture contains all drawing submitted until now
+    rlDrawRenderBatchActive();
+
+    // Grow request pixel buffer if required, reused by following requests
+    if ((textureReadbackLatency > 0) && (readback->pboSize < size))
+    {
+        if (readback->pboId != 0) rlUnloadPixelBuffer(readback->pboId);
+        readback->pboId = rlLoadPixelBuffer(size);
+        readback->pboSize = (readback->pboId != 0)? size : 0;
+    }
+
+    if ((textureReadbackLatency > 0) && (readback->pboId != 0))
+    {
+        // NOTE: Fence sync not supported (NULL) is considered signaled, mapping waits for the copy
+        rlReadFramebufferPixelsToBuffer(target.id, readback->pboId, x, y, width, height);
+        readback->fence = rlLoadFenceSync();
+        readback->state = TEXTURE_READBACK_PENDING;
+    }
+    else
+    {
+        readback->image.data = rlReadFramebufferPixels(target.id, x, y, width, height);
+        readback->state = TEXTURE_READBACK_READY;
+    }
+
+    return id;
+}
+
+// Check if texture readback request pixel data is available, GPU copy completed
+// NOTE: It never waits, pending requests are waited for once their latency frames have elapsed
+bool IsTextureReadbackReady(unsigned int readbackId)
+{
+    TextureReadback *readback = GetTextureReadback(readbackId);
+
+    if (readback == NULL) return false;
+
+    if ((readback->state == TEXTURE_READBACK_PENDING) && rlIsFenceSyncReady(readback->fence, false)) CompleteTextureReadback(readback);
+
+    return (readback->state == TEXTURE_READBACK_READY);
+}
+
+// Get texture readback image, request is released
+// NOTE: Waits for the GPU copy if request is not ready, image must be unloaded by the user with UnloadImage()
+Image GetTextureReadbackImage(unsigned int readbackId)
+{
+    Image image = { 0 };
+    TextureReadback *readback = GetTextureReadback(readbackId);
+
+    if (readback != NULL)
+    {
+        if (readback->state == TEXTURE_READBACK_PENDING) CompleteTextureReadback(readback);
+
+        image = readback->image;
+        readback->image = (Image){ 0 };
+        readback->state = TEXTURE_READBACK_FREE;
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Readback request not valid", readbackId);
+
+    return image;
+}
+
+// Set frames a texture readback can be in flight before waiting for it (0: synchronous reads)
+// NOTE: Requests not completed at EndDrawing() after that number of frames are waited for, so
+// pixel data is always available on the following frames, a low latency could stall the GPU pipeline
+void SetTextureReadbackLatency(int frames)
+{
+    textureReadbackLatency = (frames > 0)? frames : 0;
+}
+
+// Complete texture readbacks copied by GPU, requests reaching latency frames are waited for
+// NOTE: Called on EndDrawing()
+void UpdateTextureReadbacks(void)
+{
+    for (int i = 0; i < MAX_TEXTURE_READBACKS; i++)
+    {
+        TextureReadback *readback = &textureReadbacks[i];
+
+        if (readback->state != TEXTURE_READBACK_PENDING) continue;
+
+        readback->frames++;
+        if (rlIsFenceSyncReady(readback->fence, (readback->frames >= textureReadbackLatency))) CompleteTextureReadback(readback);
+    }
+}
+
+// Unload texture readback requests data and pixel buffers
+// NOTE: Called on CloseWindow(), before GPU context is closed
+void CloseTextureReadbacks(void)
+{
+    for (int i = 0; i < MAX_TEXTURE_READBACKS; i++)
+    {
+        TextureReadback *readback = &textureReadbacks[i];
+
+        rlUnloadFenceSync(readback->fence);
+        if (readback->pboId != 0) rlUnloadPixelBuffer(readback->pboId);
+        UnloadImage(readback->image);
+        *readback = (TextureReadback){ 0 };
+    }
+}
+#endif      // SUPPORT_TEXTURE_READBACK
+
 //------------------------------------------------------------------------------------
 // Texture configuration functions
 //------------------------------------------------------------------------------------
@@ -5154,108 +7168,24 @@ Color GetPixelColor(void *srcPtr, int format)
 {
     Color color = { 0 };
 
+    // NOTE: Pixel is converted the same way as LoadImageColors()
+    if ((format >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (format < PIXELFORMAT_COMPRESSED_DXT1_RGB)) ConvertPixelsToRGBA8(srcPtr, format, (unsigned char *)&color, 1);
+
+    return color;
+}
+
+// Set pixel color formatted into destination pointer
+void SetPixelColor(void *dstPtr, Color color, int format)
+{
     switch (format)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
         {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
-
-        } break;
-        default: break;
-    }
-
-    return color;
-}
-
-// Set pixel color formatted into destination pointer
-void SetPixelColor(void *dstPtr, Color color, int format)
-{
-    switch (format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dstPtr)[0] = gray;
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
 
         } break;
         case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
@@ -5364,9 +7294,13 @@ int GetPixelDataSize(int width, int height, int format)
     double bytesPerPixel = (double)bpp/8.0;
     dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
+    // Most compressed formats works on 4x4 blocks, partial blocks are stored as full blocks,
     // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))
+    {
+        dataSize = ((width + 3)/4)*((height + 3)/4)*(bpp*16/8);
+    }
+    else if ((width < 4) && (height < 4))
     {
         if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
         else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
@@ -5376,173 +7310,6465 @@ int GetPixelDataSize(int width, int height, int format)
 }
 
 //----------------------------------------------------------------------------------
-// Module specific Functions Definition
+// Module Internal Functions Definition
 //----------------------------------------------------------------------------------
-// Convert half-float (stored as unsigned short) to float
-// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
-static float HalfToFloat(unsigned short x)
+// Compare rectangles packing sort entries, descending order [Used in PackRecsMaxRects()]
+static int PackSortEntryCompare(const void *a, const void *b)
 {
-    float result = 0.0f;
+    const PackSortEntry *entryA = (const PackSortEntry *)a;
+    const PackSortEntry *entryB = (const PackSortEntry *)b;
 
-    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
-    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
-    const float fm = (float)m;
-    const unsigned int v = (*(unsigned int *)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
-    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+    if (entryA->longSide != entryB->longSide) return (entryA->longSide > entryB->longSide)? -1 : 1;
+    if (entryA->shortSide != entryB->shortSide) return (entryA->shortSide > entryB->shortSide)? -1 : 1;
+    return (entryA->index - entryB->index);     // Keep order stable
+}
 
-    result = *(float *)&r;
+// Pack rectangles into a bin of provided size, MaxRects algorithm with best-short-side-fit heuristic
+// NOTE: Rectangles width/height are used as input and x/y are set on packed rectangles,
+// rectangles already flagged as packed are skipped (useful to fill multiple bins),
+// returns the number of rectangles packed in this bin
+// REF: Jukka Jylanki, A Thousand Ways to Pack the Bin - A Practical Approach to Two-Dimensional Rectangle Bin Packing
+int PackRecsMaxRects(Rectangle *recs, bool *packed, int count, int width, int height)
+{
+    int packedCount = 0;
 
-    return result;
+    // Sort rectangles to pack by longer side (and shorter side), packing bigger rectangles first gives better results
+    PackSortEntry *order = (PackSortEntry *)RL_MALLOC(count*sizeof(PackSortEntry));
+    int orderCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (packed[i]) continue;
+
+        int w = (int)ceilf(recs[i].width);
+        int h = (int)ceilf(recs[i].height);
+
+        order[orderCount].longSide = (w > h)? w : h;
+        order[orderCount].shortSide = (w < h)? w : h;
+        order[orderCount].index = i;
+        orderCount++;
+    }
+
+    qsort(order, orderCount, sizeof(PackSortEntry), PackSortEntryCompare);
+
+    // Free rectangles list, starting with the full bin
+    PackBin bin = { 0 };
+    InitPackBin(&bin, width, height);
+
+    for (int n = 0; n < orderCount; n++)
+    {
+        int index = order[n].index;
+        int w = (int)ceilf(recs[index].width);
+        int h = (int)ceilf(recs[index].height);
+
+        if ((w <= 0) || (h <= 0))
+        {
+            // Empty rectangles do not require space
+            recs[index].x = 0;
+            recs[index].y = 0;
+            packed[index] = true;
+            packedCount++;
+            continue;
+        }
+
+        int freeIndex = FindPackBinFreeRec(&bin, w, h);
+
+        if (freeIndex == -1) continue;      // Rectangle does not fit in this bin
+
+        PackFreeRec placed = { bin.freeRecs[freeIndex].x, bin.freeRecs[freeIndex].y, w, h };
+        recs[index].x = (float)placed.x;
+        recs[index].y = (float)placed.y;
+        packed[index] = true;
+        packedCount++;
+
+        PlacePackBinRec(&bin, placed);
+    }
+
+    UnloadPackBin(&bin);
+    RL_FREE(order);
+
+    return packedCount;
 }
 
-// Convert float to half-float (stored as unsigned short)
-static unsigned short FloatToHalf(float x)
+// Draw image into atlas page (R8G8B8A8) at provided position, no blending
+// NOTE: Image border pixels are repeated extrude pixels around image
+static void DrawAtlasImage(Image *page, Image image, int posX, int posY, int extrude)
 {
-    unsigned short result = 0;
+    unsigned char *pixels = (unsigned char *)image.data;
+    if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) pixels = (unsigned char *)LoadImageColors(image);
 
-    const unsigned int b = (*(unsigned int *) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
-    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+    int width = image.width;
+    int height = image.height;
 
-    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+    for (int y = -extrude; y < (height + extrude); y++)
+    {
+        int srcY = (y < 0)? 0 : ((y >= height)? height - 1 : y);
+        const unsigned char *src = pixels + (size_t)srcY*width*4;
+        unsigned char *dst = (unsigned char *)page->data + ((size_t)(posY + y)*page->width + posX)*4;
 
-    return result;
+        for (int x = -extrude; x < 0; x++) memcpy(dst + x*4, src, 4);
+        memcpy(dst, src, (size_t)width*4);
+        for (int x = width; x < (width + extrude); x++) memcpy(dst + x*4, src + (width - 1)*4, 4);
+    }
+
+    if (pixels != image.data) RL_FREE(pixels);
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+// Init rectangles packing bin of provided size, the full bin is free
+static void InitPackBin(PackBin *bin, int width, int height)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+    bin->freeCapacity = 256;
+    bin->freeCount = 1;
+    bin->freeRecs = (PackFreeRec *)RL_MALLOC(bin->freeCapacity*sizeof(PackFreeRec));
+    bin->splitRecs = (PackFreeRec *)RL_MALLOC(bin->freeCapacity*sizeof(PackFreeRec));
+    bin->freeRecs[0] = (PackFreeRec){ 0, 0, width, height };
+}
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+// Unload rectangles packing bin free areas
+static void UnloadPackBin(PackBin *bin)
+{
+    RL_FREE(bin->splitRecs);
+    RL_FREE(bin->freeRecs);
+    bin->freeRecs = NULL;
+    bin->splitRecs = NULL;
+    bin->freeCount = 0;
+    bin->freeCapacity = 0;
+}
+
+// Find free rectangle with best short side fit for a rectangle (ties resolved by long side fit)
+// NOTE: Returns free rectangle index, -1 if rectangle does not fit in bin
+static int FindPackBinFreeRec(const PackBin *bin, int width, int height)
+{
+    int bestIndex = -1;
+    int bestShortSide = 0x7fffffff;
+    int bestLongSide = 0x7fffffff;
+
+    for (int i = 0; i < bin->freeCount; i++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        if ((bin->freeRecs[i].width >= width) && (bin->freeRecs[i].height >= height))
         {
-            switch (image.format)
+            int leftoverX = bin->freeRecs[i].width - width;
+            int leftoverY = bin->freeRecs[i].height - height;
+            int shortSide = (leftoverX < leftoverY)? leftoverX : leftoverY;
+            int longSide = (leftoverX > leftoverY)? leftoverX : leftoverY;
+
+            if ((shortSide < bestShortSide) || ((shortSide == bestShortSide) && (longSide < bestLongSide)))
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                bestIndex = i;
+                bestShortSide = shortSide;
+                bestLongSide = longSide;
+            }
+        }
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+    return bestIndex;
+}
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+// Place rectangle in bin, splitting free rectangles intersecting it
+static void PlacePackBinRec(PackBin *bin, PackFreeRec placed)
+{
+    // Split free rectangles intersecting placed rectangle, up to 4 new free rectangles each
+    if ((bin->freeCount*4) > bin->freeCapacity)
+    {
+        while ((bin->freeCount*4) > bin->freeCapacity) bin->freeCapacity *= 2;
+        bin->freeRecs = (PackFreeRec *)RL_REALLOC(bin->freeRecs, bin->freeCapacity*sizeof(PackFreeRec));
+        bin->splitRecs = (PackFreeRec *)RL_REALLOC(bin->splitRecs, bin->freeCapacity*sizeof(PackFreeRec));
+    }
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+    PackFreeRec *freeRecs = bin->freeRecs;
+    PackFreeRec *splitRecs = bin->splitRecs;
+    int splitCount = 0;
+    int keptCount = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    for (int i = 0; i < bin->freeCount; i++)
+    {
+        PackFreeRec rec = freeRecs[i];
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+        if ((placed.x >= (rec.x + rec.width)) || ((placed.x + placed.width) <= rec.x) ||
+            (placed.y >= (rec.y + rec.height)) || ((placed.y + placed.height) <= rec.y))
+        {
+            freeRecs[keptCount++] = rec;    // No intersection, keep it
+            continue;
+        }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+        if (placed.x > rec.x) splitRecs[splitCount++] = (PackFreeRec){ rec.x, rec.y, placed.x - rec.x, rec.height };
+        if ((placed.x + placed.width) < (rec.x + rec.width)) splitRecs[splitCount++] = (PackFreeRec){ placed.x + placed.width, rec.y, rec.x + rec.width - (placed.x + placed.width), rec.height };
+        if (placed.y > rec.y) splitRecs[splitCount++] = (PackFreeRec){ rec.x, rec.y, rec.width, placed.y - rec.y };
+        if ((placed.y + placed.height) < (rec.y + rec.height)) splitRecs[splitCount++] = (PackFreeRec){ rec.x, placed.y + placed.height, rec.width, rec.y + rec.height - (placed.y + placed.height) };
+    }
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    int freeCount = keptCount;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+    // Add new free rectangles not contained in other free rectangles
+    // NOTE: Kept rectangles can not be contained in new ones (they were not contained in the split ones),
+    // so only new rectangles need to be checked
+    for (int i = 0; i < splitCount; i++)
+    {
+        PackFreeRec rec = splitRecs[i];
+        bool contained = false;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+        for (int j = 0; (j < freeCount) && !contained; j++)
+        {
+            contained = ((rec.x >= freeRecs[j].x) && (rec.y >= freeRecs[j].y) &&
+                         ((rec.x + rec.width) <= (freeRecs[j].x + freeRecs[j].width)) &&
+                         ((rec.y + rec.height) <= (freeRecs[j].y + freeRecs[j].height)));
+        }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+        for (int j = i + 1; (j < splitCount) && !contained; j++)
+        {
+            contained = ((rec.x >= splitRecs[j].x) && (rec.y >= splitRecs[j].y) &&
+                         ((rec.x + rec.width) <= (splitRecs[j].x + splitRecs[j].width)) &&
+                         ((rec.y + rec.height) <= (splitRecs[j].y + splitRecs[j].height)));
+        }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+        if (!contained) freeRecs[freeCount++] = rec;
+    }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+    bin->freeCount = freeCount;
+}
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Get exact colors palette from pixels (translucent pixels only), colors stored in order of appearance
+// NOTE: Colors are checked with a hash set, returns -1 if pixels contain more colors than maxColors
+static int GetPaletteExact(const Color *pixels, int count, Color *palette, int maxColors)
+{
+    int paletteSize = 0;
+    int limit = (maxColors < count)? maxColors : count;
+    int tableSize = 64;
+    while (tableSize < 2*(limit + 1)) tableSize *= 2;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+    // Open addressing hash set of colors (packed), 0 is the empty slot (color alpha is never 0)
+    unsigned int *table = (unsigned int *)RL_CALLOC(tableSize, sizeof(unsigned int));
+    unsigned int mask = (unsigned int)tableSize - 1;
 
-                    k += 4;
-                } break;
-                default: break;
+    for (int i = 0; i < count; i++)
+    {
+        if (pixels[i].a == 0) continue;
+
+        unsigned int key = ((unsigned int)pixels[i].r << 24) | ((unsigned int)pixels[i].g << 16) | ((unsigned int)pixels[i].b << 8) | pixels[i].a;
+        unsigned int slot = (key*2654435761u) & mask;
+
+        while ((table[slot] != 0) && (table[slot] != key)) slot = (slot + 1) & mask;
+
+        if (table[slot] == 0)
+        {
+            if (paletteSize >= maxColors)
+            {
+                paletteSize = -1;
+                break;
             }
+
+            table[slot] = key;
+            palette[paletteSize] = pixels[i];
+            paletteSize++;
         }
     }
 
-    return pixels;
+    RL_FREE(table);
+
+    return paletteSize;
+}
+
+// Compare color quantization bins by sorting value [Used in GenPaletteMedianCut()]
+static int QuantizeBinCompare(const void *a, const void *b)
+{
+    const QuantizeBin *binA = (const QuantizeBin *)a;
+    const QuantizeBin *binB = (const QuantizeBin *)b;
+
+    if (binA->sortValue != binB->sortValue) return (binA->sortValue < binB->sortValue)? -1 : 1;
+    return (binA->key < binB->key)? -1 : ((binA->key > binB->key)? 1 : 0);
+}
+
+// Get color quantization box widest channel and range
+static void GetQuantizeBoxRange(QuantizeBox *box, const QuantizeBin *bins)
+{
+    int minValue[4] = { 255, 255, 255, 255 };
+    int maxValue[4] = { 0 };
+
+    for (int i = box->start; i < (box->start + box->count); i++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            int value = (bins[i].key >> (24 - 8*c)) & 0xff;
+            if (value < minValue[c]) minValue[c] = value;
+            if (value > maxValue[c]) maxValue[c] = value;
+        }
+    }
+
+    box->channel = 0;
+    box->range = -1;
+
+    for (int c = 0; c < 4; c++)
+    {
+        if ((maxValue[c] - minValue[c]) > box->range)
+        {
+            box->range = maxValue[c] - minValue[c];
+            box->channel = c;
+        }
+    }
+}
+
+// Generate reduced colors palette from pixels (translucent pixels only), median cut algorithm
+// NOTE: Pixels are grouped in a RGBA 5 bit per channel histogram, the box with widest channel range (weighted by pixels count)
+// is split at pixels median until maxColors boxes, palette colors are boxes pixels average,
+// pixels are grouped by exact colors if histogram has less cells than maxColors, so maxColors boxes can be split
+// REF: Paul Heckbert, Color Image Quantization for Frame Buffer Display
+static int GenPaletteMedianCut(const Color *pixels, int count, Color *palette, int maxColors)
+{
+    // Histogram bins, bin index stored in bin key slot once bins are compacted
+    unsigned int *histogram = (unsigned int *)RL_CALLOC(1 << 20, sizeof(unsigned int));
+    QuantizeBin *bins = NULL;
+    int binCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (pixels[i].a == 0) continue;
+        histogram[((pixels[i].r >> 3) << 15) | ((pixels[i].g >> 3) << 10) | ((pixels[i].b >> 3) << 5) | (pixels[i].a >> 3)]++;
+    }
+
+    for (int key = 0; key < (1 << 20); key++) if (histogram[key] > 0) binCount++;
+
+    if (binCount >= maxColors)
+    {
+        bins = (QuantizeBin *)RL_CALLOC(binCount, sizeof(QuantizeBin));
+
+        for (int key = 0, k = 0; key < (1 << 20); key++)
+        {
+            if (histogram[key] > 0)
+            {
+                // Cell key stored as RGBA 8 bit per channel (lower bits are 0)
+                bins[k].key = (((key >> 15) & 0x1f) << 27) | (((key >> 10) & 0x1f) << 19) | (((key >> 5) & 0x1f) << 11) | ((key & 0x1f) << 3);
+                bins[k].count = histogram[key];
+                histogram[key] = k;
+                k++;
+            }
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            if (pixels[i].a == 0) continue;
+
+            QuantizeBin *bin = &bins[histogram[((pixels[i].r >> 3) << 15) | ((pixels[i].g >> 3) << 10) | ((pixels[i].b >> 3) << 5) | (pixels[i].a >> 3)]];
+            bin->sum[0] += pixels[i].r;
+            bin->sum[1] += pixels[i].g;
+            bin->sum[2] += pixels[i].b;
+            bin->sum[3] += pixels[i].a;
+        }
+    }
+    else if (binCount > 0)
+    {
+        // NOTE: Every cell contains 8*8*8*8 exact colors at most
+        binCount = GetQuantizeBinsExact(pixels, count, (binCount < (count/4096))? binCount*4096 : count, &bins);
+    }
+
+    RL_FREE(histogram);
+
+    if (binCount == 0)
+    {
+        RL_FREE(bins);
+        return 0;
+    }
+
+    // Boxes split until required colors (or every box is a single bin)
+    QuantizeBox *boxes = (QuantizeBox *)RL_MALLOC(maxColors*sizeof(QuantizeBox));
+    int boxCount = 1;
+
+    boxes[0] = (QuantizeBox){ 0, binCount, 0, 0, 0 };
+    for (int i = 0; i < binCount; i++) boxes[0].pixels += bins[i].count;
+    GetQuantizeBoxRange(&boxes[0], bins);
+
+    while (boxCount < maxColors)
+    {
+        int selected = -1;
+        double bestScore = 0.0;
+
+        for (int i = 0; i < boxCount; i++)
+        {
+            double score = (double)boxes[i].range*(double)boxes[i].pixels;
+            if ((boxes[i].count > 1) && (score > bestScore))
+            {
+                bestScore = score;
+                selected = i;
+            }
+        }
+
+        if (selected == -1) break;
+
+        QuantizeBox *box = &boxes[selected];
+        int shift = 24 - 8*box->channel;
+
+        for (int i = box->start; i < (box->start + box->count); i++) bins[i].sortValue = (bins[i].key >> shift) & 0xff;
+        qsort(bins + box->start, box->count, sizeof(QuantizeBin), QuantizeBinCompare);
+
+        // Split at pixels median, both boxes keep one bin at least
+        unsigned long long half = box->pixels/2;
+        unsigned long long accumulated = 0;
+        int split = 0;
+
+        while (split < (box->count - 1))
+        {
+            accumulated += bins[box->start + split].count;
+            split++;
+            if (accumulated >= half) break;
+        }
+
+        QuantizeBox newBox = { box->start + split, box->count - split, box->pixels - accumulated, 0, 0 };
+        box->count = split;
+        box->pixels = accumulated;
+
+        GetQuantizeBoxRange(box, bins);
+        GetQuantizeBoxRange(&newBox, bins);
+
+        boxes[boxCount] = newBox;
+        boxCount++;
+    }
+
+    for (int i = 0; i < boxCount; i++)
+    {
+        unsigned long long sum[4] = { 0 };
+
+        for (int k = boxes[i].start; k < (boxes[i].start + boxes[i].count); k++)
+        {
+            for (int c = 0; c < 4; c++) sum[c] += bins[k].sum[c];
+        }
+
+        palette[i].r = (unsigned char)((sum[0] + boxes[i].pixels/2)/boxes[i].pixels);
+        palette[i].g = (unsigned char)((sum[1] + boxes[i].pixels/2)/boxes[i].pixels);
+        palette[i].b = (unsigned char)((sum[2] + boxes[i].pixels/2)/boxes[i].pixels);
+        palette[i].a = (unsigned char)((sum[3] + boxes[i].pixels/2)/boxes[i].pixels);
+    }
+
+    RL_FREE(boxes);
+    RL_FREE(bins);
+
+    return boxCount;
+}
+
+// Get color quantization bins for exact colors of pixels (translucent pixels only), returns bins count
+// NOTE: Colors are grouped with a hash table, sized for maxBins colors
+static int GetQuantizeBinsExact(const Color *pixels, int count, int maxBins, QuantizeBin **bins)
+{
+    int binCount = 0;
+    int tableSize = 64;
+    while (tableSize < 2*maxBins) tableSize *= 2;
+
+    // Open addressing hash table of bins indices (+1), 0 is the empty slot
+    int *table = (int *)RL_CALLOC(tableSize, sizeof(int));
+    unsigned int mask = (unsigned int)tableSize - 1;
+    int capacity = 256;
+
+    *bins = (QuantizeBin *)RL_MALLOC(capacity*sizeof(QuantizeBin));
+
+    for (int i = 0; i < count; i++)
+    {
+        if (pixels[i].a == 0) continue;
+
+        unsigned int key = ((unsigned int)pixels[i].r << 24) | ((unsigned int)pixels[i].g << 16) | ((unsigned int)pixels[i].b << 8) | pixels[i].a;
+        unsigned int slot = (key*2654435761u) & mask;
+
+        while ((table[slot] != 0) && ((*bins)[table[slot] - 1].key != key)) slot = (slot + 1) & mask;
+
+        if (table[slot] == 0)
+        {
+            if (binCount == capacity)
+            {
+                capacity *= 2;
+                *bins = (QuantizeBin *)RL_REALLOC(*bins, capacity*sizeof(QuantizeBin));
+            }
+
+            (*bins)[binCount] = (QuantizeBin){ key, 0, 0, { 0 } };
+            binCount++;
+            table[slot] = binCount;
+        }
+
+        QuantizeBin *bin = &(*bins)[table[slot] - 1];
+        bin->count++;
+        bin->sum[0] += pixels[i].r;
+        bin->sum[1] += pixels[i].g;
+        bin->sum[2] += pixels[i].b;
+        bin->sum[3] += pixels[i].a;
+    }
+
+    RL_FREE(table);
+
+    return binCount;
+}
+
+// Map pixels to nearest palette colors indices, optional Floyd-Steinberg dithering
+// NOTE: Transparent pixels can be skipped (index 0, no error diffused)
+static void MapPaletteIndices(const Color *pixels, int width, int height, const Color *palette, int paletteSize, bool dither, bool skipTransparent, unsigned char *indices)
+{
+    PaletteLookup lookup = { 0 };
+    lookup.palette = palette;
+    lookup.paletteSize = paletteSize;
+    lookup.cellStart = (int *)RL_MALLOC((1 << 18)*sizeof(int));
+    for (int i = 0; i < (1 << 18); i++) lookup.cellStart[i] = -1;
+    lookup.cacheColors = (unsigned int *)RL_MALLOC(PALETTE_LOOKUP_CACHE_SIZE*sizeof(unsigned int));
+    lookup.cacheIndices = (short *)RL_MALLOC(PALETTE_LOOKUP_CACHE_SIZE*sizeof(short));
+    for (int i = 0; i < PALETTE_LOOKUP_CACHE_SIZE; i++) lookup.cacheIndices[i] = -1;
+
+    // Dithering errors (x16) diffused to current and next row, one pixel border at both sides
+    int *errors[2] = { NULL, NULL };
+    if (dither)
+    {
+        errors[0] = (int *)RL_CALLOC((width + 2)*4, sizeof(int));
+        errors[1] = (int *)RL_CALLOC((width + 2)*4, sizeof(int));
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        const int *current = errors[0];
+        int *next = errors[1];
+        int right[4] = { 0 };       // Error diffused to next pixel in row
+
+        if (dither) memset(next, 0, 8*sizeof(int));
+
+        for (int x = 0; x < width; x++)
+        {
+            Color color = pixels[y*width + x];
+
+            if (skipTransparent && (color.a == 0))
+            {
+                indices[y*width + x] = 0;
+
+                if (dither)
+                {
+                    for (int c = 0; c < 4; c++) right[c] = 0;
+                    for (int c = 0; c < 4; c++) next[(x + 2)*4 + c] = 0;
+                }
+
+                continue;
+            }
+
+            if (!dither)
+            {
+                indices[y*width + x] = (unsigned char)FindPaletteIndex(&lookup, color);
+                continue;
+            }
+
+            // Add diffused error (rounded)
+            int values[4] = { color.r, color.g, color.b, color.a };
+
+            for (int c = 0; c < 4; c++)
+            {
+                int error = current[(x + 1)*4 + c] + right[c];
+                values[c] += (error + ((error < 0)? -8 : 8))/16;
+                values[c] = (values[c] < 0)? 0 : ((values[c] > 255)? 255 : values[c]);
+            }
+
+            color = (Color){ (unsigned char)values[0], (unsigned char)values[1], (unsigned char)values[2], (unsigned char)values[3] };
+
+            int index = FindPaletteIndex(&lookup, color);
+            indices[y*width + x] = (unsigned char)index;
+
+            // Diffuse error to neighbour pixels (Floyd-Steinberg weights: 7/16 right, 3/16, 5/16, 1/16 next row)
+            const int mapped[4] = { palette[index].r, palette[index].g, palette[index].b, palette[index].a };
+
+            for (int c = 0; c < 4; c++)
+            {
+                int error = values[c] - mapped[c];
+
+                right[c] = error*7;
+                next[x*4 + c] += error*3;
+                next[(x + 1)*4 + c] += error*5;
+                next[(x + 2)*4 + c] = error;      // First error diffused to this pixel
+            }
+        }
+
+        if (dither)
+        {
+            int *temp = errors[0];
+            errors[0] = errors[1];
+            errors[1] = temp;
+        }
+    }
+
+    RL_FREE(errors[0]);
+    RL_FREE(errors[1]);
+    RL_FREE(lookup.cacheIndices);
+    RL_FREE(lookup.cacheColors);
+    RL_FREE(lookup.candidateDistances);
+    RL_FREE(lookup.candidates);
+    RL_FREE(lookup.cellStart);
+}
+
+// Find nearest palette color index (RGBA squared distance)
+// NOTE: Palette colors are only checked against color cell candidates
+static int FindPaletteIndex(PaletteLookup *lookup, Color color)
+{
+    unsigned int packed = ((unsigned int)color.r << 24) | ((unsigned int)color.g << 16) | ((unsigned int)color.b << 8) | color.a;
+    unsigned int slot = (packed*2654435761u) >> (32 - PALETTE_LOOKUP_CACHE_BITS);
+
+    if ((lookup->cacheIndices[slot] >= 0) && (lookup->cacheColors[slot] == packed)) return lookup->cacheIndices[slot];
+
+    int cell = ((color.r >> 3) << 13) | ((color.g >> 3) << 8) | ((color.b >> 3) << 3) | (color.a >> 5);
+
+    if (lookup->cellStart[cell] == -1)
+    {
+        // Compute cell candidates: palette colors with min distance to cell lower than the smallest max distance to cell
+        const int low[4] = { color.r & 0xf8, color.g & 0xf8, color.b & 0xf8, color.a & 0xe0 };
+        const int size[4] = { 7, 7, 7, 31 };
+        int bound = 0x7fffffff;
+
+        for (int i = 0; i < lookup->paletteSize; i++)
+        {
+            const int value[4] = { lookup->palette[i].r, lookup->palette[i].g, lookup->palette[i].b, lookup->palette[i].a };
+            int maxDistance = 0;
+
+            for (int c = 0; c < 4; c++)
+            {
+                int d0 = value[c] - low[c];
+                int d1 = low[c] + size[c] - value[c];
+                maxDistance += (d0*d0 > d1*d1)? d0*d0 : d1*d1;
+            }
+
+            if (maxDistance < bound) bound = maxDistance;
+        }
+
+        if ((lookup->candidateCount + lookup->paletteSize + 1) > lookup->candidateCapacity)
+        {
+            lookup->candidateCapacity = (lookup->candidateCapacity == 0)? 4096 : lookup->candidateCapacity*2;
+            if (lookup->candidateCapacity < (lookup->candidateCount + lookup->paletteSize + 1)) lookup->candidateCapacity = lookup->candidateCount + lookup->paletteSize + 1;
+            lookup->candidates = (unsigned short *)RL_REALLOC(lookup->candidates, lookup->candidateCapacity*sizeof(unsigned short));
+            lookup->candidateDistances = (int *)RL_REALLOC(lookup->candidateDistances, lookup->candidateCapacity*sizeof(int));
+        }
+
+        int start = lookup->candidateCount;
+        int candidates = 0;
+
+        for (int i = 0; i < lookup->paletteSize; i++)
+        {
+            const int value[4] = { lookup->palette[i].r, lookup->palette[i].g, lookup->palette[i].b, lookup->palette[i].a };
+            int minDistance = 0;
+
+            for (int c = 0; c < 4; c++)
+            {
+                int d = (value[c] < low[c])? (low[c] - value[c]) : ((value[c] > (low[c] + size[c]))? (value[c] - low[c] - size[c]) : 0);
+                minDistance += d*d;
+            }
+
+            if (minDistance <= bound)
+            {
+                // Insertion sorted by min distance, nearest candidates checked first
+                int k = start + 1 + candidates;
+                while ((k > (start + 1)) && (lookup->candidateDistances[k - 1] > minDistance))
+                {
+                    lookup->candidates[k] = lookup->candidates[k - 1];
+                    lookup->candidateDistances[k] = lookup->candidateDistances[k - 1];
+                    k--;
+                }
+
+                lookup->candidates[k] = (unsigned short)i;
+                lookup->candidateDistances[k] = minDistance;
+                candidates++;
+            }
+        }
+
+        lookup->candidates[start] = (unsigned short)candidates;
+        lookup->candidateCount += candidates + 1;
+        lookup->cellStart[cell] = start;
+    }
+
+    const unsigned short *candidates = lookup->candidates + lookup->cellStart[cell];
+    const int *candidateDistances = lookup->candidateDistances + lookup->cellStart[cell];
+    int bestIndex = candidates[1];
+    int bestDistance = 0x7fffffff;
+
+    for (int i = 1; i <= candidates[0]; i++)
+    {
+        if (candidateDistances[i] >= bestDistance) break;   // Remaining candidates can not be nearer
+
+        const Color *entry = &lookup->palette[candidates[i]];
+        int dr = (int)entry->r - color.r;
+        int dg = (int)entry->g - color.g;
+        int db = (int)entry->b - color.b;
+        int da = (int)entry->a - color.a;
+        int distance = dr*dr + dg*dg + db*db + da*da;
+
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            bestIndex = candidates[i];
+        }
+    }
+
+    lookup->cacheColors[slot] = packed;
+    lookup->cacheIndices[slot] = (short)bestIndex;
+
+    return bestIndex;
+}
+
+// Blend color into a span of R8G8B8A8 pixels, using per-pixel coverage as source alpha
+// NOTE: Opaque destination pixels are blended as: dst + (color - dst)*alpha, using SIMD (when available) for 4 pixels at once,
+// translucent destination pixels are blended as ColorAlphaBlend() does
+static void BlendColorSpan(unsigned char *dst, const unsigned char *coverage, int count, Color color)
+{
+    int i = 0;
+
+    while (i < count)
+    {
+        int scalarEnd = count;
+
+#if defined(RL_SIMD_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+        const __m128i full = _mm_set1_epi16(256);
+        const __m128i src = _mm_set_epi16(0, color.b, color.g, color.r, 0, color.b, color.g, color.r);
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            unsigned int cov = (unsigned int)coverage[i] | ((unsigned int)coverage[i + 1] << 8) | ((unsigned int)coverage[i + 2] << 16) | ((unsigned int)coverage[i + 3] << 24);
+            if (cov == 0) continue;     // Nothing to blend
+
+            __m128i pixels = _mm_loadu_si128((const __m128i *)(dst + i*4));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(pixels, alphaMask), alphaMask)) != 0xffff) break;  // Translucent pixels, use scalar path
+
+            // Weights in [0..256], alpha channel weight is 0 to keep destination alpha
+            short w0 = coverage[i]? (short)(coverage[i] + 1) : 0;
+            short w1 = coverage[i + 1]? (short)(coverage[i + 1] + 1) : 0;
+            short w2 = coverage[i + 2]? (short)(coverage[i + 2] + 1) : 0;
+            short w3 = coverage[i + 3]? (short)(coverage[i + 3] + 1) : 0;
+            __m128i weightLo = _mm_set_epi16(0, w1, w1, w1, 0, w0, w0, w0);
+            __m128i weightHi = _mm_set_epi16(0, w3, w3, w3, 0, w2, w2, w2);
+
+            __m128i dstLo = _mm_unpacklo_epi8(pixels, zero);
+            __m128i dstHi = _mm_unpackhi_epi8(pixels, zero);
+
+            // NOTE: Sums fit in 16 bit unsigned: src*w + dst*(256 - w) <= 255*256
+            dstLo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(src, weightLo), _mm_mullo_epi16(dstLo, _mm_sub_epi16(full, weightLo))), 8);
+            dstHi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(src, weightHi), _mm_mullo_epi16(dstHi, _mm_sub_epi16(full, weightHi))), 8);
+
+            _mm_storeu_si128((__m128i *)(dst + i*4), _mm_packus_epi16(dstLo, dstHi));
+        }
+
+        scalarEnd = ((i + 4) < count)? (i + 4) : count;     // Only current block (or remaining pixels) processed by scalar path
+#elif defined(RL_SIMD_NEON)
+        const uint32x4_t alphaMask = vdupq_n_u32(0xff000000);
+        const uint16x8_t full = vdupq_n_u16(256);
+        const uint16_t srcValues[8] = { color.r, color.g, color.b, 0, color.r, color.g, color.b, 0 };
+        const uint16x8_t src = vld1q_u16(srcValues);
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            if ((coverage[i] | coverage[i + 1] | coverage[i + 2] | coverage[i + 3]) == 0) continue;     // Nothing to blend
+
+            uint8x16_t pixels = vld1q_u8(dst + i*4);
+            if (vminvq_u32(vceqq_u32(vandq_u32(vreinterpretq_u32_u8(pixels), alphaMask), alphaMask)) != 0xffffffff) break;  // Translucent pixels, use scalar path
+
+            // Weights in [0..256], alpha channel weight is 0 to keep destination alpha
+            uint16_t w[4] = { 0 };
+            for (int k = 0; k < 4; k++) w[k] = coverage[i + k]? (uint16_t)(coverage[i + k] + 1) : 0;
+            const uint16_t weightLoValues[8] = { w[0], w[0], w[0], 0, w[1], w[1], w[1], 0 };
+            const uint16_t weightHiValues[8] = { w[2], w[2], w[2], 0, w[3], w[3], w[3], 0 };
+            uint16x8_t weightLo = vld1q_u16(weightLoValues);
+            uint16x8_t weightHi = vld1q_u16(weightHiValues);
+
+            uint16x8_t dstLo = vmovl_u8(vget_low_u8(pixels));
+            uint16x8_t dstHi = vmovl_u8(vget_high_u8(pixels));
+
+            dstLo = vshrq_n_u16(vaddq_u16(vmulq_u16(src, weightLo), vmulq_u16(dstLo, vsubq_u16(full, weightLo))), 8);
+            dstHi = vshrq_n_u16(vaddq_u16(vmulq_u16(src, weightHi), vmulq_u16(dstHi, vsubq_u16(full, weightHi))), 8);
+
+            vst1q_u8(dst + i*4, vcombine_u8(vmovn_u16(dstLo), vmovn_u16(dstHi)));
+        }
+
+        scalarEnd = ((i + 4) < count)? (i + 4) : count;     // Only current block (or remaining pixels) processed by scalar path
+#endif
+
+        for (; i < scalarEnd; i++)
+        {
+            unsigned int alpha = coverage[i];
+            if (alpha == 0) continue;
+
+            unsigned char *pixel = dst + i*4;
+
+            if (pixel[3] == 255)
+            {
+                // Opaque destination, same result as SIMD path
+                unsigned int weight = alpha + 1;
+                pixel[0] = (unsigned char)((color.r*weight + pixel[0]*(256 - weight)) >> 8);
+                pixel[1] = (unsigned char)((color.g*weight + pixel[1]*(256 - weight)) >> 8);
+                pixel[2] = (unsigned char)((color.b*weight + pixel[2]*(256 - weight)) >> 8);
+            }
+            else if (alpha == 255)
+            {
+                pixel[0] = color.r;
+                pixel[1] = color.g;
+                pixel[2] = color.b;
+                pixel[3] = 255;
+            }
+            else
+            {
+                // Translucent destination, same integer blending as ColorAlphaBlend()
+                unsigned int weight = alpha + 1;
+                unsigned int outAlpha = (weight*256 + (unsigned int)pixel[3]*(256 - weight)) >> 8;
+
+                if (outAlpha > 0)
+                {
+                    pixel[0] = (unsigned char)((((unsigned int)color.r*weight*256 + (unsigned int)pixel[0]*pixel[3]*(256 - weight))/outAlpha) >> 8);
+                    pixel[1] = (unsigned char)((((unsigned int)color.g*weight*256 + (unsigned int)pixel[1]*pixel[3]*(256 - weight))/outAlpha) >> 8);
+                    pixel[2] = (unsigned char)((((unsigned int)color.b*weight*256 + (unsigned int)pixel[2]*pixel[3]*(256 - weight))/outAlpha) >> 8);
+                }
+
+                pixel[3] = (unsigned char)outAlpha;
+            }
+        }
+    }
+}
+
+// Blend a span of R8G8B8A8 source pixels into R8G8B8A8 destination pixels (source over)
+// NOTE: Opaque destination pixels are blended as: dst + (src - dst)*alpha, using SIMD (when available) for 4 pixels at once,
+// translucent destination pixels are blended as ColorAlphaBlend() does
+static void BlendPixelsSpan(unsigned char *dst, const unsigned char *src, int count)
+{
+    int i = 0;
+
+    while (i < count)
+    {
+        int scalarEnd = count;
+
+#if defined(RL_SIMD_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi16(1);
+        const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+        const __m128i colorMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+        const __m128i full = _mm_set1_epi16(256);
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            __m128i source = _mm_loadu_si128((const __m128i *)(src + i*4));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(source, alphaMask), zero)) == 0xffff) continue;    // Nothing to blend
+
+            __m128i pixels = _mm_loadu_si128((const __m128i *)(dst + i*4));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(pixels, alphaMask), alphaMask)) != 0xffff) break;  // Translucent pixels, use scalar path
+
+            __m128i srcLo = _mm_unpacklo_epi8(source, zero);
+            __m128i srcHi = _mm_unpackhi_epi8(source, zero);
+
+            // Weights in [0..256] (alpha + 1, 0 for transparent), alpha channel weight is 0 to keep destination alpha
+            __m128i weightLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            __m128i weightHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            weightLo = _mm_and_si128(_mm_andnot_si128(_mm_cmpeq_epi16(weightLo, zero), _mm_add_epi16(weightLo, one)), colorMask);
+            weightHi = _mm_and_si128(_mm_andnot_si128(_mm_cmpeq_epi16(weightHi, zero), _mm_add_epi16(weightHi, one)), colorMask);
+
+            __m128i dstLo = _mm_unpacklo_epi8(pixels, zero);
+            __m128i dstHi = _mm_unpackhi_epi8(pixels, zero);
+
+            // NOTE: Sums fit in 16 bit unsigned: src*w + dst*(256 - w) <= 255*256
+            dstLo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(srcLo, weightLo), _mm_mullo_epi16(dstLo, _mm_sub_epi16(full, weightLo))), 8);
+            dstHi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(srcHi, weightHi), _mm_mullo_epi16(dstHi, _mm_sub_epi16(full, weightHi))), 8);
+
+            _mm_storeu_si128((__m128i *)(dst + i*4), _mm_packus_epi16(dstLo, dstHi));
+        }
+
+        scalarEnd = ((i + 4) < count)? (i + 4) : count;     // Only current block (or remaining pixels) processed by scalar path
+#elif defined(RL_SIMD_NEON)
+        const uint32x4_t alphaMask = vdupq_n_u32(0xff000000);
+        const uint16x8_t full = vdupq_n_u16(256);
+
+        for (; (i + 4) <= count; i += 4)
+        {
+            if ((src[i*4 + 3] | src[i*4 + 7] | src[i*4 + 11] | src[i*4 + 15]) == 0) continue;    // Nothing to blend
+
+            uint8x16_t pixels = vld1q_u8(dst + i*4);
+            if (vminvq_u32(vceqq_u32(vandq_u32(vreinterpretq_u32_u8(pixels), alphaMask), alphaMask)) != 0xffffffff) break;  // Translucent pixels, use scalar path
+
+            // Weights in [0..256] (alpha + 1, 0 for transparent), alpha channel weight is 0 to keep destination alpha
+            uint16_t w[4] = { 0 };
+            for (int k = 0; k < 4; k++) w[k] = src[(i + k)*4 + 3]? (uint16_t)(src[(i + k)*4 + 3] + 1) : 0;
+            const uint16_t weightLoValues[8] = { w[0], w[0], w[0], 0, w[1], w[1], w[1], 0 };
+            const uint16_t weightHiValues[8] = { w[2], w[2], w[2], 0, w[3], w[3], w[3], 0 };
+            uint16x8_t weightLo = vld1q_u16(weightLoValues);
+            uint16x8_t weightHi = vld1q_u16(weightHiValues);
+
+            uint8x16_t source = vld1q_u8(src + i*4);
+            uint16x8_t srcLo = vmovl_u8(vget_low_u8(source));
+            uint16x8_t srcHi = vmovl_u8(vget_high_u8(source));
+            uint16x8_t dstLo = vmovl_u8(vget_low_u8(pixels));
+            uint16x8_t dstHi = vmovl_u8(vget_high_u8(pixels));
+
+            dstLo = vshrq_n_u16(vaddq_u16(vmulq_u16(srcLo, weightLo), vmulq_u16(dstLo, vsubq_u16(full, weightLo))), 8);
+            dstHi = vshrq_n_u16(vaddq_u16(vmulq_u16(srcHi, weightHi), vmulq_u16(dstHi, vsubq_u16(full, weightHi))), 8);
+
+            vst1q_u8(dst + i*4, vcombine_u8(vmovn_u16(dstLo), vmovn_u16(dstHi)));
+        }
+
+        scalarEnd = ((i + 4) < count)? (i + 4) : count;     // Only current block (or remaining pixels) processed by scalar path
+#endif
+
+        for (; i < scalarEnd; i++)
+        {
+            const unsigned char *source = src + i*4;
+            unsigned int alpha = source[3];
+            if (alpha == 0) continue;
+
+            unsigned char *pixel = dst + i*4;
+
+            if (alpha == 255)
+            {
+                pixel[0] = source[0];
+                pixel[1] = source[1];
+                pixel[2] = source[2];
+                pixel[3] = 255;
+            }
+            else if (pixel[3] == 255)
+            {
+                // Opaque destination, same result as SIMD path
+                unsigned int weight = alpha + 1;
+
+                pixel[0] = (unsigned char)((source[0]*weight + pixel[0]*(256 - weight)) >> 8);
+                pixel[1] = (unsigned char)((source[1]*weight + pixel[1]*(256 - weight)) >> 8);
+                pixel[2] = (unsigned char)((source[2]*weight + pixel[2]*(256 - weight)) >> 8);
+            }
+            else
+            {
+                // Translucent destination, same integer blending as ColorAlphaBlend()
+                unsigned int weight = alpha + 1;
+                unsigned int outAlpha = (weight*256 + (unsigned int)pixel[3]*(256 - weight)) >> 8;
+
+                if (outAlpha > 0)
+                {
+                    pixel[0] = (unsigned char)((((unsigned int)source[0]*weight*256 + (unsigned int)pixel[0]*pixel[3]*(256 - weight))/outAlpha) >> 8);
+                    pixel[1] = (unsigned char)((((unsigned int)source[1]*weight*256 + (unsigned int)pixel[1]*pixel[3]*(256 - weight))/outAlpha) >> 8);
+                    pixel[2] = (unsigned char)((((unsigned int)source[2]*weight*256 + (unsigned int)pixel[2]*pixel[3]*(256 - weight))/outAlpha) >> 8);
+                }
+
+                pixel[3] = (unsigned char)outAlpha;
+            }
+        }
+    }
+}
+
+// Apply color tint to a span of R8G8B8A8 pixels, same as ColorAlphaBlend() tint
+static void TintPixelsSpan(unsigned char *pixels, int count, Color tint)
+{
+    unsigned int r = (unsigned int)tint.r + 1;
+    unsigned int g = (unsigned int)tint.g + 1;
+    unsigned int b = (unsigned int)tint.b + 1;
+    unsigned int a = (unsigned int)tint.a + 1;
+
+    for (int i = 0; i < count*4; i += 4)
+    {
+        pixels[i] = (unsigned char)((pixels[i]*r) >> 8);
+        pixels[i + 1] = (unsigned char)((pixels[i + 1]*g) >> 8);
+        pixels[i + 2] = (unsigned char)((pixels[i + 2]*b) >> 8);
+        pixels[i + 3] = (unsigned char)((pixels[i + 3]*a) >> 8);
+    }
+}
+
+// Draw a span of R8G8B8A8 pixels into destination pixels of any uncompressed format, blended or copied
+// NOTE: Span count must be IMAGE_DRAW_SPAN pixels maximum
+static void DrawPixelsSpan(unsigned char *dst, int dstFormat, const unsigned char *src, int count, bool blend)
+{
+    if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        if (blend) BlendPixelsSpan(dst, src, count);
+        else memcpy(dst, src, count*4);
+    }
+    else if (blend)
+    {
+        unsigned char pixels[IMAGE_DRAW_SPAN*4] = { 0 };
+
+        ConvertPixelsToRGBA8(dst, dstFormat, pixels, count);
+        BlendPixelsSpan(pixels, src, count);
+        ConvertPixelsFromRGBA8(pixels, dst, dstFormat, count);
+    }
+    else ConvertPixelsFromRGBA8(src, dst, dstFormat, count);
+}
+
+// Blend a span of float RGBA source pixels into float RGBA destination pixels (source over)
+// NOTE: Same blending as ColorAlphaBlend() in float precision, source alpha clamped to [0..1] range,
+// color values are not clamped, 4 channels blended at once using SIMD (when available)
+static void BlendPixelsFloatSpan(float *dst, const float *src, int count)
+{
+#if defined(RL_SIMD_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 colorMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+#endif
+
+    for (int i = 0; i < count; i++)
+    {
+        if (!(src[i*4 + 3] > 0.0f)) continue;   // Nothing to blend
+
+    #if defined(RL_SIMD_SSE2)
+        __m128 source = _mm_loadu_ps(src + i*4);
+        __m128 pixel = _mm_loadu_ps(dst + i*4);
+        __m128 srcAlpha = _mm_min_ps(_mm_shuffle_ps(source, source, _MM_SHUFFLE(3, 3, 3, 3)), one);
+        __m128 dstWeight = _mm_mul_ps(_mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3)), _mm_sub_ps(one, srcAlpha));
+        __m128 outAlpha = _mm_add_ps(srcAlpha, dstWeight);
+        __m128 color = _mm_div_ps(_mm_add_ps(_mm_mul_ps(source, srcAlpha), _mm_mul_ps(pixel, dstWeight)), outAlpha);
+
+        // Destination color kept if blended alpha is 0, alpha channel set to blended alpha
+        __m128 valid = _mm_cmpgt_ps(outAlpha, zero);
+        color = _mm_or_ps(_mm_and_ps(valid, color), _mm_andnot_ps(valid, pixel));
+        _mm_storeu_ps(dst + i*4, _mm_or_ps(_mm_and_ps(colorMask, color), _mm_andnot_ps(colorMask, outAlpha)));
+    #else
+        const float *source = src + i*4;
+        float *pixel = dst + i*4;
+        float srcAlpha = (source[3] < 1.0f)? source[3] : 1.0f;
+        float dstWeight = pixel[3]*(1.0f - srcAlpha);
+        float outAlpha = srcAlpha + dstWeight;
+
+        if (outAlpha > 0.0f)
+        {
+            pixel[0] = (source[0]*srcAlpha + pixel[0]*dstWeight)/outAlpha;
+            pixel[1] = (source[1]*srcAlpha + pixel[1]*dstWeight)/outAlpha;
+            pixel[2] = (source[2]*srcAlpha + pixel[2]*dstWeight)/outAlpha;
+        }
+
+        pixel[3] = outAlpha;
+    #endif
+    }
+}
+
+// Apply color tint to a span of float RGBA pixels
+static void TintPixelsFloatSpan(float *pixels, int count, Color tint)
+{
+    float r = (float)tint.r/255.0f;
+    float g = (float)tint.g/255.0f;
+    float b = (float)tint.b/255.0f;
+    float a = (float)tint.a/255.0f;
+
+    for (int i = 0; i < count*4; i += 4)
+    {
+        pixels[i] *= r;
+        pixels[i + 1] *= g;
+        pixels[i + 2] *= b;
+        pixels[i + 3] *= a;
+    }
+}
+
+// Draw a span of float RGBA pixels into destination pixels of any uncompressed format, blended or copied
+// NOTE: Span count must be IMAGE_DRAW_SPAN pixels maximum
+static void DrawPixelsFloatSpan(unsigned char *dst, int dstFormat, const float *src, int count, bool blend)
+{
+    if (blend)
+    {
+        float pixels[IMAGE_DRAW_SPAN*4] = { 0 };
+
+        ConvertPixelsToFloat(dst, dstFormat, pixels, count);
+        BlendPixelsFloatSpan(pixels, src, count);
+        ConvertPixelsFromFloat(pixels, dst, dstFormat, count);
+    }
+    else ConvertPixelsFromFloat(src, dst, dstFormat, count);
+}
+
+// Get color pixel data in provided uncompressed format, same conversion as ImageDrawPixel()
+// NOTE: Pixel buffer must be 16 bytes minimum (R32G32B32A32)
+static void GetPixelColorData(Color color, int format, unsigned char *pixel)
+{
+    Image image = { pixel, 1, 1, 1, format };
+
+    ImageDrawPixel(&image, 0, 0, color);
+}
+
+// Fill a span of pixels repeating provided pixel data
+// NOTE: Repeated data is copied doubling copied size, single byte and 32 bit pixels are stored directly
+static void FillPixelsSpan(unsigned char *dst, const unsigned char *pixel, int bytesPerPixel, int count)
+{
+    if (count <= 0) return;
+
+    if (bytesPerPixel == 1) memset(dst, pixel[0], count);
+    else if (bytesPerPixel == 4)
+    {
+        unsigned int value = 0;
+        memcpy(&value, pixel, 4);
+
+        for (int i = 0; i < count; i++) memcpy(dst + i*4, &value, 4);
+    }
+    else
+    {
+        size_t size = (size_t)count*bytesPerPixel;
+        size_t filled = bytesPerPixel;
+
+        memcpy(dst, pixel, bytesPerPixel);
+
+        while (filled < size)
+        {
+            size_t copy = ((filled*2) <= size)? filled : (size - filled);
+            memcpy(dst + filled, dst, copy);
+            filled += copy;
+        }
+    }
+}
+
+// Clip scanline span [start, end] to pixels on the inner side of a triangle edge
+// NOTE: Edge function is wRow + x*xStep for span pixel x, pixels with edge function >= 0 are inside
+static void GetEdgeSpan(int wRow, int xStep, int *start, int *end)
+{
+    if (xStep > 0)
+    {
+        // Inside from first pixel with wRow + x*xStep >= 0
+        if (wRow < 0)
+        {
+            long long first = (-(long long)wRow + xStep - 1)/xStep;
+            if (first > *start) *start = (first > *end)? (*end + 1) : (int)first;
+        }
+    }
+    else if (xStep < 0)
+    {
+        // Inside up to last pixel with wRow + x*xStep >= 0
+        if (wRow < 0) *end = *start - 1;
+        else
+        {
+            long long last = (long long)wRow/(-(long long)xStep);
+            if (last < *end) *end = (int)last;
+        }
+    }
+    else if (wRow < 0) *end = *start - 1;
+}
+
+// Blend color into a span of image pixels, using per-pixel coverage as source alpha
+// NOTE: R8G8B8A8 pixels are blended directly, other uncompressed formats are converted by IMAGE_DRAW_SPAN pixels
+static void BlendCoverageSpan(Image *dst, int x, int y, const unsigned char *coverage, int count, Color color)
+{
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    unsigned char *pixels = (unsigned char *)dst->data + ((size_t)y*dst->width + x)*bytesPerPixel;
+
+    if (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) BlendColorSpan(pixels, coverage, count, color);
+    else
+    {
+        unsigned char span[IMAGE_DRAW_SPAN*4] = { 0 };
+
+        for (int i = 0; i < count; i += IMAGE_DRAW_SPAN)
+        {
+            int spanCount = ((count - i) < IMAGE_DRAW_SPAN)? (count - i) : IMAGE_DRAW_SPAN;
+
+            ConvertPixelsToRGBA8(pixels + i*bytesPerPixel, dst->format, span, spanCount);
+            BlendColorSpan(span, coverage + i, spanCount, color);
+            ConvertPixelsFromRGBA8(span, pixels + i*bytesPerPixel, dst->format, spanCount);
+        }
+    }
+}
+
+// Fill polygon within an image, anti-aliased edges from exact pixel area coverage (nonzero winding)
+// NOTE: Edges signed area is accumulated in bands of IMAGE_RASTER_BAND scanlines, coverage is the running sum of every scanline,
+// fully covered spans with opaque color are filled, partially covered spans are blended (color alpha scaled by coverage)
+// REF: https://medium.com/@raphlinus/inside-the-fastest-font-renderer-in-the-world-75ae5270c445
+static void ImageFillPolygon(Image *dst, const Vector2 *points, int pointCount, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) || (pointCount < 3) || (color.a == 0)) return;
+
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be drawn");
+        return;
+    }
+
+    // Polygon bounding box, clipped to image
+    float minX = points[0].x, minY = points[0].y, maxX = points[0].x, maxY = points[0].y;
+    for (int i = 1; i < pointCount; i++)
+    {
+        if (points[i].x < minX) minX = points[i].x;
+        if (points[i].y < minY) minY = points[i].y;
+        if (points[i].x > maxX) maxX = points[i].x;
+        if (points[i].y > maxY) maxY = points[i].y;
+    }
+
+    if (!(minX < (float)dst->width) || !(minY < (float)dst->height) || !(maxX > 0.0f) || !(maxY > 0.0f)) return;     // NOTE: NaN coordinates also rejected
+
+    int startX = (minX > 0.0f)? (int)minX : 0;
+    int startY = (minY > 0.0f)? (int)minY : 0;
+    int endX = (maxX < (float)dst->width)? (int)ceilf(maxX) : dst->width;
+    int endY = (maxY < (float)dst->height)? (int)ceilf(maxY) : dst->height;
+    int width = endX - startX;
+    int stride = width + 2;     // Accumulation reaches up to 2 pixels after span end
+
+    float *accum = (float *)RL_CALLOC((size_t)stride*IMAGE_RASTER_BAND, sizeof(float));
+    unsigned char *coverage = (unsigned char *)RL_MALLOC(width);
+
+    // Full coverage spans filled with color pixel data (opaque color only)
+    unsigned char pixel[16] = { 0 };
+    GetPixelColorData(color, dst->format, pixel);
+    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+
+    for (int bandStart = startY; bandStart < endY; bandStart += IMAGE_RASTER_BAND)
+    {
+        int bandEnd = ((bandStart + IMAGE_RASTER_BAND) < endY)? (bandStart + IMAGE_RASTER_BAND) : endY;
+
+        for (int i = 0; i < pointCount; i++)
+        {
+            Vector2 p0 = points[i];
+            Vector2 p1 = points[(i + 1)%pointCount];
+
+            AccumulateEdgeCoverage(accum, stride, bandStart, bandEnd, (Vector2){ p0.x - startX, p0.y }, (Vector2){ p1.x - startX, p1.y }, (float)width);
+        }
+
+        for (int y = bandStart; y < bandEnd; y++)
+        {
+            float *row = accum + (size_t)(y - bandStart)*stride;
+            float sum = 0.0f;
+
+            for (int x = 0; x < width; x++)
+            {
+                sum += row[x];
+                float value = fabsf(sum);
+                coverage[x] = (unsigned char)(((value < 1.0f)? value : 1.0f)*color.a + 0.5f);
+            }
+
+            memset(row, 0, stride*sizeof(float));
+
+            // Draw coverage runs: skip empty, fill full, blend partial
+            for (int x = 0; x < width;)
+            {
+                int runStart = x;
+
+                if (coverage[x] == 0)
+                {
+                    while ((x < width) && (coverage[x] == 0)) x++;
+                }
+                else if (coverage[x] == 255)
+                {
+                    while ((x < width) && (coverage[x] == 255)) x++;
+                    FillPixelsSpan((unsigned char *)dst->data + ((size_t)y*dst->width + startX + runStart)*bytesPerPixel, pixel, bytesPerPixel, x - runStart);
+                }
+                else
+                {
+                    while ((x < width) && (coverage[x] != 0) && (coverage[x] != 255)) x++;
+                    BlendCoverageSpan(dst, startX + runStart, y, coverage + runStart, x - runStart, color);
+                }
+            }
+        }
+    }
+
+    RL_FREE(coverage);
+    RL_FREE(accum);
+}
+
+// Accumulate polygon edge signed area coverage in band scanlines [bandStart, bandEnd)
+// NOTE: Edge x coordinates are relative to accumulation rows start, clipped to [0, maxX]
+static void AccumulateEdgeCoverage(float *accum, int stride, int bandStart, int bandEnd, Vector2 p0, Vector2 p1, float maxX)
+{
+    if (p0.y == p1.y) return;   // Horizontal edges do not add coverage
+
+    float dir = 1.0f;
+    if (p0.y > p1.y)
+    {
+        Vector2 temp = p0;
+        p0 = p1;
+        p1 = temp;
+        dir = -1.0f;
+    }
+
+    if ((p1.y <= (float)bandStart) || (p0.y >= (float)bandEnd)) return;
+
+    float dxdy = (p1.x - p0.x)/(p1.y - p0.y);
+    int rowStart = (p0.y > (float)bandStart)? (int)p0.y : bandStart;
+    int rowEnd = (p1.y < (float)bandEnd)? (int)ceilf(p1.y) : bandEnd;
+
+    for (int y = rowStart; y < rowEnd; y++)
+    {
+        // Edge part inside scanline
+        float top = ((float)y > p0.y)? (float)y : p0.y;
+        float bottom = ((float)(y + 1) < p1.y)? (float)(y + 1) : p1.y;
+        float xTop = p0.x + (top - p0.y)*dxdy;
+        float xBottom = p0.x + (bottom - p0.y)*dxdy;
+
+        AccumulateRowCoverage(accum + (size_t)(y - bandStart)*stride, xTop, xBottom, (bottom - top)*dir, maxX);
+    }
+}
+
+// Accumulate polygon edge signed area coverage in a scanline, edge part from xa to xb with height d (signed)
+// NOTE: Edge parts outside [0, maxX] are split, left parts project on first pixel (covering all scanline) and right parts are discarded
+static void AccumulateRowCoverage(float *row, float xa, float xb, float d, float maxX)
+{
+    if (((xa < 0.0f) && (xb > 0.0f)) || ((xa > 0.0f) && (xb < 0.0f)))
+    {
+        float t = -xa/(xb - xa);
+        AccumulateRowCoverage(row, xa, 0.0f, d*t, maxX);
+        AccumulateRowCoverage(row, 0.0f, xb, d*(1.0f - t), maxX);
+        return;
+    }
+
+    if (((xa < maxX) && (xb > maxX)) || ((xa > maxX) && (xb < maxX)))
+    {
+        float t = (maxX - xa)/(xb - xa);
+        AccumulateRowCoverage(row, xa, maxX, d*t, maxX);
+        AccumulateRowCoverage(row, maxX, xb, d*(1.0f - t), maxX);
+        return;
+    }
+
+    if (xa < 0.0f) xa = 0.0f;
+    if (xb < 0.0f) xb = 0.0f;
+    if (xa > maxX) xa = maxX;
+    if (xb > maxX) xb = maxX;
+
+    float x0 = (xa < xb)? xa : xb;
+    float x1 = (xa < xb)? xb : xa;
+    float x0Floor = floorf(x0);
+    float x1Ceil = ceilf(x1);
+    int x0i = (int)x0Floor;
+    int x1i = (int)x1Ceil;
+
+    if (x1i <= (x0i + 1))
+    {
+        // Edge part inside a single pixel, area to the right of the edge midpoint
+        float xmf = 0.5f*(xa + xb) - x0Floor;
+        row[x0i] += d - d*xmf;
+        row[x0i + 1] += d*xmf;
+    }
+    else
+    {
+        // Edge part crossing multiple pixels, trapezoid areas
+        float s = 1.0f/(x1 - x0);
+        float x0f = x0 - x0Floor;
+        float a0 = 0.5f*s*(1.0f - x0f)*(1.0f - x0f);
+        float x1f = x1 - x1Ceil + 1.0f;
+        float am = 0.5f*s*x1f*x1f;
+
+        row[x0i] += d*a0;
+
+        if (x1i == (x0i + 2)) row[x0i + 1] += d*(1.0f - a0 - am);
+        else
+        {
+            float a1 = s*(1.5f - x0f);
+            row[x0i + 1] += d*(a1 - a0);
+
+            for (int x = x0i + 2; x < (x1i - 1); x++) row[x] += d*s;
+
+            float a2 = a1 + (float)(x1i - x0i - 3)*s;
+            row[x1i - 1] += d*(1.0f - a2 - am);
+        }
+
+        row[x1i] += d*am;
+    }
+}
+
+// Draw source rectangle scaled into destination rectangle, sampling source pixels directly (bilinear)
+// NOTE: Source rectangle must be inside source image, destination rectangle is clipped to destination image,
+// source pixels are filtered weighted by alpha to avoid dark borders around transparent pixels
+static void ImageDrawScaled(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, bool blend)
+{
+    int srcX = (int)srcRec.x;
+    int srcY = (int)srcRec.y;
+    int srcWidth = (int)srcRec.width;
+    int srcHeight = (int)srcRec.height;
+    int dstX = (int)dstRec.x;
+    int dstY = (int)dstRec.y;
+    int dstWidth = (int)dstRec.width;
+    int dstHeight = (int)dstRec.height;
+
+    if ((srcWidth <= 0) || (srcHeight <= 0) || (dstWidth <= 0) || (dstHeight <= 0)) return;
+
+    // Destination pixels range, clipped to destination image
+    int startX = (dstX < 0)? 0 : dstX;
+    int startY = (dstY < 0)? 0 : dstY;
+    int endX = ((dstX + dstWidth) > dst->width)? dst->width : (dstX + dstWidth);
+    int endY = ((dstY + dstHeight) > dst->height)? dst->height : (dstY + dstHeight);
+
+    if ((startX >= endX) || (startY >= endY)) return;
+
+    // Source position of destination pixel centers, 16.16 fixed point
+    long long stepX = ((long long)srcWidth << 16)/dstWidth;
+    long long stepY = ((long long)srcHeight << 16)/dstHeight;
+    long long offsetX = stepX/2 - 32768;
+    long long offsetY = stepY/2 - 32768;
+
+    int bytesPerPixelSrc = GetPixelDataSize(1, 1, src.format);
+    int bytesPerPixelDst = GetPixelDataSize(1, 1, dst->format);
+    bool tinted = ((tint.r < 255) || (tint.g < 255) || (tint.b < 255) || (tint.a < 255));
+    unsigned char span[IMAGE_DRAW_SPAN*4] = { 0 };
+
+    // Source columns range sampled by destination pixels
+    long long firstX = offsetX + (startX - dstX)*stepX;
+    long long lastX = offsetX + (endX - 1 - dstX)*stepX;
+    int first = (firstX < 0)? 0 : (int)(firstX >> 16);
+    int last = (lastX < 0)? 0 : (int)(lastX >> 16) + 1;
+    if (first > (srcWidth - 1)) first = srcWidth - 1;
+    if (last > (srcWidth - 1)) last = srcWidth - 1;
+
+    // Source rows in other formats are converted to R8G8B8A8 once, for any scale ratio,
+    // so all source pixels are sampled and blended the same way (converted rows are reused between lines)
+    unsigned char *buffer = NULL;
+    unsigned char *lines[2] = { NULL, NULL };
+    int linesY[2] = { -1, -1 };
+
+    if (src.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        buffer = (unsigned char *)RL_MALLOC((size_t)(last - first + 1)*4*2);
+        if (buffer == NULL) return;
+        lines[0] = buffer;
+        lines[1] = buffer + (size_t)(last - first + 1)*4;
+    }
+
+    for (int y = startY; y < endY; y++)
+    {
+        long long sy = offsetY + (y - dstY)*stepY;
+        if (sy < 0) sy = 0;
+        int y0 = (int)(sy >> 16);
+        unsigned int wy = (unsigned int)(sy >> 8) & 0xff;
+        if (y0 >= (srcHeight - 1)) { y0 = srcHeight - 1; wy = 0; }
+        int y1 = (wy > 0)? (y0 + 1) : y0;
+
+        // Source R8G8B8A8 lines to sample, starting at first sampled column
+        const unsigned char *line0 = (const unsigned char *)src.data + ((size_t)(srcY + y0)*src.width + srcX + first)*bytesPerPixelSrc;
+        const unsigned char *line1 = (const unsigned char *)src.data + ((size_t)(srcY + y1)*src.width + srcX + first)*bytesPerPixelSrc;
+
+        if (lines[0] != NULL)
+        {
+            if (linesY[0] != y0)
+            {
+                if (linesY[1] == y0)
+                {
+                    // Converted line already available, buffers swapped
+                    unsigned char *temp = lines[0];
+                    lines[0] = lines[1];
+                    lines[1] = temp;
+                    linesY[1] = linesY[0];
+                }
+                else ConvertPixelsToRGBA8(line0, src.format, lines[0], last - first + 1);
+
+                linesY[0] = y0;
+            }
+
+            if ((y1 != y0) && (linesY[1] != y1))
+            {
+                ConvertPixelsToRGBA8(line1, src.format, lines[1], last - first + 1);
+                linesY[1] = y1;
+            }
+
+            line0 = lines[0];
+            line1 = (y1 != y0)? lines[1] : lines[0];
+        }
+
+        unsigned char *pDst = (unsigned char *)dst->data + ((size_t)y*dst->width + startX)*bytesPerPixelDst;
+
+        for (int x = startX; x < endX; x += IMAGE_DRAW_SPAN)
+        {
+            int count = ((endX - x) < IMAGE_DRAW_SPAN)? (endX - x) : IMAGE_DRAW_SPAN;
+
+            for (int i = 0; i < count; i++)
+            {
+                long long sx = offsetX + (x + i - dstX)*stepX;
+                if (sx < 0) sx = 0;
+                int x0 = (int)(sx >> 16);
+                unsigned int wx = (unsigned int)(sx >> 8) & 0xff;
+                if (x0 >= (srcWidth - 1)) { x0 = srcWidth - 1; wx = 0; }
+                int x1 = (wx > 0)? (x0 + 1) : x0;
+
+                Color texels[4] = { 0 };
+                memcpy(&texels[0], line0 + (x0 - first)*4, 4);
+                memcpy(&texels[1], line0 + (x1 - first)*4, 4);
+                memcpy(&texels[2], line1 + (x0 - first)*4, 4);
+                memcpy(&texels[3], line1 + (x1 - first)*4, 4);
+
+                // Bilinear weights, sum is 65536
+                unsigned int weights[4] = { (256 - wx)*(256 - wy), wx*(256 - wy), (256 - wx)*wy, wx*wy };
+                unsigned char *pixel = span + i*4;
+
+                if ((texels[0].a & texels[1].a & texels[2].a & texels[3].a) == 255)
+                {
+                    pixel[0] = (unsigned char)((weights[0]*texels[0].r + weights[1]*texels[1].r + weights[2]*texels[2].r + weights[3]*texels[3].r + 32768) >> 16);
+                    pixel[1] = (unsigned char)((weights[0]*texels[0].g + weights[1]*texels[1].g + weights[2]*texels[2].g + weights[3]*texels[3].g + 32768) >> 16);
+                    pixel[2] = (unsigned char)((weights[0]*texels[0].b + weights[1]*texels[1].b + weights[2]*texels[2].b + weights[3]*texels[3].b + 32768) >> 16);
+                    pixel[3] = 255;
+                }
+                else
+                {
+                    // Alpha weighted filtering
+                    // NOTE: Sums fit in 32 bit unsigned: 65536*255*255 < 2^32
+                    unsigned int alpha = 0, r = 0, g = 0, b = 0;
+
+                    for (int k = 0; k < 4; k++)
+                    {
+                        unsigned int weight = weights[k]*texels[k].a;
+
+                        alpha += weight;
+                        r += (weight >> 8)*texels[k].r;
+                        g += (weight >> 8)*texels[k].g;
+                        b += (weight >> 8)*texels[k].b;
+                    }
+
+                    unsigned int weightSum = alpha >> 8;
+
+                    pixel[3] = (unsigned char)((alpha + 32768) >> 16);
+                    pixel[0] = (weightSum > 0)? (unsigned char)((r + weightSum/2)/weightSum) : 0;
+                    pixel[1] = (weightSum > 0)? (unsigned char)((g + weightSum/2)/weightSum) : 0;
+                    pixel[2] = (weightSum > 0)? (unsigned char)((b + weightSum/2)/weightSum) : 0;
+                }
+            }
+
+            if (tinted) TintPixelsSpan(span, count, tint);
+            DrawPixelsSpan(pDst, dst->format, span, count, blend);
+
+            pDst += count*bytesPerPixelDst;
+        }
+    }
+
+    RL_FREE(buffer);
+}
+
+#if defined(SUPPORT_MODULE_RTEXT)
+// Draw text glyphs directly into R8G8B8A8 image, glyphs are scaled from font base size and blended with tint
+// NOTE: Only supported for fonts with GRAY_ALPHA glyphs (alpha coverage masks), returns false if not supported,
+// text layout follows ImageTextEx(): spacing is defined at base size and line-height is 1.5*baseSize
+static bool ImageDrawTextGlyphs(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    if ((dst->data == NULL) || (dst->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (text == NULL) ||
+        (font.glyphs == NULL) || (font.glyphCount <= 0) || (font.baseSize <= 0) ||
+        (font.glyphs[0].image.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)) return false;
+
+    unsigned char coverage[GLYPH_COVERAGE_SPAN] = { 0 };
+    int size = (int)strlen(text);
+    int textOffsetX = 0;            // Drawing position X (base size units)
+    int textOffsetY = 0;            // Offset between lines (base size units)
+
+    // NOTE: Scale factor computed as ImageTextEx() does, so both paths generate the same text layout
+    Vector2 imSize = MeasureTextEx(font, text, (float)font.baseSize, spacing);  // WARNING: Module required: rtext
+    Vector2 textSize = MeasureTextEx(font, text, fontSize, spacing);
+    float scaleFactor = (imSize.y > 0.0f)? textSize.y/imSize.y : 1.0f;
+
+    // Text drawing area, clipped to destination image
+    int originX = (int)position.x;
+    int originY = (int)position.y;
+    int clipMinX = (originX < 0)? 0 : originX;
+    int clipMinY = (originY < 0)? 0 : originY;
+    int clipMaxX = ((originX + (int)(imSize.x*scaleFactor)) < dst->width)? (originX + (int)(imSize.x*scaleFactor)) : dst->width;
+    int clipMaxY = ((originY + (int)(imSize.y*scaleFactor)) < dst->height)? (originY + (int)(imSize.y*scaleFactor)) : dst->height;
+    bool bilinear = (scaleFactor != 1.0f) && (font.glyphs != GetFontDefault().glyphs);   // Default font scaled with nearest-neighbor
+
+    for (int i = 0; i < size;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &codepointByteCount);    // WARNING: Module required: rtext
+        int index = GetGlyphIndex(font, codepoint);                         // WARNING: Module required: rtext
+
+        if (codepoint == '\n')
+        {
+            textOffsetY += (font.baseSize + font.baseSize/2);
+            textOffsetX = 0;
+        }
+        else
+        {
+            Image glyph = font.glyphs[index].image;
+
+            if ((codepoint != ' ') && (codepoint != '\t') && (glyph.data != NULL) && (glyph.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA))
+            {
+                const unsigned char *glyphData = (const unsigned char *)glyph.data;
+
+                int glyphX = originX + (int)floorf((textOffsetX + font.glyphs[index].offsetX)*scaleFactor + 0.5f);
+                int glyphY = originY + (int)floorf((textOffsetY + font.glyphs[index].offsetY)*scaleFactor + 0.5f);
+                int glyphWidth = (int)(glyph.width*scaleFactor + 0.5f);
+                int glyphHeight = (int)(glyph.height*scaleFactor + 0.5f);
+
+                // Source sampling steps (16.16 fixed point)
+                int stepX = (glyphWidth > 0)? (glyph.width << 16)/glyphWidth : 0;
+                int stepY = (glyphHeight > 0)? (glyph.height << 16)/glyphHeight : 0;
+
+                // Clip glyph rectangle to text drawing area
+                int startX = (glyphX < clipMinX)? (clipMinX - glyphX) : 0;
+                int startY = (glyphY < clipMinY)? (clipMinY - glyphY) : 0;
+                int endX = ((glyphX + glyphWidth) > clipMaxX)? (clipMaxX - glyphX) : glyphWidth;
+                int endY = ((glyphY + glyphHeight) > clipMaxY)? (clipMaxY - glyphY) : glyphHeight;
+
+                for (int y = startY; y < endY; y++)
+                {
+                    unsigned char *dstRow = (unsigned char *)dst->data + ((glyphY + y)*dst->width + glyphX)*4;
+
+                    for (int spanX = startX; spanX < endX; spanX += GLYPH_COVERAGE_SPAN)
+                    {
+                        int spanCount = ((endX - spanX) < GLYPH_COVERAGE_SPAN)? (endX - spanX) : GLYPH_COVERAGE_SPAN;
+
+                        for (int k = 0; k < spanCount; k++)
+                        {
+                            int x = spanX + k;
+                            unsigned int alpha = 0;
+
+                            if (!bilinear) alpha = glyphData[(((y*stepY) >> 16)*glyph.width + ((x*stepX) >> 16))*2 + 1];
+                            else
+                            {
+                                // Sample at pixel centers, out-of-glyph samples are transparent
+                                int u = x*stepX + stepX/2 - 32768;
+                                int v = y*stepY + stepY/2 - 32768;
+                                int u0 = u >> 16;
+                                int v0 = v >> 16;
+                                unsigned int fu = (u >> 8) & 0xff;
+                                unsigned int fv = (v >> 8) & 0xff;
+
+                                unsigned int a00 = ((u0 >= 0) && (v0 >= 0))? glyphData[(v0*glyph.width + u0)*2 + 1] : 0;
+                                unsigned int a10 = ((u0 + 1 < glyph.width) && (v0 >= 0))? glyphData[(v0*glyph.width + u0 + 1)*2 + 1] : 0;
+                                unsigned int a01 = ((u0 >= 0) && (v0 + 1 < glyph.height))? glyphData[((v0 + 1)*glyph.width + u0)*2 + 1] : 0;
+                                unsigned int a11 = ((u0 + 1 < glyph.width) && (v0 + 1 < glyph.height))? glyphData[((v0 + 1)*glyph.width + u0 + 1)*2 + 1] : 0;
+
+                                unsigned int top = a00*(256 - fu) + a10*fu;
+                                unsigned int bottom = a01*(256 - fu) + a11*fu;
+                                alpha = (top*(256 - fv) + bottom*fv) >> 16;
+                            }
+
+                            coverage[k] = (unsigned char)((alpha*((unsigned int)tint.a + 1)) >> 8);
+                        }
+
+                        BlendColorSpan(dstRow + spanX*4, coverage, spanCount, tint);
+                    }
+                }
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += (int)(font.recs[index].width + spacing);
+            else textOffsetX += font.glyphs[index].advanceX + (int)spacing;
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+
+    return true;
+}
+#endif
+
+// Convert half-float (stored as unsigned short) to float
+// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+static float HalfToFloat(unsigned short x)
+{
+    float result = 0.0f;
+
+    const unsigned int e = (x & 0x7C00) >> 10; // Exponent
+    const unsigned int m = (x & 0x03FF) << 13; // Mantissa
+    const float fm = (float)m;
+    const unsigned int v = (*(unsigned int *)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
+    const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
+
+    result = *(float *)&r;
+
+    return result;
+}
+
+// Convert float to half-float (stored as unsigned short)
+static unsigned short FloatToHalf(float x)
+{
+    unsigned short result = 0;
+
+    const unsigned int b = (*(unsigned int *) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
+    const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+
+    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7C00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007FF000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7FFF; // sign : normalized : denormalized : saturate
+
+    return result;
+}
+
+// Convert pixel data from any uncompressed format to R8G8B8A8
+// NOTE: Format switch is resolved once per call, most common formats use SIMD (when available),
+// float and half-float values are clamped to [0..1] range, 16/32 bit single channel formats are converted to red channel
+static void ConvertPixelsToRGBA8(const void *srcData, int srcFormat, unsigned char *dstData, int count)
+{
+    const unsigned char *src = (const unsigned char *)srcData;
+    unsigned char *dst = dstData;
+    int i = 0;
+
+    switch (srcFormat)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst, src, count*4); break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+        #if defined(RL_SIMD_SSE2)
+            const __m128i alpha = _mm_set1_epi8((char)0xff);
+            for (; (i + 16) <= count; i += 16)
+            {
+                __m128i gray = _mm_loadu_si128((const __m128i *)(src + i));
+                __m128i grayGray = _mm_unpacklo_epi8(gray, gray);
+                __m128i grayAlpha = _mm_unpacklo_epi8(gray, alpha);
+                _mm_storeu_si128((__m128i *)(dst + i*4), _mm_unpacklo_epi16(grayGray, grayAlpha));
+                _mm_storeu_si128((__m128i *)(dst + i*4 + 16), _mm_unpackhi_epi16(grayGray, grayAlpha));
+                grayGray = _mm_unpackhi_epi8(gray, gray);
+                grayAlpha = _mm_unpackhi_epi8(gray, alpha);
+                _mm_storeu_si128((__m128i *)(dst + i*4 + 32), _mm_unpacklo_epi16(grayGray, grayAlpha));
+                _mm_storeu_si128((__m128i *)(dst + i*4 + 48), _mm_unpackhi_epi16(grayGray, grayAlpha));
+            }
+        #elif defined(RL_SIMD_NEON)
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x4_t pixels;
+                pixels.val[0] = vld1q_u8(src + i);
+                pixels.val[1] = pixels.val[0];
+                pixels.val[2] = pixels.val[0];
+                pixels.val[3] = vdupq_n_u8(255);
+                vst4q_u8(dst + i*4, pixels);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                dst[i*4] = src[i];
+                dst[i*4 + 1] = src[i];
+                dst[i*4 + 2] = src[i];
+                dst[i*4 + 3] = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+        #if defined(RL_SIMD_SSE2)
+            const __m128i grayMask = _mm_set1_epi16(0x00ff);
+            for (; (i + 8) <= count; i += 8)
+            {
+                __m128i grayAlpha = _mm_loadu_si128((const __m128i *)(src + i*2));
+                __m128i gray = _mm_and_si128(grayAlpha, grayMask);
+                __m128i grayGray = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+                _mm_storeu_si128((__m128i *)(dst + i*4), _mm_unpacklo_epi16(grayGray, grayAlpha));
+                _mm_storeu_si128((__m128i *)(dst + i*4 + 16), _mm_unpackhi_epi16(grayGray, grayAlpha));
+            }
+        #elif defined(RL_SIMD_NEON)
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x2_t grayAlpha = vld2q_u8(src + i*2);
+                uint8x16x4_t pixels;
+                pixels.val[0] = grayAlpha.val[0];
+                pixels.val[1] = grayAlpha.val[0];
+                pixels.val[2] = grayAlpha.val[0];
+                pixels.val[3] = grayAlpha.val[1];
+                vst4q_u8(dst + i*4, pixels);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                dst[i*4] = src[i*2];
+                dst[i*4 + 1] = src[i*2];
+                dst[i*4 + 2] = src[i*2];
+                dst[i*4 + 3] = src[i*2 + 1];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+        #if defined(RL_SIMD_SSE2)
+            // NOTE: 4 pixels (12 bytes) processed as 3 words, x86 is always little-endian
+            for (; (i + 4) <= count; i += 4)
+            {
+                unsigned int words[3] = { 0 };
+                memcpy(words, src + i*3, 12);
+
+                unsigned int pixels[4] = {
+                    words[0] | 0xff000000,
+                    (words[0] >> 24) | (words[1] << 8) | 0xff000000,
+                    (words[1] >> 16) | (words[2] << 16) | 0xff000000,
+                    (words[2] >> 8) | 0xff000000
+                };
+                memcpy(dst + i*4, pixels, 16);
+            }
+        #elif defined(RL_SIMD_NEON)
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x3_t rgb = vld3q_u8(src + i*3);
+                uint8x16x4_t pixels;
+                pixels.val[0] = rgb.val[0];
+                pixels.val[1] = rgb.val[1];
+                pixels.val[2] = rgb.val[2];
+                pixels.val[3] = vdupq_n_u8(255);
+                vst4q_u8(dst + i*4, pixels);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                dst[i*4] = src[i*3];
+                dst[i*4 + 1] = src[i*3 + 1];
+                dst[i*4 + 2] = src[i*3 + 2];
+                dst[i*4 + 3] = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            const unsigned short *pixels = (const unsigned short *)srcData;
+            for (; i < count; i++)
+            {
+                unsigned int r = (pixels[i] >> 11) & 0x1f;
+                unsigned int g = (pixels[i] >> 5) & 0x3f;
+                unsigned int b = pixels[i] & 0x1f;
+
+                // Bits replication to expand to 8 bit range
+                dst[i*4] = (unsigned char)((r << 3) | (r >> 2));
+                dst[i*4 + 1] = (unsigned char)((g << 2) | (g >> 4));
+                dst[i*4 + 2] = (unsigned char)((b << 3) | (b >> 2));
+                dst[i*4 + 3] = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            const unsigned short *pixels = (const unsigned short *)srcData;
+            for (; i < count; i++)
+            {
+                unsigned int r = (pixels[i] >> 11) & 0x1f;
+                unsigned int g = (pixels[i] >> 6) & 0x1f;
+                unsigned int b = (pixels[i] >> 1) & 0x1f;
+
+                dst[i*4] = (unsigned char)((r << 3) | (r >> 2));
+                dst[i*4 + 1] = (unsigned char)((g << 3) | (g >> 2));
+                dst[i*4 + 2] = (unsigned char)((b << 3) | (b >> 2));
+                dst[i*4 + 3] = (pixels[i] & 0x1)? 255 : 0;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            const unsigned short *pixels = (const unsigned short *)srcData;
+            for (; i < count; i++)
+            {
+                dst[i*4] = (unsigned char)(((pixels[i] >> 12) & 0xf)*17);
+                dst[i*4 + 1] = (unsigned char)(((pixels[i] >> 8) & 0xf)*17);
+                dst[i*4 + 2] = (unsigned char)(((pixels[i] >> 4) & 0xf)*17);
+                dst[i*4 + 3] = (unsigned char)((pixels[i] & 0xf)*17);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            const float *pixels = (const float *)srcData;
+            int channels = (srcFormat == PIXELFORMAT_UNCOMPRESSED_R32)? 1 : ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32)? 3 : 4);
+
+            if (channels == 4)
+            {
+            #if defined(RL_SIMD_SSE2)
+                const __m128 scale = _mm_set1_ps(255.0f);
+                const __m128 maxValue = _mm_set1_ps(255.0f);
+                for (; (i + 4) <= count; i += 4)
+                {
+                    // NOTE: _mm_max_ps() returns second operand for NaN values, converted to 0
+                    __m128i p0 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(pixels + i*4), scale), _mm_setzero_ps()), maxValue));
+                    __m128i p1 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(pixels + i*4 + 4), scale), _mm_setzero_ps()), maxValue));
+                    __m128i p2 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(pixels + i*4 + 8), scale), _mm_setzero_ps()), maxValue));
+                    __m128i p3 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(pixels + i*4 + 12), scale), _mm_setzero_ps()), maxValue));
+                    _mm_storeu_si128((__m128i *)(dst + i*4), _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3)));
+                }
+            #elif defined(RL_SIMD_NEON)
+                const float32x4_t maxValue = vdupq_n_f32(255.0f);
+                for (; (i + 4) <= count; i += 4)
+                {
+                    // NOTE: vcvtq_u32_f32() saturates negative and NaN values to 0
+                    uint32x4_t p0 = vcvtq_u32_f32(vminq_f32(vmulq_n_f32(vld1q_f32(pixels + i*4), 255.0f), maxValue));
+                    uint32x4_t p1 = vcvtq_u32_f32(vminq_f32(vmulq_n_f32(vld1q_f32(pixels + i*4 + 4), 255.0f), maxValue));
+                    uint32x4_t p2 = vcvtq_u32_f32(vminq_f32(vmulq_n_f32(vld1q_f32(pixels + i*4 + 8), 255.0f), maxValue));
+                    uint32x4_t p3 = vcvtq_u32_f32(vminq_f32(vmulq_n_f32(vld1q_f32(pixels + i*4 + 12), 255.0f), maxValue));
+                    uint16x8_t lo = vcombine_u16(vmovn_u32(p0), vmovn_u32(p1));
+                    uint16x8_t hi = vcombine_u16(vmovn_u32(p2), vmovn_u32(p3));
+                    vst1q_u8(dst + i*4, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+                }
+            #endif
+            }
+
+            for (; i < count; i++)
+            {
+                for (int c = 0; c < channels; c++)
+                {
+                    float value = pixels[i*channels + c];
+                    dst[i*4 + c] = !(value > 0.0f)? 0 : ((value >= 1.0f)? 255 : (unsigned char)(value*255.0f));
+                }
+
+                if (channels == 1) { dst[i*4 + 1] = 0; dst[i*4 + 2] = 0; }
+                if (channels < 4) dst[i*4 + 3] = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            const unsigned short *pixels = (const unsigned short *)srcData;
+            int channels = (srcFormat == PIXELFORMAT_UNCOMPRESSED_R16)? 1 : ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R16G16B16)? 3 : 4);
+
+            for (; i < count; i++)
+            {
+                for (int c = 0; c < channels; c++)
+                {
+                    // NOTE: Half-float scaled by 255 using integer math, exact as float result (19 significant bits)
+                    unsigned int half = pixels[i*channels + c];
+                    unsigned int exponent = (half >> 10) & 0x1f;
+
+                    if ((half & 0x8000) || (exponent == 0)) dst[i*4 + c] = 0;      // Negative or denormalized (< 1/255)
+                    else if (exponent >= 15) dst[i*4 + c] = 255;
+                    else dst[i*4 + c] = (unsigned char)((((half & 0x3ff) | 0x400)*255) >> (25 - exponent));
+                }
+
+                if (channels == 1) { dst[i*4 + 1] = 0; dst[i*4 + 2] = 0; }
+                if (channels < 4) dst[i*4 + 3] = 255;
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Convert pixel data from R8G8B8A8 to any uncompressed format
+// NOTE: Results match ImageFormat() float conversion: 5/6/4 bit channels are rounded,
+// grayscale luminance uses fixed-point BT.601 weights and single channel float formats store luminance
+static void ConvertPixelsFromRGBA8(const unsigned char *srcData, void *dstData, int dstFormat, int count)
+{
+    const unsigned char *src = srcData;
+    unsigned char *dst = (unsigned char *)dstData;
+    int i = 0;
+
+    switch (dstFormat)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst, src, count*4); break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (; i < count; i++) dst[i] = (unsigned char)((src[i*4]*19595 + src[i*4 + 1]*38470 + src[i*4 + 2]*7471) >> 16);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (; i < count; i++)
+            {
+                dst[i*2] = (unsigned char)((src[i*4]*19595 + src[i*4 + 1]*38470 + src[i*4 + 2]*7471) >> 16);
+                dst[i*2 + 1] = src[i*4 + 3];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+        #if defined(RL_SIMD_SSE2)
+            // NOTE: 4 pixels (16 bytes) processed into 3 words, x86 is always little-endian
+            for (; (i + 4) <= count; i += 4)
+            {
+                unsigned int pixels[4] = { 0 };
+                memcpy(pixels, src + i*4, 16);
+
+                unsigned int words[3] = {
+                    (pixels[0] & 0x00ffffff) | (pixels[1] << 24),
+                    ((pixels[1] >> 8) & 0x0000ffff) | (pixels[2] << 16),
+                    ((pixels[2] >> 16) & 0x000000ff) | (pixels[3] << 8)
+                };
+                memcpy(dst + i*3, words, 12);
+            }
+        #elif defined(RL_SIMD_NEON)
+            for (; (i + 16) <= count; i += 16)
+            {
+                uint8x16x4_t pixels = vld4q_u8(src + i*4);
+                uint8x16x3_t rgb;
+                rgb.val[0] = pixels.val[0];
+                rgb.val[1] = pixels.val[1];
+                rgb.val[2] = pixels.val[2];
+                vst3q_u8(dst + i*3, rgb);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                dst[i*3] = src[i*4];
+                dst[i*3 + 1] = src[i*4 + 1];
+                dst[i*3 + 2] = src[i*4 + 2];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            unsigned short *pixels = (unsigned short *)dstData;
+            for (; i < count; i++)
+            {
+                // NOTE: (v*max + 127)/255 is equivalent to round(v/255*max), no ties possible
+                unsigned int r = (src[i*4]*31 + 127)/255;
+                unsigned int g = (src[i*4 + 1]*63 + 127)/255;
+                unsigned int b = (src[i*4 + 2]*31 + 127)/255;
+
+                pixels[i] = (unsigned short)(r << 11 | g << 5 | b);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            unsigned short *pixels = (unsigned short *)dstData;
+            for (; i < count; i++)
+            {
+                unsigned int r = (src[i*4]*31 + 127)/255;
+                unsigned int g = (src[i*4 + 1]*31 + 127)/255;
+                unsigned int b = (src[i*4 + 2]*31 + 127)/255;
+                unsigned int a = (src[i*4 + 3] > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+
+                pixels[i] = (unsigned short)(r << 11 | g << 6 | b << 1 | a);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned short *pixels = (unsigned short *)dstData;
+            for (; i < count; i++)
+            {
+                unsigned int r = (src[i*4]*15 + 127)/255;
+                unsigned int g = (src[i*4 + 1]*15 + 127)/255;
+                unsigned int b = (src[i*4 + 2]*15 + 127)/255;
+                unsigned int a = (src[i*4 + 3]*15 + 127)/255;
+
+                pixels[i] = (unsigned short)(r << 12 | g << 8 | b << 4 | a);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            float *pixels = (float *)dstData;
+            for (; i < count; i++) pixels[i] = (float)src[i*4]/255.0f*0.299f + (float)src[i*4 + 1]/255.0f*0.587f + (float)src[i*4 + 2]/255.0f*0.114f;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            float *pixels = (float *)dstData;
+            int channels = (dstFormat == PIXELFORMAT_UNCOMPRESSED_R32G32B32)? 3 : 4;
+
+            if (channels == 4)
+            {
+            #if defined(RL_SIMD_SSE2)
+                const __m128i zero = _mm_setzero_si128();
+                const __m128 maxValue = _mm_set1_ps(255.0f);
+                for (; (i + 4) <= count; i += 4)
+                {
+                    __m128i values = _mm_loadu_si128((const __m128i *)(src + i*4));
+                    __m128i lo = _mm_unpacklo_epi8(values, zero);
+                    __m128i hi = _mm_unpackhi_epi8(values, zero);
+                    _mm_storeu_ps(pixels + i*4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), maxValue));
+                    _mm_storeu_ps(pixels + i*4 + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), maxValue));
+                    _mm_storeu_ps(pixels + i*4 + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), maxValue));
+                    _mm_storeu_ps(pixels + i*4 + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), maxValue));
+                }
+            #elif defined(RL_SIMD_NEON)
+                const float32x4_t maxValue = vdupq_n_f32(255.0f);
+                for (; (i + 4) <= count; i += 4)
+                {
+                    uint8x16_t values = vld1q_u8(src + i*4);
+                    uint16x8_t lo = vmovl_u8(vget_low_u8(values));
+                    uint16x8_t hi = vmovl_u8(vget_high_u8(values));
+                    vst1q_f32(pixels + i*4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), maxValue));
+                    vst1q_f32(pixels + i*4 + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), maxValue));
+                    vst1q_f32(pixels + i*4 + 8, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), maxValue));
+                    vst1q_f32(pixels + i*4 + 12, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), maxValue));
+                }
+            #endif
+            }
+
+            for (; i < count; i++)
+            {
+                for (int c = 0; c < channels; c++) pixels[i*channels + c] = (float)src[i*4 + c]/255.0f;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            unsigned short *pixels = (unsigned short *)dstData;
+
+            if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R16)
+            {
+                for (; i < count; i++) pixels[i] = FloatToHalf((float)src[i*4]/255.0f*0.299f + (float)src[i*4 + 1]/255.0f*0.587f + (float)src[i*4 + 2]/255.0f*0.114f);
+            }
+            else
+            {
+                // Only 256 possible values per channel, half-float conversion table computed once per call
+                unsigned short halfValues[256] = { 0 };
+                for (int v = 0; v < 256; v++) halfValues[v] = FloatToHalf((float)v/255.0f);
+
+                int channels = (dstFormat == PIXELFORMAT_UNCOMPRESSED_R16G16B16)? 3 : 4;
+                for (; i < count; i++)
+                {
+                    for (int c = 0; c < channels; c++) pixels[i*channels + c] = halfValues[src[i*4 + c]];
+                }
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Convert pixel data between uncompressed formats, using R8G8B8A8 as intermediate format if required
+// WARNING: Precision is limited to 8 bit per channel, float and half-float conversions between them should not use it
+static void ConvertPixels(const void *srcData, int srcFormat, void *dstData, int dstFormat, int count)
+{
+    if (srcFormat == dstFormat) memcpy(dstData, srcData, GetPixelDataSize(count, 1, srcFormat));
+    else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ConvertPixelsToRGBA8(srcData, srcFormat, (unsigned char *)dstData, count);
+    else if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ConvertPixelsFromRGBA8((const unsigned char *)srcData, dstData, dstFormat, count);
+    else
+    {
+        // Convert by chunks using a small R8G8B8A8 buffer, no full image intermediate required
+        unsigned char buffer[PIXELS_CONVERT_CHUNK*4] = { 0 };
+        int srcBytesPerPixel = GetPixelDataSize(1, 1, srcFormat);
+        int dstBytesPerPixel = GetPixelDataSize(1, 1, dstFormat);
+
+        for (int i = 0; i < count; i += PIXELS_CONVERT_CHUNK)
+        {
+            int chunkCount = ((count - i) < PIXELS_CONVERT_CHUNK)? (count - i) : PIXELS_CONVERT_CHUNK;
+
+            ConvertPixelsToRGBA8((const unsigned char *)srcData + i*srcBytesPerPixel, srcFormat, buffer, chunkCount);
+            ConvertPixelsFromRGBA8(buffer, (unsigned char *)dstData + i*dstBytesPerPixel, dstFormat, chunkCount);
+        }
+    }
+}
+
+// Check if pixel format stores float or half-float channels (high dynamic range)
+static bool IsPixelFormatHDR(int format)
+{
+    return ((format == PIXELFORMAT_UNCOMPRESSED_R32) || (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
+            (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) || (format == PIXELFORMAT_UNCOMPRESSED_R16) ||
+            (format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) || (format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16));
+}
+
+// Convert pixel data from any uncompressed format to float RGBA (R32G32B32A32)
+// NOTE: Float and half-float values are not clamped, single channel float formats are expanded to gray
+// (luminance stored back by ConvertPixelsFromFloat() recovers the value), other formats converted by R8G8B8A8 chunks
+static void ConvertPixelsToFloat(const void *srcData, int srcFormat, float *dstData, int count)
+{
+    float *dst = dstData;
+
+    switch (srcFormat)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: memcpy(dst, srcData, (size_t)count*4*sizeof(float)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            const float *pixels = (const float *)srcData;
+
+            for (int i = 0; i < count; i++)
+            {
+                dst[i*4] = pixels[i*3];
+                dst[i*4 + 1] = pixels[i*3 + 1];
+                dst[i*4 + 2] = pixels[i*3 + 2];
+                dst[i*4 + 3] = 1.0f;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            const float *pixels = (const float *)srcData;
+
+            for (int i = 0; i < count; i++)
+            {
+                dst[i*4] = pixels[i];
+                dst[i*4 + 1] = pixels[i];
+                dst[i*4 + 2] = pixels[i];
+                dst[i*4 + 3] = 1.0f;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            const unsigned short *pixels = (const unsigned short *)srcData;
+            int channels = (srcFormat == PIXELFORMAT_UNCOMPRESSED_R16)? 1 : ((srcFormat == PIXELFORMAT_UNCOMPRESSED_R16G16B16)? 3 : 4);
+            int total = count*channels;
+            int i = 0;
+
+            // Channels converted in place at the end of destination buffer, then expanded to RGBA (forward, no overlap)
+            float *values = (channels == 4)? dst : dst + (size_t)count*4 - total;
+
+        #if defined(RL_SIMD_SSE2)
+            // Half-float exponent rebiased by float multiply, denormalized values included, infinity and NaN exponent restored
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i maskNoSign = _mm_set1_epi32(0x7fff);
+            const __m128i wasInfNan = _mm_set1_epi32(0x7bff);
+            const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+            const __m128 expInfNan = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+
+            for (; (i + 4) <= total; i += 4)
+            {
+                __m128i half = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(pixels + i)), zero);
+                __m128i expMant = _mm_and_si128(half, maskNoSign);
+                __m128 sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_xor_si128(half, expMant), 16));
+                __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMant, 13)), magic);
+                __m128 infNan = _mm_and_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(expMant, wasInfNan)), expInfNan);
+
+                _mm_storeu_ps(values + i, _mm_or_ps(scaled, _mm_or_ps(sign, infNan)));
+            }
+        #endif
+            for (; i < total; i++) values[i] = HalfToFloat(pixels[i]);
+
+            if (channels == 3)
+            {
+                for (int p = 0; p < count; p++)
+                {
+                    float r = values[p*3], g = values[p*3 + 1], b = values[p*3 + 2];
+                    dst[p*4] = r;
+                    dst[p*4 + 1] = g;
+                    dst[p*4 + 2] = b;
+                    dst[p*4 + 3] = 1.0f;
+                }
+            }
+            else if (channels == 1)
+            {
+                for (int p = 0; p < count; p++)
+                {
+                    float value = values[p];
+                    dst[p*4] = value;
+                    dst[p*4 + 1] = value;
+                    dst[p*4 + 2] = value;
+                    dst[p*4 + 3] = 1.0f;
+                }
+            }
+        } break;
+        default:
+        {
+            // Low dynamic range formats, converted by chunks using a small R8G8B8A8 buffer
+            unsigned char buffer[PIXELS_CONVERT_CHUNK*4] = { 0 };
+            int bytesPerPixel = GetPixelDataSize(1, 1, srcFormat);
+
+            for (int i = 0; i < count; i += PIXELS_CONVERT_CHUNK)
+            {
+                int chunkCount = ((count - i) < PIXELS_CONVERT_CHUNK)? (count - i) : PIXELS_CONVERT_CHUNK;
+
+                ConvertPixelsToRGBA8((const unsigned char *)srcData + (size_t)i*bytesPerPixel, srcFormat, buffer, chunkCount);
+                ConvertPixelsFromRGBA8(buffer, dst + (size_t)i*4, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, chunkCount);
+            }
+        } break;
+    }
+}
+
+// Convert pixel data from float RGBA (R32G32B32A32) to any uncompressed format
+// NOTE: Single channel float formats store luminance, low dynamic range formats are clamped to [0..1] range
+static void ConvertPixelsFromFloat(const float *srcData, void *dstData, int dstFormat, int count)
+{
+    const float *src = srcData;
+
+    switch (dstFormat)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: memcpy(dstData, src, (size_t)count*4*sizeof(float)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            float *pixels = (float *)dstData;
+
+            for (int i = 0; i < count; i++)
+            {
+                pixels[i*3] = src[i*4];
+                pixels[i*3 + 1] = src[i*4 + 1];
+                pixels[i*3 + 2] = src[i*4 + 2];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            float *pixels = (float *)dstData;
+            for (int i = 0; i < count; i++) pixels[i] = src[i*4]*0.299f + src[i*4 + 1]*0.587f + src[i*4 + 2]*0.114f;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            unsigned short *pixels = (unsigned short *)dstData;
+            for (int i = 0; i < count*4; i++) pixels[i] = FloatToHalf(src[i]);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            unsigned short *pixels = (unsigned short *)dstData;
+
+            for (int i = 0; i < count; i++)
+            {
+                pixels[i*3] = FloatToHalf(src[i*4]);
+                pixels[i*3 + 1] = FloatToHalf(src[i*4 + 1]);
+                pixels[i*3 + 2] = FloatToHalf(src[i*4 + 2]);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            unsigned short *pixels = (unsigned short *)dstData;
+            for (int i = 0; i < count; i++) pixels[i] = FloatToHalf(src[i*4]*0.299f + src[i*4 + 1]*0.587f + src[i*4 + 2]*0.114f);
+        } break;
+        default:
+        {
+            // Low dynamic range formats, converted by chunks using a small R8G8B8A8 buffer
+            unsigned char buffer[PIXELS_CONVERT_CHUNK*4] = { 0 };
+            int bytesPerPixel = GetPixelDataSize(1, 1, dstFormat);
+
+            for (int i = 0; i < count; i += PIXELS_CONVERT_CHUNK)
+            {
+                int chunkCount = ((count - i) < PIXELS_CONVERT_CHUNK)? (count - i) : PIXELS_CONVERT_CHUNK;
+
+                ConvertPixelsToRGBA8(src + (size_t)i*4, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, buffer, chunkCount);
+                ConvertPixelsFromRGBA8(buffer, (unsigned char *)dstData + (size_t)i*bytesPerPixel, dstFormat, chunkCount);
+            }
+        } break;
+    }
+}
+
+// Get pixel data from image as Vector4 array (float normalized)
+static Vector4 *LoadImageDataNormalized(Image image)
+{
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else if ((image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+             (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+             (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32))
+    {
+        // Vector4 array matches R32G32B32A32 layout, 8 bit per channel formats converted without precision loss
+        ConvertPixels(image.data, image.format, pixels, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, image.width*image.height);
+    }
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].x = ((float *)image.data)[i];
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = ((float *)image.data)[k + 3];
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[i]);
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
+                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
+                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
+                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+
+                    k += 4;
+                } break;
+                default: break;
+            }
+        }
+    }
+
+    return pixels;
+}
+
+// Resize output splits [Used in ResizePixels()]
+static void ResizeBatch(int start, int end, void *data)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)data, start, end - start);
+}
+
+// Resize pixels with 8 bit, half-float or float channels (stbir_datatype), output splits processed by worker threads
+// NOTE: Same result as stbir_resize_uint8_linear() for 8 bit channels, independently of the number of splits,
+// float and half-float values are filtered without clamping
+static void ResizePixels(const void *input, int width, int height, void *output, int newWidth, int newHeight, int channels, int type)
+{
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels, (stbir_datatype)type);
+
+    ResizeExtended(&resize, newWidth*newHeight);
+}
+
+// Resize with stbir resize configuration, output splits processed by worker threads
+static void ResizeExtended(STBIR_RESIZE *resize, int outputPixels)
+{
+    int splits = (outputPixels >= 2*IMAGE_PARALLEL_MIN_PIXELS)? GetWorkerThreadCount() : 1;
+
+    if (splits > 1)
+    {
+        splits = stbir_build_samplers_with_splits(resize, splits);
+        if (splits > 0) ParallelFor(splits, 1, ResizeBatch, resize);
+        stbir_free_samplers(resize);
+    }
+    else stbir_resize_extended(resize);
+}
+
+// Unload image data, file mappings are released, allocated data is freed
+static void UnloadImageData(void *data)
+{
+    if (data == NULL) return;
+
+#if defined(SUPPORT_IMAGE_MAPPING)
+    void *mapping = NULL;
+    int mappingSize = 0;
+
+    LockAsyncTasks();
+    for (int i = 0; i < MAX_MAPPED_IMAGES; i++)
+    {
+        if ((mappedImages[i].mapping != NULL) && (mappedImages[i].data == data))
+        {
+            mapping = mappedImages[i].mapping;
+            mappingSize = mappedImages[i].mappingSize;
+            mappedImages[i] = (MappedImage){ 0 };
+            break;
+        }
+    }
+    UnlockAsyncTasks();
+
+    if (mapping != NULL)
+    {
+        UnmapFileData(mapping, mappingSize);
+        return;
+    }
+#endif
+
+    RL_FREE(data);
+}
+
+#if defined(SUPPORT_IMAGE_CACHE)
+// Compute data 64 bit hash (non cryptographic), four independent lanes of 8 bytes per step
+// NOTE: Hash depends on platform endianness, only used for local cache files
+static unsigned long long ComputeHash64(const unsigned char *data, int dataSize, unsigned long long seed)
+{
+    const unsigned long long prime1 = 0x9e3779b185ebca87ULL;
+    const unsigned long long prime2 = 0xc2b2ae3d27d4eb4fULL;
+    unsigned long long lanes[4] = { seed + prime1 + prime2, seed + prime2, seed, seed - prime1 };
+    int i = 0;
+
+    for (; (i + 32) <= dataSize; i += 32)
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            unsigned long long value = 0;
+            memcpy(&value, data + i + k*8, 8);
+
+            lanes[k] += value*prime2;
+            lanes[k] = ((lanes[k] << 31) | (lanes[k] >> 33))*prime1;
+        }
+    }
+
+    unsigned long long hash = ((unsigned long long)dataSize*prime1) ^ lanes[0] ^ ((lanes[1] << 7) | (lanes[1] >> 57)) ^
+                              ((lanes[2] << 12) | (lanes[2] >> 52)) ^ ((lanes[3] << 18) | (lanes[3] >> 46));
+
+    for (; i < dataSize; i++)
+    {
+        hash = (hash ^ data[i])*prime1;
+        hash = (hash << 11) | (hash >> 53);
+    }
+
+    // Final mix, all input bits affect all output bits
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime1;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+// Load image cache file, file header must match entry (NULL data: not cached or not matching entry)
+// NOTE: Cached image data is memory mapped if possible
+static Image LoadImageCacheFile(const char *fileName, const ImageCacheHeader *entry)
+{
+    Image image = { 0 };
+
+    if (!FileExists(fileName)) return image;
+
+    int dataSize = 0;
+    unsigned char *fileData = NULL;
+    bool mapped = false;
+
+#if defined(SUPPORT_IMAGE_MAPPING)
+    fileData = (unsigned char *)MapFileData(fileName, &dataSize);
+    mapped = (fileData != NULL);
+#endif
+    if (fileData == NULL) fileData = LoadFileData(fileName, &dataSize);
+    if (fileData == NULL) return image;
+
+    ImageCacheHeader header = { 0 };
+    if (dataSize >= (int)sizeof(ImageCacheHeader)) memcpy(&header, fileData, sizeof(ImageCacheHeader));
+
+    // Security check: image parameters in range (up to 32 mipmaps levels for int dimensions),
+    // image data size matching image parameters and file size, computed in 64 bit (no overflow)
+    bool validImage = (header.imageWidth > 0) && (header.imageHeight > 0) && (((long long)header.imageWidth*header.imageHeight) <= (INT_MAX/16)) &&
+        (header.imageFormat >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (header.imageFormat <= PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) &&
+        (header.imageMipmaps > 0) && (header.imageMipmaps <= 32);
+
+    long long size = 0;
+    for (int i = 0, width = header.imageWidth, height = header.imageHeight; validImage && (i < header.imageMipmaps) && (size <= header.dataSize); i++)
+    {
+        size += GetPixelDataSize(width, height, header.imageFormat);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    bool valid = (memcmp(header.id, "rIMC", 4) == 0) && (header.version == entry->version) && (header.key == entry->key) &&
+        (header.sourceHash == entry->sourceHash) && (header.sourceSize == entry->sourceSize) &&
+        (header.width == entry->width) && (header.height == entry->height) && (header.format == entry->format) && (header.mipmaps == entry->mipmaps) &&
+        validImage && (header.dataSize > 0) && (size == header.dataSize) && (header.dataSize == (dataSize - (int)sizeof(ImageCacheHeader)));
+
+#if defined(SUPPORT_IMAGE_MAPPING)
+    if (valid && mapped)
+    {
+        // Mapping released with image data, or on failure (max mapped images reached)
+        image = LoadImageMappedData(fileName, fileData, dataSize, sizeof(ImageCacheHeader), header.imageWidth, header.imageHeight, header.imageFormat, header.imageMipmaps);
+        if (image.data != NULL) return image;
+
+        fileData = LoadFileData(fileName, &dataSize);
+        mapped = false;
+        valid = (fileData != NULL) && (dataSize == (header.dataSize + (int)sizeof(ImageCacheHeader)));
+    }
+#endif
+
+    if (valid) image.data = RL_MALLOC(header.dataSize);
+
+    if (image.data != NULL)
+    {
+        memcpy(image.data, fileData + sizeof(ImageCacheHeader), header.dataSize);
+        image.width = header.imageWidth;
+        image.height = header.imageHeight;
+        image.format = header.imageFormat;
+        image.mipmaps = header.imageMipmaps;
+    }
+
+    if (mapped) UnmapFileData(fileData, dataSize);
+    else UnloadFileData(fileData);
+
+    return image;
+}
+
+// Save image cache file: header and image data (all mipmaps)
+// NOTE: File written with a temporary name and renamed, cache files mapped by other images are not modified
+static bool SaveImageCacheFile(const char *fileName, const ImageCacheHeader *entry, Image image)
+{
+    ImageCacheHeader header = *entry;
+    memcpy(header.id, "rIMC", 4);
+    header.imageWidth = image.width;
+    header.imageHeight = image.height;
+    header.imageFormat = image.format;
+    header.imageMipmaps = image.mipmaps;
+    header.dataSize = 0;
+
+    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    {
+        header.dataSize += GetPixelDataSize(width, height, image.format);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    char tempFileName[MAX_FILEPATH_LENGTH + 64] = { 0 };
+    snprintf(tempFileName, sizeof(tempFileName), "%s.%llx.tmp", fileName, (unsigned long long)(size_t)image.data);
+
+    FILE *file = fopen(tempFileName, "wb");
+    if (file == NULL) return false;
+
+    bool success = (fwrite(&header, sizeof(ImageCacheHeader), 1, file) == 1) && (fwrite(image.data, 1, header.dataSize, file) == (size_t)header.dataSize);
+    success = (fclose(file) == 0) && success;
+#if defined(_WIN32)
+    // NOTE: On Windows rename() fails if target file exists, it must be removed first
+    if (success && FileExists(fileName)) remove(fileName);
+#endif
+    success = success && (rename(tempFileName, fileName) == 0);
+
+    if (!success) remove(tempFileName);
+
+    return success;
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_MAPPING)
+// Load image pointing to file mapping data, mapping is registered to be released on image unloading
+// NOTE: Mapping is released if image can not be registered (max mapped images reached)
+static Image LoadImageMappedData(const char *fileName, void *mapping, int mappingSize, int offset, int width, int height, int format, int mipmaps)
+{
+    Image image = { 0 };
+    int index = -1;
+
+    LockAsyncTasks();
+    for (int i = 0; i < MAX_MAPPED_IMAGES; i++)
+    {
+        if (mappedImages[i].mapping == NULL)
+        {
+            mappedImages[i].mapping = mapping;
+            mappedImages[i].mappingSize = mappingSize;
+            mappedImages[i].data = (unsigned char *)mapping + offset;
+            index = i;
+            break;
+        }
+    }
+    UnlockAsyncTasks();
+
+    if (index >= 0)
+    {
+        image.data = (unsigned char *)mapping + offset;
+        image.width = width;
+        image.height = height;
+        image.format = format;
+        image.mipmaps = mipmaps;
+
+        TRACELOG(LOG_INFO, "IMAGE: [%s] Data mapped successfully (%ix%i | %s)", fileName, width, height, rlGetPixelFormatName(format));
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Max mapped images reached (%i), image data is loaded", fileName, MAX_MAPPED_IMAGES);
+        UnmapFileData(mapping, mappingSize);
+    }
+
+    return image;
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Check if image data is memory mapped [Used in ImageMipmapsEx()]
+static bool IsImageDataMapped(const void *data)
+{
+    bool result = false;
+
+    if (data == NULL) return result;
+
+    LockAsyncTasks();
+    for (int i = 0; i < MAX_MAPPED_IMAGES; i++)
+    {
+        if ((mappedImages[i].mapping != NULL) && (mappedImages[i].data == data))
+        {
+            result = true;
+            break;
+        }
+    }
+    UnlockAsyncTasks();
+
+    return result;
+}
+#endif
+#endif
+
+#if defined(PNG_SCANLINES_REQUIRED)
+#if defined(SUPPORT_FILEFORMAT_PNG)
+// Read PNG signature and header chunk (33 bytes), scanline layout computed
+// NOTE: Interlaced images are valid, scanlines layout only used for non interlaced images
+static bool ReadHeaderPNG(PNGInfo *info, const unsigned char *header)
+{
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a };
+
+    if ((memcmp(header, signature, 8) != 0) || (memcmp(header + 12, "IHDR", 4) != 0)) return false;
+
+    unsigned int width = ((unsigned int)header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+    unsigned int height = ((unsigned int)header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+    int bitDepth = header[24];
+    bool valid = true;
+
+    switch (header[25])
+    {
+        case 0: info->samples = 1; break;     // Grayscale: 1, 2, 4, 8, 16 bit
+        case 2: info->samples = 3; break;     // RGB: 8, 16 bit
+        case 3: info->samples = 1; break;     // Palette indices: 1, 2, 4, 8 bit
+        case 4: info->samples = 2; break;     // Grayscale and alpha: 8, 16 bit
+        case 6: info->samples = 4; break;     // RGBA: 8, 16 bit
+        default: valid = false; break;
+    }
+
+    if ((bitDepth != 1) && (bitDepth != 2) && (bitDepth != 4) && (bitDepth != 8) && (bitDepth != 16)) valid = false;
+    if ((bitDepth < 8) && (header[25] != 0) && (header[25] != 3)) valid = false;
+    if ((bitDepth == 16) && (header[25] == 3)) valid = false;
+    if ((width == 0) || (height == 0) || (width > (1 << 24)) || (height > (1 << 24))) valid = false;
+    if ((header[26] != 0) || (header[27] != 0) || (header[28] > 1)) valid = false;
+
+    if (valid)
+    {
+        info->width = (int)width;
+        info->height = (int)height;
+        info->bitDepth = bitDepth;
+        info->colorType = header[25];
+        info->interlaced = (header[28] == 1);
+        info->pitch = (int)(((size_t)width*info->samples*bitDepth + 7)/8);
+        info->filterSize = (info->samples*bitDepth >= 8)? info->samples*bitDepth/8 : 1;
+        info->transparency = false;
+        for (int i = 0; i < 256; i++) info->palette[i*4 + 3] = 255;
+    }
+
+    return valid;
+}
+#endif
+
+// Read PNG color chunk data (palette, transparency), other chunks ignored
+static void ReadChunkPNG(PNGInfo *info, const unsigned char *type, const unsigned char *data, int size)
+{
+    if (memcmp(type, "PLTE", 4) == 0)
+    {
+        for (int i = 0; (i < size/3) && (i < 256); i++) memcpy(info->palette + i*4, data + i*3, 3);
+    }
+    else if (memcmp(type, "tRNS", 4) == 0)
+    {
+        if (info->colorType == 3)
+        {
+            for (int i = 0; (i < size) && (i < 256); i++) info->palette[i*4 + 3] = data[i];
+            info->transparency = true;
+        }
+        else if ((info->colorType == 0) || (info->colorType == 2))
+        {
+            for (int i = 0; (i < info->samples) && (i*2 + 1 < size); i++) info->transparentColor[i] = (data[i*2] << 8) | data[i*2 + 1];
+            info->transparency = true;
+        }
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+// Get PNG decoded pixel format
+// NOTE: Same channels as stb_image, transparency adds alpha channel,
+// palette images are expanded and 16 bit samples reduced to 8 bit
+static int GetPixelFormatPNG(const PNGInfo *info)
+{
+    int channels = (info->colorType == 3)? 3 : info->samples;
+    if (info->transparency) channels++;
+
+    if (channels == 1) return PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    else if (channels == 2) return PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    else if (channels == 3) return PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+    else return PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+}
+#endif
+
+#if defined(RL_SIMD_SSE2)
+// Load PNG pixel bytes (3, 4, 6 or 8 bytes) into vector low bytes
+static inline __m128i LoadPixelPNG(const unsigned char *pixel, int size)
+{
+    long long value = 0;
+    memcpy(&value, pixel, size);
+
+    return _mm_loadl_epi64((const __m128i *)&value);
+}
+
+// Store PNG pixel bytes (3, 4, 6 or 8 bytes) from vector low bytes
+static inline void StorePixelPNG(unsigned char *pixel, __m128i vector, int size)
+{
+    long long value = 0;
+    _mm_storel_epi64((__m128i *)&value, vector);
+
+    memcpy(pixel, &value, size);
+}
+
+// Unfilter PNG scanline pixels (Sub, Average, Paeth), one pixel per vector
+// NOTE: Always inlined with constant pixel size, pixel loads and stores are fixed size
+static inline void UnfilterPixelsPNG(int filter, const unsigned char *line, const unsigned char *prior, unsigned char *output, int pitch, int size)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i a = zero;       // Previous pixel
+
+    if (filter == 1)
+    {
+        for (int i = 0; i < pitch; i += size)
+        {
+            a = _mm_add_epi8(LoadPixelPNG(line + i, size), a);
+            StorePixelPNG(output + i, a, size);
+        }
+    }
+    else if (filter == 3)
+    {
+        // Average rounded down: rounded up average corrected with low bit
+        __m128i one = _mm_set1_epi8(1);
+
+        for (int i = 0; i < pitch; i += size)
+        {
+            __m128i b = LoadPixelPNG(prior + i, size);
+            __m128i average = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+            a = _mm_add_epi8(LoadPixelPNG(line + i, size), average);
+            StorePixelPNG(output + i, a, size);
+        }
+    }
+    else
+    {
+        // Paeth predictor: p = a + b - c, nearest of a, b, c to p (ties: a, b, c)
+        __m128i a16 = zero;
+        __m128i c16 = zero;
+
+        for (int i = 0; i < pitch; i += size)
+        {
+            __m128i b16 = _mm_unpacklo_epi8(LoadPixelPNG(prior + i, size), zero);
+            __m128i pa = _mm_sub_epi16(b16, c16);   // p - a
+            __m128i pb = _mm_sub_epi16(a16, c16);   // p - b
+            __m128i pc = _mm_add_epi16(pa, pb);     // p - c
+            pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+            pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+            pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+            __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+            __m128i useA = _mm_cmpeq_epi16(smallest, pa);
+            __m128i useB = _mm_cmpeq_epi16(smallest, pb);
+            __m128i nearest = _mm_or_si128(_mm_and_si128(useB, b16), _mm_andnot_si128(useB, c16));
+            nearest = _mm_or_si128(_mm_and_si128(useA, a16), _mm_andnot_si128(useA, nearest));
+
+            a = _mm_add_epi8(LoadPixelPNG(line + i, size), _mm_packus_epi16(nearest, nearest));
+            StorePixelPNG(output + i, a, size);
+            a16 = _mm_unpacklo_epi8(a, zero);
+            c16 = b16;
+        }
+    }
+}
+#elif defined(RL_SIMD_NEON)
+// Load PNG pixel bytes (3, 4, 6 or 8 bytes) into vector low bytes
+static inline uint8x8_t LoadPixelPNG(const unsigned char *pixel, int size)
+{
+    unsigned char value[8] = { 0 };
+    memcpy(value, pixel, size);
+
+    return vld1_u8(value);
+}
+
+// Store PNG pixel bytes (3, 4, 6 or 8 bytes) from vector low bytes
+static inline void StorePixelPNG(unsigned char *pixel, uint8x8_t vector, int size)
+{
+    unsigned char value[8] = { 0 };
+    vst1_u8(value, vector);
+
+    memcpy(pixel, value, size);
+}
+
+// Unfilter PNG scanline pixels (Sub, Average, Paeth), one pixel per vector
+// NOTE: Always inlined with constant pixel size, pixel loads and stores are fixed size
+static inline void UnfilterPixelsPNG(int filter, const unsigned char *line, const unsigned char *prior, unsigned char *output, int pitch, int size)
+{
+    uint8x8_t a = vdup_n_u8(0);     // Previous pixel
+    uint8x8_t c = vdup_n_u8(0);     // Prior scanline previous pixel
+
+    for (int i = 0; i < pitch; i += size)
+    {
+        uint8x8_t x = LoadPixelPNG(line + i, size);
+
+        if (filter == 1) a = vadd_u8(x, a);
+        else if (filter == 3) a = vadd_u8(x, vhadd_u8(a, LoadPixelPNG(prior + i, size)));
+        else
+        {
+            // Paeth predictor: p = a + b - c, nearest of a, b, c to p (ties: a, b, c)
+            uint8x8_t b = LoadPixelPNG(prior + i, size);
+            uint16x8_t pa = vabdl_u8(b, c);     // |p - a|
+            uint16x8_t pb = vabdl_u8(a, c);     // |p - b|
+            uint16x8_t pc = vreinterpretq_u16_s16(vabsq_s16(vsubq_s16(vreinterpretq_s16_u16(vaddl_u8(a, b)), vreinterpretq_s16_u16(vshll_n_u8(c, 1)))));
+
+            uint16x8_t smallest = vminq_u16(pc, vminq_u16(pa, pb));
+            uint8x8_t useA = vmovn_u16(vceqq_u16(smallest, pa));
+            uint8x8_t useB = vmovn_u16(vceqq_u16(smallest, pb));
+
+            a = vadd_u8(x, vbsl_u8(useA, a, vbsl_u8(useB, b, c)));
+            c = b;
+        }
+
+        StorePixelPNG(output + i, a, size);
+    }
+}
+#endif
+
+// Unfilter PNG scanline (filter type byte first), output can be the scanline data itself
+// NOTE: Sub, Average and Paeth filters depend on previous pixel, pixels of 3 bytes or more
+// are unfiltered one pixel per vector (all channels at once), smaller pixels one byte at a time
+static bool UnfilterScanlinePNG(const unsigned char *scanline, const unsigned char *prior, unsigned char *output, int pitch, int size)
+{
+    const unsigned char *line = scanline + 1;
+    int filter = scanline[0];
+    int i = 0;
+
+#if defined(RL_SIMD_SSE2) || defined(RL_SIMD_NEON)
+    if ((size >= 3) && ((filter == 1) || (filter == 3) || (filter == 4)))
+    {
+        switch (size)
+        {
+            case 3: UnfilterPixelsPNG(filter, line, prior, output, pitch, 3); break;
+            case 4: UnfilterPixelsPNG(filter, line, prior, output, pitch, 4); break;
+            case 6: UnfilterPixelsPNG(filter, line, prior, output, pitch, 6); break;
+            default: UnfilterPixelsPNG(filter, line, prior, output, pitch, 8); break;
+        }
+
+        return true;
+    }
+#endif
+
+    switch (filter)
+    {
+        case 0: if (output != line) memcpy(output, line, pitch); break;
+        case 1:
+        {
+            for (; i < size; i++) output[i] = line[i];
+            for (; i < pitch; i++) output[i] = line[i] + output[i - size];
+        } break;
+        case 2:
+        {
+        #if defined(RL_SIMD_SSE2)
+            for (; i + 16 <= pitch; i += 16) _mm_storeu_si128((__m128i *)(output + i), _mm_add_epi8(_mm_loadu_si128((const __m128i *)(line + i)), _mm_loadu_si128((const __m128i *)(prior + i))));
+        #elif defined(RL_SIMD_NEON)
+            for (; i + 16 <= pitch; i += 16) vst1q_u8(output + i, vaddq_u8(vld1q_u8(line + i), vld1q_u8(prior + i)));
+        #endif
+            for (; i < pitch; i++) output[i] = line[i] + prior[i];
+        } break;
+        case 3:
+        {
+            for (; i < size; i++) output[i] = line[i] + (prior[i] >> 1);
+            for (; i < pitch; i++) output[i] = line[i] + ((output[i - size] + prior[i]) >> 1);
+        } break;
+        case 4:
+        {
+            for (; i < size; i++) output[i] = line[i] + prior[i];
+            for (; i < pitch; i++)
+            {
+                int a = output[i - size];
+                int b = prior[i];
+                int c = prior[i - size];
+                int pa = abs(b - c);            // |p - a|
+                int pb = abs(a - c);            // |p - b|
+                int pc = abs(a + b - 2*c);      // |p - c|
+
+                output[i] = line[i] + (((pa <= pb) && (pa <= pc))? a : ((pb <= pc)? b : c));
+            }
+        } break;
+        default: return false;
+    }
+
+    return true;
+}
+
+// Convert unfiltered PNG scanline to decoded pixel format
+// NOTE: Same pixels as stb_image: 16 bit samples reduced to high byte, low bit depth grayscale
+// scaled to 8 bit, transparent color compared on original samples
+static void ConvertScanlinePNG(const PNGInfo *info, const unsigned char *scanline, unsigned char *pixels)
+{
+    static const unsigned char grayScale[9] = { 0, 255, 85, 0, 17, 0, 0, 0, 1 };
+    int samples = info->samples;
+    int bitDepth = info->bitDepth;
+    int channels = GetPixelDataSize(1, 1, info->format);
+
+    // 8 bit samples without palette and transparency are already in decoded format
+    if ((bitDepth == 8) && (info->colorType != 3) && !info->transparency)
+    {
+        memcpy(pixels, scanline, (size_t)info->width*samples);
+        return;
+    }
+
+    if ((info->colorType == 3) && (bitDepth == 8))
+    {
+        if (channels == 4) for (int x = 0; x < info->width; x++) memcpy(pixels + (size_t)x*4, info->palette + scanline[x]*4, 4);
+        else for (int x = 0; x < info->width; x++) memcpy(pixels + (size_t)x*3, info->palette + scanline[x]*4, 3);
+        return;
+    }
+
+    for (int x = 0; x < info->width; x++)
+    {
+        unsigned short values[4] = { 0 };
+        unsigned char *pixel = pixels + (size_t)x*channels;
+
+        for (int c = 0; c < samples; c++)
+        {
+            size_t i = (size_t)x*samples + c;
+
+            if (bitDepth == 16) values[c] = (scanline[i*2] << 8) | scanline[i*2 + 1];
+            else if (bitDepth == 8) values[c] = scanline[i];
+            else values[c] = (scanline[(i*bitDepth) >> 3] >> (8 - bitDepth - ((i*bitDepth) & 7))) & ((1 << bitDepth) - 1);
+        }
+
+        if (info->colorType == 3) memcpy(pixel, info->palette + values[0]*4, channels);
+        else
+        {
+            for (int c = 0; c < samples; c++) pixel[c] = (unsigned char)((bitDepth == 16)? (values[c] >> 8) : values[c]*grayScale[bitDepth]);
+
+            if (info->transparency)
+            {
+                bool transparent = (values[0] == info->transparentColor[0]) &&
+                    ((samples == 1) || ((values[1] == info->transparentColor[1]) && (values[2] == info->transparentColor[2])));
+
+                pixel[samples] = transparent? 0 : 255;
+            }
+        }
+    }
+}
+#endif
+
+#if defined(PNG_DECODER_AVAILABLE)
+// Load PNG image data, image data chunks decompressed at once with sinfl
+// and scanlines unfiltered directly into image data when no conversion is required
+// NOTE: Interlaced and non standard images (NULL data returned) are loaded with stb_image
+static Image LoadImagePNG(const unsigned char *fileData, int dataSize)
+{
+    Image image = { 0 };
+    PNGInfo info = { 0 };
+
+    if ((dataSize < 33) || !ReadHeaderPNG(&info, fileData) || info.interlaced) return image;
+
+    // Read chunks: color chunks data and image data chunks size
+    const unsigned char *compData = NULL;
+    int compDataSize = 0;
+    int dataChunks = 0;
+
+    for (int offset = 33; offset + 12 <= dataSize; )
+    {
+        unsigned int length = ((unsigned int)fileData[offset] << 24) | (fileData[offset + 1] << 16) | (fileData[offset + 2] << 8) | fileData[offset + 3];
+        const unsigned char *type = fileData + offset + 4;
+
+        if (length > (unsigned int)(dataSize - offset - 12)) break;    // Truncated chunk
+
+        if (memcmp(type, "IDAT", 4) == 0)
+        {
+            if (compData == NULL) compData = type + 4;
+            compDataSize += (int)length;
+            dataChunks++;
+        }
+        else if (memcmp(type, "IEND", 4) == 0) break;
+        else if (compData == NULL) ReadChunkPNG(&info, type, type + 4, (int)length);
+
+        offset += (int)length + 12;
+    }
+
+    size_t rawSize = (size_t)info.height*(info.pitch + 1);
+    info.format = GetPixelFormatPNG(&info);
+    int bytesPerPixel = GetPixelDataSize(1, 1, info.format);
+
+    if ((compData == NULL) || (compDataSize < 2) || (rawSize > 0x7fffffff) || (((size_t)info.width*info.height) > (size_t)(0x7fffffff/bytesPerPixel))) return image;
+
+    // Image data chunks joined when required (usually chunks of 8 KB)
+    unsigned char *joined = NULL;
+
+    if (dataChunks > 1)
+    {
+        joined = (unsigned char *)RL_MALLOC(compDataSize);
+
+        const unsigned char *chunk = compData - 8;
+        for (int size = 0; size < compDataSize; )
+        {
+            unsigned int length = ((unsigned int)chunk[0] << 24) | (chunk[1] << 16) | (chunk[2] << 8) | chunk[3];
+
+            if (memcmp(chunk + 4, "IDAT", 4) == 0)
+            {
+                memcpy(joined + size, chunk + 8, length);
+                size += (int)length;
+            }
+
+            chunk += length + 12;
+        }
+
+        compData = joined;
+    }
+
+    // zlib header: deflate method, no preset dictionary
+    unsigned char *raw = NULL;
+    bool valid = ((((compData[0] << 8) | compData[1])%31) == 0) && ((compData[0] & 15) == 8) && !(compData[1] & 32);
+
+    if (valid)
+    {
+        raw = (unsigned char *)RL_MALLOC(rawSize);
+        valid = (sinflate(raw, (int)rawSize, compData + 2, compDataSize - 2) == (int)rawSize);
+    }
+
+    RL_FREE(joined);
+
+    if (valid)
+    {
+        // 8 bit samples without palette and transparency unfiltered directly into image data
+        bool direct = (info.bitDepth == 8) && (info.colorType != 3) && !info.transparency;
+        unsigned char *zeros = (unsigned char *)RL_CALLOC(info.pitch, 1);
+        const unsigned char *prior = zeros;
+
+        image.data = RL_MALLOC((size_t)info.width*info.height*bytesPerPixel);
+
+        for (int y = 0; valid && (y < info.height); y++)
+        {
+            unsigned char *scanline = raw + (size_t)y*(info.pitch + 1);
+            unsigned char *output = direct? ((unsigned char *)image.data + (size_t)y*info.pitch) : (scanline + 1);
+
+            valid = UnfilterScanlinePNG(scanline, prior, output, info.pitch, info.filterSize);
+            if (valid && !direct) ConvertScanlinePNG(&info, output, (unsigned char *)image.data + (size_t)y*info.width*bytesPerPixel);
+
+            prior = output;
+        }
+
+        RL_FREE(zeros);
+    }
+
+    RL_FREE(raw);
+
+    if (valid)
+    {
+        image.width = info.width;
+        image.height = info.height;
+        image.format = info.format;
+        image.mipmaps = 1;
+    }
+    else
+    {
+        RL_FREE(image.data);
+        image.data = NULL;
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_STREAMING)
+#if defined(SUPPORT_FILEFORMAT_PNG)
+// Open PNG image stream, headers read until image data
+// NOTE: Interlaced images are not streamed (scanlines not stored in order)
+static bool OpenImageStreamPNG(rImageStream *stream, const char *fileName)
+{
+    unsigned char header[33] = { 0 };  // Signature and header chunk
+
+    stream->file = fopen(fileName, "rb");
+    if (stream->file == NULL) return false;
+
+    bool valid = (fread(header, 1, 33, stream->file) == 33) && ReadHeaderPNG(&stream->png, header);
+
+    if (valid && stream->png.interlaced)
+    {
+        TRACELOG(LOG_INFO, "IMAGE: [%s] Interlaced PNG image can not be streamed, image fully loaded", fileName);
+        valid = false;
+    }
+
+    if (valid)
+    {
+        stream->input = (unsigned char *)RL_MALLOC(IMAGE_STREAM_INPUT_SIZE);
+        stream->inflate.window = (unsigned char *)RL_MALLOC(32768);
+        stream->scanlines = (unsigned char *)RL_MALLOC(2*((size_t)stream->png.pitch + 1));
+
+        valid = RestartImageStreamPNG(stream);
+    }
+
+    if (valid)
+    {
+        stream->png.format = GetPixelFormatPNG(&stream->png);
+        stream->width = stream->png.width;
+        stream->height = stream->png.height;
+        stream->format = stream->png.format;
+    }
+    else
+    {
+        fclose(stream->file);
+        RL_FREE(stream->input);
+        RL_FREE(stream->inflate.window);
+        RL_FREE(stream->scanlines);
+        memset(stream, 0, sizeof(rImageStream));
+    }
+
+    return valid;
+}
+#endif
+
+// Restart PNG image stream decoding from first scanline
+// NOTE: Chunks before image data are read again (palette and transparency)
+static bool RestartImageStreamPNG(rImageStream *stream)
+{
+    InflateStream *inflate = &stream->inflate;
+
+    inflate->bits = 0;
+    inflate->bitCount = 0;
+    inflate->paddingBits = 0;
+    inflate->state = 0;
+    inflate->lastBlock = false;
+    inflate->storedLength = 0;
+    inflate->matchLength = 0;
+    inflate->position = 0;
+
+    stream->chunkRemaining = 0;
+    stream->dataEnd = false;
+    stream->inputSize = 0;
+    stream->inputPosition = 0;
+    stream->row = 0;
+    stream->failed = true;
+
+    // Prior scanline of first scanline is zero
+    memset(stream->scanlines, 0, 2*((size_t)stream->png.pitch + 1));
+
+    if (fseek(stream->file, 33, SEEK_SET) != 0) return false;
+
+    while (true)
+    {
+        unsigned char chunk[8] = { 0 };
+        if (fread(chunk, 1, 8, stream->file) != 8) return false;
+
+        unsigned int length = ((unsigned int)chunk[0] << 24) | (chunk[1] << 16) | (chunk[2] << 8) | chunk[3];
+        if (length > 0x7fffffff) return false;
+
+        if (memcmp(chunk + 4, "IDAT", 4) == 0)
+        {
+            stream->chunkRemaining = (int)length;
+            stream->failed = false;
+            return true;
+        }
+        else if (memcmp(chunk + 4, "IEND", 4) == 0) return false;
+        else if ((memcmp(chunk + 4, "PLTE", 4) == 0) || (memcmp(chunk + 4, "tRNS", 4) == 0))
+        {
+            unsigned char data[768] = { 0 };
+            int size = (length < 768)? (int)length : 768;
+            if (fread(data, 1, size, stream->file) != (size_t)size) return false;
+
+            ReadChunkPNG(&stream->png, chunk + 4, data, size);
+
+            if (fseek(stream->file, (long)length - size + 4, SEEK_CUR) != 0) return false;
+        }
+        else if (fseek(stream->file, (long)length + 4, SEEK_CUR) != 0) return false;
+    }
+}
+
+// Read next image stream scanline, unfiltered and converted to stream format (NULL pixels: skipped)
+static bool ReadImageStreamRow(rImageStream *stream, unsigned char *pixels)
+{
+    if (stream->failed || (stream->row >= stream->height)) return false;
+
+    int pitch = stream->png.pitch;
+    unsigned char *scanline = stream->scanlines + (size_t)(stream->row%2)*(pitch + 1);
+    const unsigned char *prior = stream->scanlines + (size_t)((stream->row + 1)%2)*(pitch + 1) + 1;
+
+    if (InflateStreamRead(stream, scanline, pitch + 1) != (pitch + 1))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to decode PNG image stream data");
+        stream->failed = true;
+        return false;
+    }
+
+    if (!UnfilterScanlinePNG(scanline, prior, scanline + 1, pitch, stream->png.filterSize))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Invalid PNG image stream scanline filter");
+        stream->failed = true;
+        return false;
+    }
+
+    if (pixels != NULL) ConvertScanlinePNG(&stream->png, scanline + 1, pixels);
+    stream->row++;
+
+    return true;
+}
+
+// Seek image stream to scanline, restarting decoding for previous scanlines
+static bool SeekImageStreamRow(rImageStream *stream, int row)
+{
+    if (stream->type != IMAGE_STREAM_PNG) return true;
+
+    if ((row < stream->row) || stream->failed)
+    {
+        if (!RestartImageStreamPNG(stream)) return false;
+    }
+
+    while (stream->row < row)
+    {
+        if (!ReadImageStreamRow(stream, NULL)) return false;
+    }
+
+    return true;
+}
+
+// Find image stream cached tile (NULL: not cached)
+static ImageStreamTile *FindImageStreamTile(rImageStream *stream, int tileX, int tileY)
+{
+    for (int i = 0; i < IMAGE_STREAM_CACHE_TILES; i++)
+    {
+        ImageStreamTile *tile = &stream->tiles[i];
+        if ((tile->image.data != NULL) && (tile->x == tileX) && (tile->y == tileY)) return tile;
+    }
+
+    return NULL;
+}
+
+// Decode and cache image stream tiles row range, tiles not cached decoded together
+// NOTE: Least recently used tiles are replaced, tiles used by current request are kept
+static bool CacheImageStreamTiles(rImageStream *stream, int tileY, int firstTileX, int lastTileX, unsigned char *row)
+{
+    ImageStreamTile *decoded[IMAGE_STREAM_CACHE_TILES] = { 0 };
+    int decodedCount = 0;
+    int bytesPerPixel = GetPixelDataSize(1, 1, stream->format);
+
+    for (int tileX = firstTileX; tileX <= lastTileX; tileX++)
+    {
+        ImageStreamTile *tile = FindImageStreamTile(stream, tileX, tileY);
+
+        if (tile == NULL)
+        {
+            tile = &stream->tiles[0];
+            for (int i = 0; i < IMAGE_STREAM_CACHE_TILES; i++)
+            {
+                if (stream->tiles[i].image.data == NULL) { tile = &stream->tiles[i]; break; }
+                if ((stream->tiles[i].lastUse < tile->lastUse) || (tile->lastUse == stream->useCounter)) tile = &stream->tiles[i];
+            }
+
+            UnloadImage(tile->image);
+
+            tile->x = tileX;
+            tile->y = tileY;
+            tile->image.width = ((stream->width - tileX*IMAGE_STREAM_TILE_SIZE) < IMAGE_STREAM_TILE_SIZE)? (stream->width - tileX*IMAGE_STREAM_TILE_SIZE) : IMAGE_STREAM_TILE_SIZE;
+            tile->image.height = ((stream->height - tileY*IMAGE_STREAM_TILE_SIZE) < IMAGE_STREAM_TILE_SIZE)? (stream->height - tileY*IMAGE_STREAM_TILE_SIZE) : IMAGE_STREAM_TILE_SIZE;
+            tile->image.format = stream->format;
+            tile->image.mipmaps = 1;
+            tile->image.data = RL_MALLOC((size_t)tile->image.width*tile->image.height*bytesPerPixel);
+            decoded[decodedCount++] = tile;
+        }
+
+        tile->lastUse = stream->useCounter;
+    }
+
+    bool success = (decodedCount == 0) || SeekImageStreamRow(stream, tileY*IMAGE_STREAM_TILE_SIZE);
+
+    for (int j = 0; success && (decodedCount > 0) && (j < decoded[0]->image.height); j++)
+    {
+        success = ReadImageStreamRow(stream, row);
+
+        for (int i = 0; success && (i < decodedCount); i++)
+        {
+            Image *image = &decoded[i]->image;
+            size_t pitch = (size_t)image->width*bytesPerPixel;
+            memcpy((unsigned char *)image->data + pitch*j, row + (size_t)decoded[i]->x*IMAGE_STREAM_TILE_SIZE*bytesPerPixel, pitch);
+        }
+    }
+
+    if (!success)
+    {
+        for (int i = 0; i < decodedCount; i++)
+        {
+            UnloadImage(decoded[i]->image);
+            decoded[i]->image = (Image){ 0 };
+        }
+    }
+
+    return success;
+}
+
+#if defined(SUPPORT_IMAGE_EXPORT)
+// Add scanline to tiles pyramid level, tiles exported when tiles row is completed
+// NOTE: Scanlines pairs are reduced to next level scanline (last scanline paired with itself)
+static bool AddPyramidRow(ImagePyramidLevel *levels, int level, int levelCount, const unsigned char *row, int format, int tileSize, const char *dirPath)
+{
+    ImagePyramidLevel *current = &levels[level];
+    int channels = GetPixelDataSize(1, 1, format);
+    size_t pitch = (size_t)current->width*channels;
+    int index = current->rows%tileSize;
+    bool success = true;
+
+    memcpy(current->band + pitch*index, row, pitch);
+    current->rows++;
+
+    if ((level + 1) < levelCount)
+    {
+        unsigned char *reduced = NULL;
+
+        if ((index%2) == 1) reduced = current->band + pitch*(index - 1);
+        else if (current->rows == current->height) reduced = current->band + pitch*index;
+
+        if (reduced != NULL)
+        {
+            MipmapJob job = { .src = reduced, .srcWidth = current->width, .srcHeight = ((index%2) == 1)? 2 : 1,
+                              .width = levels[level + 1].width, .height = 1, .channels = channels, .channelSize = 1 };
+            unsigned char *next = (unsigned char *)RL_MALLOC((size_t)job.width*channels);
+            job.dst = next;
+
+            ReduceMipmapRowsBatch(0, 1, &job);
+            success = AddPyramidRow(levels, level + 1, levelCount, next, format, tileSize, dirPath);
+
+            RL_FREE(next);
+        }
+    }
+
+    // Tiles row completed, tiles exported
+    if ((index == (tileSize - 1)) || (current->rows == current->height))
+    {
+        int tileY = (current->rows - 1)/tileSize;
+
+        for (int tileX = 0; success && (tileX*tileSize < current->width); tileX++)
+        {
+            Image tile = { 0 };
+            tile.width = ((current->width - tileX*tileSize) < tileSize)? (current->width - tileX*tileSize) : tileSize;
+            tile.height = index + 1;
+            tile.format = format;
+            tile.mipmaps = 1;
+            tile.data = RL_MALLOC((size_t)tile.width*tile.height*channels);
+
+            for (int j = 0; j < tile.height; j++) memcpy((unsigned char *)tile.data + (size_t)tile.width*channels*j, current->band + pitch*j + (size_t)tileX*tileSize*channels, (size_t)tile.width*channels);
+
+            success = ExportImage(tile, TextFormat("%s/%i/%i_%i.png", dirPath, level, tileX, tileY));
+            UnloadImage(tile);
+        }
+    }
+
+    return success;
+}
+#endif
+
+// Read next byte of PNG image data chunks, consecutive image data chunks are joined (-1: no more data)
+static int ReadImageStreamByte(rImageStream *stream)
+{
+    if (stream->inputPosition < stream->inputSize) return stream->input[stream->inputPosition++];
+
+    while (stream->chunkRemaining == 0)
+    {
+        unsigned char chunk[12] = { 0 };    // Previous chunk CRC and next chunk header
+
+        if (stream->dataEnd) return -1;
+        if ((fread(chunk, 1, 12, stream->file) != 12) || (memcmp(chunk + 8, "IDAT", 4) != 0) || (chunk[4] & 0x80))
+        {
+            stream->dataEnd = true;
+            return -1;
+        }
+
+        stream->chunkRemaining = (chunk[4] << 24) | (chunk[5] << 16) | (chunk[6] << 8) | chunk[7];
+    }
+
+    int size = (stream->chunkRemaining < IMAGE_STREAM_INPUT_SIZE)? stream->chunkRemaining : IMAGE_STREAM_INPUT_SIZE;
+    size = (int)fread(stream->input, 1, size, stream->file);
+
+    if (size <= 0)
+    {
+        stream->dataEnd = true;
+        return -1;
+    }
+
+    stream->chunkRemaining -= size;
+    stream->inputSize = size;
+    stream->inputPosition = 1;
+
+    return stream->input[0];
+}
+
+// Fill inflate bit buffer (at least 25 bits available), zero bits added past data end
+static void FillInflateBits(rImageStream *stream)
+{
+    InflateStream *inflate = &stream->inflate;
+
+    while (inflate->bitCount <= 24)
+    {
+        int value = ReadImageStreamByte(stream);
+
+        if (value < 0)
+        {
+            value = 0;
+            inflate->paddingBits += 8;
+        }
+
+        inflate->bits |= (unsigned int)value << inflate->bitCount;
+        inflate->bitCount += 8;
+    }
+}
+
+// Get inflate stream bits (up to 16), LSB first
+static unsigned int GetInflateBits(rImageStream *stream, int count)
+{
+    InflateStream *inflate = &stream->inflate;
+
+    if (inflate->bitCount < count) FillInflateBits(stream);
+
+    unsigned int value = inflate->bits & ((1u << count) - 1);
+    inflate->bits >>= count;
+    inflate->bitCount -= count;
+
+    return value;
+}
+
+// Decode inflate stream bytes, returns bytes decoded
+// NOTE: Decoding state is kept between calls (pending match, current block),
+// decoded data window keeps last 32 KB required by matches
+static int InflateStreamRead(rImageStream *stream, unsigned char *output, int count)
+{
+    static const unsigned short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const unsigned char lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const unsigned short distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const unsigned char distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    InflateStream *inflate = &stream->inflate;
+    unsigned char *window = inflate->window;
+    int decoded = 0;
+
+    while (decoded < count)
+    {
+        if (inflate->matchLength > 0)
+        {
+            int length = ((count - decoded) < inflate->matchLength)? (count - decoded) : inflate->matchLength;
+
+            for (int i = 0; i < length; i++)
+            {
+                unsigned char value = window[(inflate->position - inflate->matchDistance) & 32767];
+                window[inflate->position & 32767] = value;
+                output[decoded++] = value;
+                inflate->position++;
+            }
+
+            inflate->matchLength -= length;
+            continue;
+        }
+
+        if (inflate->state == 0)        // zlib header: deflate method, no preset dictionary
+        {
+            unsigned int method = GetInflateBits(stream, 8);
+            unsigned int flags = GetInflateBits(stream, 8);
+            inflate->state = ((((method << 8) | flags)%31 != 0) || ((method & 15) != 8) || (flags & 32))? 5 : 1;
+        }
+        else if (inflate->state == 1)   // Block header
+        {
+            if (inflate->lastBlock) { inflate->state = 4; break; }
+
+            inflate->lastBlock = (GetInflateBits(stream, 1) == 1);
+            int type = (int)GetInflateBits(stream, 2);
+
+            if (type == 0)
+            {
+                // Stored block, length stored byte aligned
+                GetInflateBits(stream, inflate->bitCount & 7);
+                unsigned int length = GetInflateBits(stream, 16);
+                unsigned int complement = GetInflateBits(stream, 16);
+
+                if ((length ^ 0xffff) != complement) inflate->state = 5;
+                else
+                {
+                    inflate->storedLength = (int)length;
+                    inflate->state = 2;
+                }
+            }
+            else if (type == 1)
+            {
+                // Fixed huffman codes
+                unsigned char sizes[288 + 32] = { 0 };
+                for (int i = 0; i < 288; i++) sizes[i] = (i < 144)? 8 : ((i < 256)? 9 : ((i < 280)? 7 : 8));
+                for (int i = 288; i < 288 + 32; i++) sizes[i] = 5;
+
+                BuildInflateHuffman(&inflate->lengths, sizes, 288);
+                BuildInflateHuffman(&inflate->distances, sizes + 288, 32);
+                inflate->state = 3;
+            }
+            else if ((type == 2) && ReadInflateTables(stream)) inflate->state = 3;
+            else inflate->state = 5;
+        }
+        else if (inflate->state == 2)   // Stored block data
+        {
+            if (inflate->storedLength == 0) inflate->state = 1;
+            else
+            {
+                unsigned char value = (unsigned char)GetInflateBits(stream, 8);
+                window[inflate->position & 32767] = value;
+                output[decoded++] = value;
+                inflate->position++;
+                inflate->storedLength--;
+            }
+        }
+        else if (inflate->state == 3)   // Huffman block data
+        {
+            int symbol = DecodeInflateSymbol(stream, &inflate->lengths);
+
+            if (symbol < 0) inflate->state = 5;
+            else if (symbol < 256)
+            {
+                window[inflate->position & 32767] = (unsigned char)symbol;
+                output[decoded++] = (unsigned char)symbol;
+                inflate->position++;
+            }
+            else if (symbol == 256) inflate->state = 1;
+            else if (symbol < 286)
+            {
+                int length = lengthBase[symbol - 257] + GetInflateBits(stream, lengthExtra[symbol - 257]);
+                int code = DecodeInflateSymbol(stream, &inflate->distances);
+
+                if ((code < 0) || (code >= 30)) inflate->state = 5;
+                else
+                {
+                    int distance = distanceBase[code] + GetInflateBits(stream, distanceExtra[code]);
+
+                    if ((unsigned int)distance > inflate->position) inflate->state = 5;
+                    else
+                    {
+                        inflate->matchLength = length;
+                        inflate->matchDistance = distance;
+                    }
+                }
+            }
+            else inflate->state = 5;
+        }
+        else break;     // Decoding done or failed
+
+        // Data required past data end
+        if (inflate->paddingBits > inflate->bitCount) inflate->state = 5;
+    }
+
+    return decoded;
+}
+
+// Build inflate huffman table from codes lengths (canonical codes)
+static bool BuildInflateHuffman(InflateHuffman *huffman, const unsigned char *sizes, int count)
+{
+    int sizeCount[17] = { 0 };
+    int nextCode[16] = { 0 };
+    int code = 0;
+    int symbol = 0;
+
+    memset(huffman->fast, 0, sizeof(huffman->fast));
+
+    for (int i = 0; i < count; i++) sizeCount[sizes[i]]++;
+    sizeCount[0] = 0;
+    for (int i = 1; i < 16; i++) if (sizeCount[i] > (1 << i)) return false;
+
+    for (int i = 1; i < 16; i++)
+    {
+        nextCode[i] = code;
+        huffman->firstCode[i] = (unsigned short)code;
+        huffman->firstSymbol[i] = (unsigned short)symbol;
+        code += sizeCount[i];
+        if ((sizeCount[i] > 0) && ((code - 1) >= (1 << i))) return false;
+        huffman->maxCode[i] = code << (16 - i);     // Preshifted for decoding
+        code <<= 1;
+        symbol += sizeCount[i];
+    }
+
+    huffman->maxCode[16] = 0x10000;
+
+    for (int i = 0; i < count; i++)
+    {
+        int size = sizes[i];
+        if (size == 0) continue;
+
+        int index = nextCode[size] - huffman->firstCode[size] + huffman->firstSymbol[size];
+        huffman->sizes[index] = (unsigned char)size;
+        huffman->symbols[index] = (unsigned short)i;
+
+        if (size <= INFLATE_FAST_BITS)
+        {
+            // Codes are stored MSB first, bit buffer is read LSB first
+            int reversed = 0;
+            for (int b = 0; b < size; b++) reversed |= ((nextCode[size] >> b) & 1) << (size - 1 - b);
+
+            for (int j = reversed; j < (1 << INFLATE_FAST_BITS); j += (1 << size)) huffman->fast[j] = (unsigned short)((size << 9) | i);
+        }
+
+        nextCode[size]++;
+    }
+
+    return true;
+}
+
+// Decode inflate huffman symbol (-1: invalid code)
+static int DecodeInflateSymbol(rImageStream *stream, const InflateHuffman *huffman)
+{
+    InflateStream *inflate = &stream->inflate;
+
+    if (inflate->bitCount < 16) FillInflateBits(stream);
+
+    int fast = huffman->fast[inflate->bits & ((1 << INFLATE_FAST_BITS) - 1)];
+    int size = fast >> 9;
+
+    if (fast == 0)
+    {
+        // Longer codes, bit reversed code compared to codes limits
+        int code = 0;
+        for (int b = 0; b < 16; b++) code |= ((inflate->bits >> b) & 1) << (15 - b);
+
+        for (size = INFLATE_FAST_BITS + 1; size < 16; size++) if (code < huffman->maxCode[size]) break;
+        if (size >= 16) return -1;
+
+        int index = (code >> (16 - size)) - huffman->firstCode[size] + huffman->firstSymbol[size];
+        if ((index >= 288) || (huffman->sizes[index] != size)) return -1;
+
+        fast = huffman->symbols[index];
+    }
+
+    inflate->bits >>= size;
+    inflate->bitCount -= size;
+
+    return fast & 511;
+}
+
+// Read inflate dynamic block huffman tables (code lengths compressed with code lengths codes)
+static bool ReadInflateTables(rImageStream *stream)
+{
+    static const unsigned char order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    int lengthCount = (int)GetInflateBits(stream, 5) + 257;
+    int distanceCount = (int)GetInflateBits(stream, 5) + 1;
+    int codeCount = (int)GetInflateBits(stream, 4) + 4;
+
+    // NOTE: Header allows up to 288 lengths and 32 distances codes, only 286 and 30 are valid
+    if ((lengthCount > 286) || (distanceCount > 30)) return false;
+
+    unsigned char codeSizes[19] = { 0 };
+    for (int i = 0; i < codeCount; i++) codeSizes[order[i]] = (unsigned char)GetInflateBits(stream, 3);
+
+    InflateHuffman codes = { 0 };
+    if (!BuildInflateHuffman(&codes, codeSizes, 19)) return false;
+
+    unsigned char sizes[288 + 32] = { 0 };
+    int count = 0;
+
+    while (count < (lengthCount + distanceCount))
+    {
+        int code = DecodeInflateSymbol(stream, &codes);
+        if ((code < 0) || (code >= 19)) return false;
+
+        if (code < 16) sizes[count++] = (unsigned char)code;
+        else
+        {
+            int repeat = 0;
+            unsigned char size = 0;
+
+            if (code == 16)
+            {
+                if (count == 0) return false;
+                repeat = (int)GetInflateBits(stream, 2) + 3;
+                size = sizes[count - 1];
+            }
+            else if (code == 17) repeat = (int)GetInflateBits(stream, 3) + 3;
+            else repeat = (int)GetInflateBits(stream, 7) + 11;
+
+            if (repeat > (lengthCount + distanceCount - count)) return false;
+
+            memset(sizes + count, size, repeat);
+            count += repeat;
+        }
+    }
+
+    if (sizes[256] == 0) return false;
+
+    return BuildInflateHuffman(&stream->inflate.lengths, sizes, lengthCount) && BuildInflateHuffman(&stream->inflate.distances, sizes + lengthCount, distanceCount);
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Add operation to image pipeline, pipeline output size and format updated
+static void AddImageOperation(ImagePipeline *pipeline, rImageOperation operation)
+{
+    rImageOperation *operations = (rImageOperation *)RL_REALLOC(pipeline->operations, (pipeline->operationCount + 1)*sizeof(rImageOperation));
+
+    if (operations == NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate pipeline operation");
+        return;
+    }
+
+    operations[pipeline->operationCount] = operation;
+    pipeline->operations = operations;
+    pipeline->operationCount++;
+
+    if ((operation.type == IMAGE_OPERATION_CROP) || (operation.type == IMAGE_OPERATION_RESIZE))
+    {
+        pipeline->width = operation.width;
+        pipeline->height = operation.height;
+    }
+    else if (operation.type == IMAGE_OPERATION_FORMAT) pipeline->format = operation.format;
+}
+
+// Apply pipeline color and format operations in range [first, last) to R8G8B8A8 pixels span (up to PIXELS_CONVERT_CHUNK pixels)
+// NOTE: Pixels are quantized to current format before every color operation, as image functions do,
+// last quantization is skipped if requested (pixels converted to final format by caller)
+static void ApplyPipelineOperations(const ImagePipelineJob *job, int first, int last, int format, unsigned char *pixels, int count, bool quantize)
+{
+    bool pending = false;       // Pixels not quantized to current format
+
+    for (int i = first; i < last; i++)
+    {
+        const rImageOperation *operation = &job->operations[i];
+
+        if (operation->type == IMAGE_OPERATION_FORMAT)
+        {
+            if (operation->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) continue;    // Compressed after pipeline
+            if (pending) QuantizePixelsSpan(pixels, format, count);
+
+            format = operation->format;
+            pending = (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        }
+        else if (operation->type == IMAGE_OPERATION_COLOR)
+        {
+            if (pending) QuantizePixelsSpan(pixels, format, count);
+
+            ColorAdjustJob color = operation->color;
+            color.pixels = (Color *)pixels;
+            AdjustColorsBatch(0, count, &color);
+
+            pending = (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        }
+    }
+
+    if (pending && quantize) QuantizePixelsSpan(pixels, format, count);
+}
+
+// Quantize R8G8B8A8 pixels span (up to PIXELS_CONVERT_CHUNK pixels) to pixel format precision
+static void QuantizePixelsSpan(unsigned char *pixels, int format, int count)
+{
+    if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return;
+
+    unsigned char data[PIXELS_CONVERT_CHUNK*4] = { 0 };
+
+    ConvertPixelsFromRGBA8(pixels, data, format, count);
+    ConvertPixelsToRGBA8(data, format, pixels, count);
+}
+
+// Evaluate pipeline rows in range [start, end), source region read and written by spans (no resize)
+static void EvaluatePipelineRowsBatch(int start, int end, void *data)
+{
+    const ImagePipelineJob *job = (const ImagePipelineJob *)data;
+    int sourceSize = GetPixelDataSize(1, 1, job->sourceFormat);
+    int outputSize = GetPixelDataSize(1, 1, job->outputFormat);
+    unsigned char pixels[PIXELS_CONVERT_CHUNK*4] = { 0 };
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *src = job->source + ((job->offsetY + y)*job->sourceWidth + job->offsetX)*sourceSize;
+        unsigned char *dst = job->output + y*job->outputWidth*outputSize;
+
+        if (!job->preColors) memcpy(dst, src, job->outputWidth*outputSize);
+        else
+        {
+            for (int x = 0; x < job->outputWidth; x += PIXELS_CONVERT_CHUNK)
+            {
+                int count = job->outputWidth - x;
+                if (count > PIXELS_CONVERT_CHUNK) count = PIXELS_CONVERT_CHUNK;
+
+                ConvertPixelsToRGBA8(src + x*sourceSize, job->sourceFormat, pixels, count);
+                ApplyPipelineOperations(job, 0, job->preCount, job->sourceFormat, pixels, count, false);
+                ConvertPixelsFromRGBA8(pixels, dst + x*outputSize, job->outputFormat, count);
+            }
+        }
+    }
+}
+
+// Read pipeline source row span for resampling, pre stage operations applied, converted to resampled format
+static const void *ReadPipelineRow(void *output, const void *input, int count, int x, int y, void *data)
+{
+    const ImagePipelineJob *job = (const ImagePipelineJob *)data;
+    int sourceSize = GetPixelDataSize(1, 1, job->sourceFormat);
+    int layoutSize = GetPixelDataSize(1, 1, job->resizeLayout);
+    const unsigned char *src = job->source + ((job->offsetY + y)*job->sourceWidth + job->offsetX + x)*sourceSize;
+    unsigned char pixels[PIXELS_CONVERT_CHUNK*4] = { 0 };
+
+    for (int i = 0; i < count; i += PIXELS_CONVERT_CHUNK)
+    {
+        int spanCount = count - i;
+        if (spanCount > PIXELS_CONVERT_CHUNK) spanCount = PIXELS_CONVERT_CHUNK;
+
+        ConvertPixelsToRGBA8(src + i*sourceSize, job->sourceFormat, pixels, spanCount);
+        ApplyPipelineOperations(job, 0, job->preCount, job->sourceFormat, pixels, spanCount, true);
+        ConvertPixelsFromRGBA8(pixels, (unsigned char *)output + i*layoutSize, job->resizeLayout, spanCount);
+    }
+
+    return output;
+}
+
+// Write pipeline resampled row, post stage operations applied, converted to output format
+// NOTE: Only output region of resampled rows is written (crops after resize)
+static void WritePipelineRow(const void *input, int count, int y, void *data)
+{
+    const ImagePipelineJob *job = (const ImagePipelineJob *)data;
+
+    y -= job->outputOffsetY;
+    if ((y < 0) || (y >= job->outputHeight)) return;
+
+    int layoutSize = GetPixelDataSize(1, 1, job->resizeLayout);
+    int outputSize = GetPixelDataSize(1, 1, job->outputFormat);
+    const unsigned char *src = (const unsigned char *)input + job->outputOffsetX*layoutSize;
+    count = job->outputWidth;
+    unsigned char *dst = job->output + y*job->outputWidth*outputSize;
+    unsigned char pixels[PIXELS_CONVERT_CHUNK*4] = { 0 };
+
+    if (!job->postColors && (job->resizeLayout == job->outputFormat)) memcpy(dst, src, count*outputSize);
+    else
+    {
+        for (int i = 0; i < count; i += PIXELS_CONVERT_CHUNK)
+        {
+            int spanCount = count - i;
+            if (spanCount > PIXELS_CONVERT_CHUNK) spanCount = PIXELS_CONVERT_CHUNK;
+
+            ConvertPixelsToRGBA8(src + i*layoutSize, job->resizeLayout, pixels, spanCount);
+            if (job->resizeLayout != job->resizeFormat) QuantizePixelsSpan(pixels, job->resizeFormat, spanCount);
+            ApplyPipelineOperations(job, job->postStart, job->postEnd, job->resizeFormat, pixels, spanCount, false);
+            ConvertPixelsFromRGBA8(pixels, dst + i*outputSize, job->outputFormat, spanCount);
+        }
+    }
+}
+
+// Adjust image colors, pixels processed in parallel
+// NOTE: Float and half-float formats are adjusted in float precision by chunks (no 8 bit per channel round trip),
+// other formats are adjusted as R8G8B8A8 pixels and converted back to original format
+static void AdjustImageColors(Image *image, ColorAdjustJob *job)
+{
+    if (IsPixelFormatHDR(image->format))
+    {
+        job->data = (unsigned char *)image->data;
+        job->format = image->format;
+        ParallelFor(image->width*image->height, IMAGE_PARALLEL_MIN_PIXELS, AdjustColorsFloatBatch, job);
+    }
+    else
+    {
+        Color *pixels = LoadImageColors(*image);
+
+        job->pixels = pixels;
+        ParallelFor(image->width*image->height, IMAGE_PARALLEL_MIN_PIXELS, AdjustColorsBatch, job);
+
+        int format = image->format;
+        UnloadImageData(image->data);
+
+        image->data = pixels;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        ImageFormat(image, format);
+    }
+}
+
+// Adjust pixels colors in range [start, end)
+static void AdjustColorsBatch(int start, int end, void *data)
+{
+    ColorAdjustJob *job = (ColorAdjustJob *)data;
+    Color *pixels = job->pixels;
+
+    switch (job->mode)
+    {
+        case COLOR_ADJUST_TINT:
+        {
+            Color color = job->color;
+
+            for (int i = start; i < end; i++)
+            {
+                unsigned char r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
+                unsigned char g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
+                unsigned char b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
+                unsigned char a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+
+                pixels[i].r = r;
+                pixels[i].g = g;
+                pixels[i].b = b;
+                pixels[i].a = a;
+            }
+        } break;
+        case COLOR_ADJUST_INVERT:
+        {
+            for (int i = start; i < end; i++)
+            {
+                pixels[i].r = 255 - pixels[i].r;
+                pixels[i].g = 255 - pixels[i].g;
+                pixels[i].b = 255 - pixels[i].b;
+            }
+        } break;
+        case COLOR_ADJUST_CONTRAST:
+        {
+            float contrast = job->contrast;
+
+            for (int i = start; i < end; i++)
+            {
+                float pR = (float)pixels[i].r/255.0f;
+                pR -= 0.5f;
+                pR *= contrast;
+                pR += 0.5f;
+                pR *= 255;
+                if (pR < 0) pR = 0;
+                if (pR > 255) pR = 255;
+
+                float pG = (float)pixels[i].g/255.0f;
+                pG -= 0.5f;
+                pG *= contrast;
+                pG += 0.5f;
+                pG *= 255;
+                if (pG < 0) pG = 0;
+                if (pG > 255) pG = 255;
+
+                float pB = (float)pixels[i].b/255.0f;
+                pB -= 0.5f;
+                pB *= contrast;
+                pB += 0.5f;
+                pB *= 255;
+                if (pB < 0) pB = 0;
+                if (pB > 255) pB = 255;
+
+                pixels[i].r = (unsigned char)pR;
+                pixels[i].g = (unsigned char)pG;
+                pixels[i].b = (unsigned char)pB;
+            }
+        } break;
+        case COLOR_ADJUST_BRIGHTNESS:
+        {
+            int brightness = job->brightness;
+
+            for (int i = start; i < end; i++)
+            {
+                int cR = pixels[i].r + brightness;
+                int cG = pixels[i].g + brightness;
+                int cB = pixels[i].b + brightness;
+
+                if (cR < 0) cR = 1;
+                if (cR > 255) cR = 255;
+
+                if (cG < 0) cG = 1;
+                if (cG > 255) cG = 255;
+
+                if (cB < 0) cB = 1;
+                if (cB > 255) cB = 255;
+
+                pixels[i].r = (unsigned char)cR;
+                pixels[i].g = (unsigned char)cG;
+                pixels[i].b = (unsigned char)cB;
+            }
+        } break;
+        case COLOR_ADJUST_REPLACE:
+        {
+            Color color = job->color;
+            Color replace = job->replace;
+
+            for (int i = start; i < end; i++)
+            {
+                if ((pixels[i].r == color.r) &&
+                    (pixels[i].g == color.g) &&
+                    (pixels[i].b == color.b) &&
+                    (pixels[i].a == color.a))
+                {
+                    pixels[i].r = replace.r;
+                    pixels[i].g = replace.g;
+                    pixels[i].b = replace.b;
+                    pixels[i].a = replace.a;
+                }
+            }
+        } break;
+        case COLOR_ADJUST_PREMULTIPLY:
+        {
+            float alpha = 0.0f;
+
+            for (int i = start; i < end; i++)
+            {
+                if (pixels[i].a == 0)
+                {
+                    pixels[i].r = 0;
+                    pixels[i].g = 0;
+                    pixels[i].b = 0;
+                }
+                else if (pixels[i].a < 255)
+                {
+                    alpha = (float)pixels[i].a/255.0f;
+                    pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+                    pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+                    pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+                }
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Adjust float and half-float pixels colors in range [start, end), converted by chunks to float RGBA
+// NOTE: Values are not clamped to [0..1] range (contrast and brightness only clamp negative color values),
+// tint, invert, contrast and brightness are computed as value*scale + offset for the 4 channels at once using SIMD (when available)
+static void AdjustColorsFloatBatch(int start, int end, void *data)
+{
+    ColorAdjustJob *job = (ColorAdjustJob *)data;
+    int bytesPerPixel = GetPixelDataSize(1, 1, job->format);
+    float pixels[PIXELS_CONVERT_CHUNK*4] = { 0 };
+
+    float scale[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float offset[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    float minValue[4] = { -INFINITY, -INFINITY, -INFINITY, -INFINITY };
+
+    switch (job->mode)
+    {
+        case COLOR_ADJUST_TINT:
+        {
+            scale[0] = (float)job->color.r/255.0f;
+            scale[1] = (float)job->color.g/255.0f;
+            scale[2] = (float)job->color.b/255.0f;
+            scale[3] = (float)job->color.a/255.0f;
+        } break;
+        case COLOR_ADJUST_INVERT:
+        {
+            for (int c = 0; c < 3; c++) { scale[c] = -1.0f; offset[c] = 1.0f; }
+        } break;
+        case COLOR_ADJUST_CONTRAST:
+        {
+            for (int c = 0; c < 3; c++) { scale[c] = job->contrast; offset[c] = 0.5f - 0.5f*job->contrast; minValue[c] = 0.0f; }
+        } break;
+        case COLOR_ADJUST_BRIGHTNESS:
+        {
+            for (int c = 0; c < 3; c++) { offset[c] = (float)job->brightness/255.0f; minValue[c] = 0.0f; }
+        } break;
+        default: break;
+    }
+
+    for (int i = start; i < end; i += PIXELS_CONVERT_CHUNK)
+    {
+        int count = ((end - i) < PIXELS_CONVERT_CHUNK)? (end - i) : PIXELS_CONVERT_CHUNK;
+        unsigned char *chunk = job->data + (size_t)i*bytesPerPixel;
+        int k = 0;
+
+        ConvertPixelsToFloat(chunk, job->format, pixels, count);
+
+        if (job->mode == COLOR_ADJUST_REPLACE)
+        {
+            // Colors compared at 8 bit per channel precision, same as R8G8B8A8 conversion
+            unsigned char colors[PIXELS_CONVERT_CHUNK*4] = { 0 };
+            ConvertPixelsToRGBA8(pixels, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, colors, count);
+
+            for (; k < count; k++)
+            {
+                if ((colors[k*4] == job->color.r) && (colors[k*4 + 1] == job->color.g) &&
+                    (colors[k*4 + 2] == job->color.b) && (colors[k*4 + 3] == job->color.a))
+                {
+                    pixels[k*4] = (float)job->replace.r/255.0f;
+                    pixels[k*4 + 1] = (float)job->replace.g/255.0f;
+                    pixels[k*4 + 2] = (float)job->replace.b/255.0f;
+                    pixels[k*4 + 3] = (float)job->replace.a/255.0f;
+                }
+            }
+        }
+        else if (job->mode == COLOR_ADJUST_PREMULTIPLY)
+        {
+        #if defined(RL_SIMD_SSE2)
+            const __m128 colorMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+            const __m128 one = _mm_set1_ps(1.0f);
+
+            for (; k < count; k++)
+            {
+                __m128 pixel = _mm_loadu_ps(pixels + k*4);
+                __m128 alpha = _mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3));
+                _mm_storeu_ps(pixels + k*4, _mm_mul_ps(pixel, _mm_or_ps(_mm_and_ps(colorMask, alpha), _mm_andnot_ps(colorMask, one))));
+            }
+        #endif
+            for (; k < count; k++)
+            {
+                pixels[k*4] *= pixels[k*4 + 3];
+                pixels[k*4 + 1] *= pixels[k*4 + 3];
+                pixels[k*4 + 2] *= pixels[k*4 + 3];
+            }
+        }
+        else
+        {
+        #if defined(RL_SIMD_SSE2)
+            const __m128 vScale = _mm_loadu_ps(scale);
+            const __m128 vOffset = _mm_loadu_ps(offset);
+            const __m128 vMin = _mm_loadu_ps(minValue);
+
+            for (; k < count; k++) _mm_storeu_ps(pixels + k*4, _mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(pixels + k*4), vScale), vOffset), vMin));
+        #elif defined(RL_SIMD_NEON)
+            const float32x4_t vScale = vld1q_f32(scale);
+            const float32x4_t vOffset = vld1q_f32(offset);
+            const float32x4_t vMin = vld1q_f32(minValue);
+
+            for (; k < count; k++) vst1q_f32(pixels + k*4, vmaxq_f32(vaddq_f32(vmulq_f32(vld1q_f32(pixels + k*4), vScale), vOffset), vMin));
+        #endif
+            for (; k < count; k++)
+            {
+                for (int c = 0; c < 4; c++)
+                {
+                    float value = pixels[k*4 + c]*scale[c] + offset[c];
+                    pixels[k*4 + c] = (value > minValue[c])? value : minValue[c];
+                }
+            }
+        }
+
+        ConvertPixelsFromFloat(pixels, chunk, job->format, count);
+    }
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate linear gradient rows in range [start, end)
+static void GenGradientLinearBatch(int start, int end, void *data)
+{
+    GradientJob *job = (GradientJob *)data;
+    Color *pixels = job->pixels;
+    int width = job->width;
+
+    for (int j = start; j < end; j++)
+    {
+        for (int i = 0; i < width; i++)
+        {
+            // Calculate the relative position of the pixel along the gradient direction
+            float pos = (job->startingPos + (i*job->cosDir + j*job->sinDir))/job->maxPosValue;
+
+            float factor = pos;
+            factor = (factor > 1.0f)? 1.0f : factor;  // Clamp to [-1,1]
+            factor = (factor < -1.0f)? -1.0f : factor;  // Clamp to [-1,1]
+            factor = factor/2.0f + 0.5f;
+
+            // Generate the color for this pixel
+            pixels[j*width + i].r = (int)((float)job->end.r*factor + (float)job->start.r*(1.0f - factor));
+            pixels[j*width + i].g = (int)((float)job->end.g*factor + (float)job->start.g*(1.0f - factor));
+            pixels[j*width + i].b = (int)((float)job->end.b*factor + (float)job->start.b*(1.0f - factor));
+            pixels[j*width + i].a = (int)((float)job->end.a*factor + (float)job->start.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate radial gradient rows in range [start, end)
+static void GenGradientRadialBatch(int start, int end, void *data)
+{
+    GradientJob *job = (GradientJob *)data;
+    Color *pixels = job->pixels;
+    Color inner = job->start;
+    Color outer = job->end;
+    int width = job->width;
+    float density = job->density;
+    float radius = (job->width < job->height)? (float)job->width/2.0f : (float)job->height/2.0f;
+
+    float centerX = (float)job->width/2.0f;
+    float centerY = (float)job->height/2.0f;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float dist = hypotf((float)x - centerX, (float)y - centerY);
+            float factor = (dist - radius*density)/(radius*(1.0f - density));
+
+            factor = (float)fmax(factor, 0.0f);
+            factor = (float)fmin(factor, 1.f); // dist can be bigger than radius, so we have to check
+
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate square gradient rows in range [start, end)
+static void GenGradientSquareBatch(int start, int end, void *data)
+{
+    GradientJob *job = (GradientJob *)data;
+    Color *pixels = job->pixels;
+    Color inner = job->start;
+    Color outer = job->end;
+    int width = job->width;
+    float density = job->density;
+
+    float centerX = (float)job->width/2.0f;
+    float centerY = (float)job->height/2.0f;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            // Calculate the Manhattan distance from the center
+            float distX = fabsf(x - centerX);
+            float distY = fabsf(y - centerY);
+
+            // Normalize the distances by the dimensions of the gradient rectangle
+            float normalizedDistX = distX/centerX;
+            float normalizedDistY = distY/centerY;
+
+            // Calculate the total normalized Manhattan distance
+            float manhattanDist = fmaxf(normalizedDistX, normalizedDistY);
+
+            // Subtract the density from the manhattanDist, then divide by (1 - density)
+            // This makes the gradient start from the center when density is 0, and from the edge when density is 1
+            float factor = (manhattanDist - density)/(1.0f - density);
+
+            // Clamp the factor between 0 and 1
+            factor = fminf(fmaxf(factor, 0.0f), 1.0f);
+
+            // Blend the colors based on the calculated factor
+            pixels[y*width + x].r = (int)((float)outer.r*factor + (float)inner.r*(1.0f - factor));
+            pixels[y*width + x].g = (int)((float)outer.g*factor + (float)inner.g*(1.0f - factor));
+            pixels[y*width + x].b = (int)((float)outer.b*factor + (float)inner.b*(1.0f - factor));
+            pixels[y*width + x].a = (int)((float)outer.a*factor + (float)inner.a*(1.0f - factor));
+        }
+    }
+}
+
+// Generate checked pattern rows in range [start, end)
+static void GenCheckedBatch(int start, int end, void *data)
+{
+    GradientJob *job = (GradientJob *)data;
+    Color *pixels = job->pixels;
+    int width = job->width;
+    int checksX = job->checksX;
+    int checksY = job->checksY;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if ((x/checksX + y/checksY)%2 == 0) pixels[y*width + x] = job->start;
+            else pixels[y*width + x] = job->end;
+        }
+    }
+}
+
+// Generate perlin noise rows in range [start, end)
+// NOTE: Same results as stb_perlin_fbm_noise3() per pixel, noise evaluated by spans
+static void GenPerlinNoiseBatch(int start, int end, void *data)
+{
+    NoiseJob *job = (NoiseJob *)data;
+    Color *pixels = job->pixels;
+    int width = job->width;
+    int height = job->height;
+    int offsetX = job->offsetX;
+    int offsetY = job->offsetY;
+    float scale = job->scale;
+
+    float aspectRatio = (float)width/(float)height;
+
+    // Calculate a better perlin noise using fbm (fractal brownian motion)
+    // Typical values to start playing with:
+    //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+    //   gain       =  0.5   -- relative weighting applied to each successive octave
+    //   octaves    =  6     -- number of "octaves" of noise3() to sum
+    NoiseParams params = { .type = NOISE_FBM, .octaves = 6, .lacunarity = 2.0f, .gain = 0.5f };
+
+    float nx[NOISE_SPAN_SIZE] = { 0 };
+    float ny[NOISE_SPAN_SIZE] = { 0 };
+    float noise[NOISE_SPAN_SIZE] = { 0 };
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x += NOISE_SPAN_SIZE)
+        {
+            int count = ((width - x) < NOISE_SPAN_SIZE)? (width - x) : NOISE_SPAN_SIZE;
+
+            for (int i = 0; i < count; i++)
+            {
+                nx[i] = (float)(x + i + offsetX)*(scale/(float)width);
+                ny[i] = (float)(y + offsetY)*(scale/(float)height);
+
+                // Apply aspect ratio compensation to wider side
+                if (width > height) nx[i] *= aspectRatio;
+                else ny[i] /= aspectRatio;
+            }
+
+            FractalNoiseSpan(nx, ny, noise, count, &params);
+
+            for (int i = 0; i < count; i++)
+            {
+                float p = noise[i];
+
+                // Clamp between -1.0f and 1.0f (NaN-safe)
+                if (!(p > -1.0f)) p = -1.0f;
+                if (p > 1.0f) p = 1.0f;
+
+                // We need to normalize the data from [-1..1] to [0..1]
+                float np = (p + 1.0f)/2.0f;
+
+                int intensity = (int)(np*255.0f);
+                pixels[y*width + x + i] = (Color){ intensity, intensity, intensity, 255 };
+            }
+        }
+    }
+}
+
+// Generate fractal noise rows in range [start, end)
+// NOTE: Domain warping displaces noise coordinates by two fbm noise fields (offset coordinates)
+static void GenNoiseBatch(int start, int end, void *data)
+{
+    NoiseJob *job = (NoiseJob *)data;
+    float *values = job->values;
+    int width = job->width;
+    int height = job->height;
+    const NoiseParams *params = &job->params;
+
+    // Noise coordinates scale, aspect ratio compensation on wider side
+    float scaleX = params->scale/(float)width;
+    float scaleY = params->scale/(float)height;
+    if (width > height) scaleX *= (float)width/(float)height;
+    else scaleY *= (float)width/(float)height;
+
+    NoiseParams warpParams = *params;
+    warpParams.type = NOISE_FBM;
+
+    float nx[NOISE_SPAN_SIZE] = { 0 };
+    float ny[NOISE_SPAN_SIZE] = { 0 };
+    float wx[NOISE_SPAN_SIZE] = { 0 };
+    float wy[NOISE_SPAN_SIZE] = { 0 };
+    float noise[NOISE_SPAN_SIZE] = { 0 };
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x += NOISE_SPAN_SIZE)
+        {
+            int count = ((width - x) < NOISE_SPAN_SIZE)? (width - x) : NOISE_SPAN_SIZE;
+
+            for (int i = 0; i < count; i++)
+            {
+                nx[i] = ((float)(x + i) + params->offset.x)*scaleX;
+                ny[i] = ((float)y + params->offset.y)*scaleY;
+            }
+
+            if (params->warp != 0.0f)
+            {
+                // Second warp field sampled at offset coordinates (uncorrelated to first field)
+                FractalNoiseSpan(nx, ny, wx, count, &warpParams);
+
+                for (int i = 0; i < count; i++)
+                {
+                    noise[i] = nx[i] + 5.2f;
+                    wy[i] = ny[i] + 1.3f;
+                }
+
+                FractalNoiseSpan(noise, wy, wy, count, &warpParams);
+
+                for (int i = 0; i < count; i++)
+                {
+                    nx[i] += params->warp*wx[i];
+                    ny[i] += params->warp*wy[i];
+                }
+            }
+
+            FractalNoiseSpan(nx, ny, noise, count, params);
+
+            for (int i = 0; i < count; i++)
+            {
+                // Fbm noise normalized from [-1..1], ridged and turbulence noise are positive
+                float value = (params->type == NOISE_FBM)? (noise[i] + 1.0f)*0.5f : noise[i];
+
+                values[y*width + x + i] = !(value > 0.0f)? 0.0f : ((value > 1.0f)? 1.0f : value);    // NaN-safe clamp
+            }
+        }
+    }
+}
+
+// Compute fractal noise of samples span, perlin noise octaves summed (fbm, ridged, turbulence)
+// NOTE: Same results as stb_perlin_fbm_noise3(), stb_perlin_ridge_noise3() and stb_perlin_turbulence_noise3()
+// for z = 1.0f and seed 0, octaves noise variations selected by seed (8 bit)
+static void FractalNoiseSpan(const float *x, const float *y, float *noise, int count, const NoiseParams *params)
+{
+    float fx[NOISE_SPAN_SIZE] = { 0 };
+    float fy[NOISE_SPAN_SIZE] = { 0 };
+    float octave[NOISE_SPAN_SIZE] = { 0 };
+    float prev[NOISE_SPAN_SIZE] = { 0 };
+    float sum[NOISE_SPAN_SIZE] = { 0 };     // NOTE: Output written at the end, it could be one of the inputs
+
+    float frequency = 1.0f;
+    float amplitude = (params->type == NOISE_RIDGED)? 0.5f : 1.0f;
+
+    for (int i = 0; i < count; i++) prev[i] = 1.0f;
+
+    for (int o = 0; o < params->octaves; o++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            fx[i] = x[i]*frequency;
+            fy[i] = y[i]*frequency;
+        }
+
+        PerlinNoiseSpan(fx, fy, frequency, octave, count, (unsigned char)(params->seed + o));
+
+        switch (params->type)
+        {
+            case NOISE_RIDGED:
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    float r = params->ridgeOffset - fabsf(octave[i]);
+                    r = r*r;
+                    sum[i] += r*amplitude*prev[i];
+                    prev[i] = r;
+                }
+            } break;
+            case NOISE_TURBULENCE: for (int i = 0; i < count; i++) sum[i] += fabsf(octave[i]*amplitude); break;
+            default: for (int i = 0; i < count; i++) sum[i] += octave[i]*amplitude; break;
+        }
+
+        frequency *= params->lacunarity;
+        amplitude *= params->gain;
+    }
+
+    memcpy(noise, sum, count*sizeof(float));
+}
+
+// Compute perlin noise of samples span, samples sharing z coordinate
+// NOTE: Same results as stb_perlin_noise3_seed() with no wrapping, lattice hashing is scalar,
+// gradients and interpolation are computed for 4 samples at once using SIMD (when available)
+static void PerlinNoiseSpan(const float *x, const float *y, float z, float *noise, int count, unsigned char seed)
+{
+    int i = 0;
+
+#if defined(RL_SIMD_SSE2) || defined(RL_SIMD_NEON)
+    // Lattice z coordinates and interpolation factor shared by all samples
+    int pz = (int)z;
+    if (z < pz) pz--;
+    int z0 = pz & 255;
+    int z1 = (pz + 1) & 255;
+    float dz = z - pz;
+    float w = ((dz*6 - 15)*dz + 10)*dz*dz*dz;
+
+    int px[4] = { 0 };
+    int py[4] = { 0 };
+    int gradIndex[8][4] = { 0 };    // Lattice corners gradients, [corner][sample]
+    int cellIndex[8] = { 0 };       // Last hashed lattice cell corners gradients
+    int cellX = 0;
+    int cellY = 0;
+    bool cellHashed = false;
+
+    for (; (i + 4) <= count; i += 4)
+    {
+    #if defined(RL_SIMD_SSE2)
+        const __m128 one = _mm_set1_ps(1.0f);
+        __m128 sx = _mm_loadu_ps(x + i);
+        __m128 sy = _mm_loadu_ps(y + i);
+
+        // Floor, truncated values bigger than samples decremented
+        __m128 fx = _mm_cvtepi32_ps(_mm_cvttps_epi32(sx));
+        __m128 fy = _mm_cvtepi32_ps(_mm_cvttps_epi32(sy));
+        fx = _mm_sub_ps(fx, _mm_and_ps(_mm_cmplt_ps(sx, fx), one));
+        fy = _mm_sub_ps(fy, _mm_and_ps(_mm_cmplt_ps(sy, fy), one));
+        _mm_storeu_si128((__m128i *)px, _mm_cvttps_epi32(fx));
+        _mm_storeu_si128((__m128i *)py, _mm_cvttps_epi32(fy));
+        sx = _mm_sub_ps(sx, fx);
+        sy = _mm_sub_ps(sy, fy);
+    #elif defined(RL_SIMD_NEON)
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        float32x4_t sx = vld1q_f32(x + i);
+        float32x4_t sy = vld1q_f32(y + i);
+
+        // Floor, truncated values bigger than samples decremented
+        float32x4_t fx = vcvtq_f32_s32(vcvtq_s32_f32(sx));
+        float32x4_t fy = vcvtq_f32_s32(vcvtq_s32_f32(sy));
+        fx = vsubq_f32(fx, vreinterpretq_f32_u32(vandq_u32(vcltq_f32(sx, fx), vreinterpretq_u32_f32(one))));
+        fy = vsubq_f32(fy, vreinterpretq_f32_u32(vandq_u32(vcltq_f32(sy, fy), vreinterpretq_u32_f32(one))));
+        vst1q_s32(px, vcvtq_s32_f32(fx));
+        vst1q_s32(py, vcvtq_s32_f32(fy));
+        sx = vsubq_f32(sx, fx);
+        sy = vsubq_f32(sy, fy);
+    #endif
+
+        // Lattice corners hashing, adjacent samples usually share lattice cell
+        bool sameCell = (px[0] == px[3]) && (px[1] == px[3]) && (px[2] == px[3]) && (py[0] == py[3]) && (py[1] == py[3]) && (py[2] == py[3]);
+
+        for (int k = sameCell? 3 : 0; k < 4; k++)
+        {
+            if (!cellHashed || (px[k] != cellX) || (py[k] != cellY))
+            {
+                cellX = px[k];
+                cellY = py[k];
+                cellHashed = true;
+
+                int r0 = stb__perlin_randtab[(cellX & 255) + seed];
+                int r1 = stb__perlin_randtab[((cellX + 1) & 255) + seed];
+                int y0 = cellY & 255;
+                int y1 = (cellY + 1) & 255;
+                int r00 = stb__perlin_randtab[r0 + y0];
+                int r01 = stb__perlin_randtab[r0 + y1];
+                int r10 = stb__perlin_randtab[r1 + y0];
+                int r11 = stb__perlin_randtab[r1 + y1];
+
+                cellIndex[0] = stb__perlin_randtab_grad_idx[r00 + z0];
+                cellIndex[1] = stb__perlin_randtab_grad_idx[r00 + z1];
+                cellIndex[2] = stb__perlin_randtab_grad_idx[r01 + z0];
+                cellIndex[3] = stb__perlin_randtab_grad_idx[r01 + z1];
+                cellIndex[4] = stb__perlin_randtab_grad_idx[r10 + z0];
+                cellIndex[5] = stb__perlin_randtab_grad_idx[r10 + z1];
+                cellIndex[6] = stb__perlin_randtab_grad_idx[r11 + z0];
+                cellIndex[7] = stb__perlin_randtab_grad_idx[r11 + z1];
+            }
+
+            if (!sameCell) for (int c = 0; c < 8; c++) gradIndex[c][k] = cellIndex[c];
+        }
+
+        // NOTE: Gradients are sums of two signed coordinates: x + y [0..3], x + z [4..7], y + z [8..11],
+        // first coordinate negated by gradient index bit 0, second coordinate negated by bit 1
+    #if defined(RL_SIMD_SSE2)
+        __m128 u = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(sx, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f)), sx), _mm_set1_ps(10.0f)), sx), sx), sx);
+        __m128 v = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(sy, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f)), sy), _mm_set1_ps(10.0f)), sy), sy), sy);
+        __m128 cx[2] = { sx, _mm_sub_ps(sx, one) };
+        __m128 cy[2] = { sy, _mm_sub_ps(sy, one) };
+        __m128 cz[2] = { _mm_set1_ps(dz), _mm_set1_ps(dz - 1) };
+        __m128 n[8];
+
+        for (int c = 0; c < 8; c++)
+        {
+            __m128i index = sameCell? _mm_set1_epi32(cellIndex[c]) : _mm_loadu_si128((const __m128i *)gradIndex[c]);
+            __m128 firstX = _mm_castsi128_ps(_mm_cmplt_epi32(index, _mm_set1_epi32(8)));
+            __m128 secondY = _mm_castsi128_ps(_mm_cmplt_epi32(index, _mm_set1_epi32(4)));
+            __m128 first = _mm_or_ps(_mm_and_ps(firstX, cx[c/4]), _mm_andnot_ps(firstX, cy[(c/2)%2]));
+            __m128 second = _mm_or_ps(_mm_and_ps(secondY, cy[(c/2)%2]), _mm_andnot_ps(secondY, cz[c%2]));
+            first = _mm_xor_ps(first, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(index, _mm_set1_epi32(1)), 31)));
+            second = _mm_xor_ps(second, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(index, _mm_set1_epi32(2)), 30)));
+            n[c] = _mm_add_ps(first, second);
+        }
+
+        // Trilinear interpolation: a + (b - a)*t
+        __m128 tw = _mm_set1_ps(w);
+        for (int c = 0; c < 4; c++) n[c] = _mm_add_ps(n[c*2], _mm_mul_ps(_mm_sub_ps(n[c*2 + 1], n[c*2]), tw));
+        for (int c = 0; c < 2; c++) n[c] = _mm_add_ps(n[c*2], _mm_mul_ps(_mm_sub_ps(n[c*2 + 1], n[c*2]), v));
+        _mm_storeu_ps(noise + i, _mm_add_ps(n[0], _mm_mul_ps(_mm_sub_ps(n[1], n[0]), u)));
+    #elif defined(RL_SIMD_NEON)
+        float32x4_t u = vmulq_f32(vmulq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vsubq_f32(vmulq_f32(sx, vdupq_n_f32(6.0f)), vdupq_n_f32(15.0f)), sx), vdupq_n_f32(10.0f)), sx), sx), sx);
+        float32x4_t v = vmulq_f32(vmulq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vsubq_f32(vmulq_f32(sy, vdupq_n_f32(6.0f)), vdupq_n_f32(15.0f)), sy), vdupq_n_f32(10.0f)), sy), sy), sy);
+        float32x4_t cx[2] = { sx, vsubq_f32(sx, one) };
+        float32x4_t cy[2] = { sy, vsubq_f32(sy, one) };
+        float32x4_t cz[2] = { vdupq_n_f32(dz), vdupq_n_f32(dz - 1) };
+        float32x4_t n[8];
+
+        for (int c = 0; c < 8; c++)
+        {
+            int32x4_t index = sameCell? vdupq_n_s32(cellIndex[c]) : vld1q_s32(gradIndex[c]);
+            float32x4_t first = vbslq_f32(vcltq_s32(index, vdupq_n_s32(8)), cx[c/4], cy[(c/2)%2]);
+            float32x4_t second = vbslq_f32(vcltq_s32(index, vdupq_n_s32(4)), cy[(c/2)%2], cz[c%2]);
+            first = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(first), vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(index), vdupq_n_u32(1)), 31)));
+            second = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(second), vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(index), vdupq_n_u32(2)), 30)));
+            n[c] = vaddq_f32(first, second);
+        }
+
+        // Trilinear interpolation: a + (b - a)*t
+        float32x4_t tw = vdupq_n_f32(w);
+        for (int c = 0; c < 4; c++) n[c] = vaddq_f32(n[c*2], vmulq_f32(vsubq_f32(n[c*2 + 1], n[c*2]), tw));
+        for (int c = 0; c < 2; c++) n[c] = vaddq_f32(n[c*2], vmulq_f32(vsubq_f32(n[c*2 + 1], n[c*2]), v));
+        vst1q_f32(noise + i, vaddq_f32(n[0], vmulq_f32(vsubq_f32(n[1], n[0]), u)));
+    #endif
+    }
+#endif
+
+    for (; i < count; i++) noise[i] = stb_perlin_noise3_internal(x[i], y[i], z, 0, 0, 0, seed);
+}
+
+// Generate cellular rows in range [start, end)
+// NOTE: Squared distances to adjacent tiles seeds computed in float (exact up to big tile sizes),
+// seeds gathered once per row tile, only minimum distance square root computed
+static void GenCellularBatch(int start, int end, void *data)
+{
+    NoiseJob *job = (NoiseJob *)data;
+    Color *pixels = job->pixels;
+    const Vector2 *seeds = job->seeds;
+    int width = job->width;
+    int seedsPerRow = job->seedsPerRow;
+    int seedsPerCol = job->seedsPerCol;
+    int tileSize = job->tileSize;
+
+    int seedX[9] = { 0 };
+    float seedDistY2[9] = { 0 };
+
+    for (int y = start; y < end; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int tileX = 0; tileX*tileSize < width; tileX++)
+        {
+            int seedCount = 0;
+
+            // Check all adjacent tiles
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+
+                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+                    int distY = y - (int)neighborSeed.y;
+
+                    seedX[seedCount] = (int)neighborSeed.x;
+                    seedDistY2[seedCount] = (float)(distY*distY);
+                    seedCount++;
+                }
+            }
+
+            int endX = (tileX + 1)*tileSize;
+            if (endX > width) endX = width;
+
+            for (int x = tileX*tileSize; x < endX; x++)
+            {
+                float minDistance2 = 65536.0f*65536.0f;
+
+                for (int k = 0; k < seedCount; k++)
+                {
+                    float distX = (float)(x - seedX[k]);
+                    float distance2 = distX*distX + seedDistY2[k];
+                    if (distance2 < minDistance2) minDistance2 = distance2;
+                }
+
+                float minDistance = sqrtf(minDistance2);
+
+                // I made this up, but it seems to give good results at all tile sizes
+                int intensity = (int)(minDistance*256.0f/tileSize);
+                if (intensity > 255) intensity = 255;
+
+                pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+            }
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Box blur a span of 16 bit RGBA pixels (src and dst must not overlap)
+// NOTE: Integer sliding window sums (exact up to 65537 pixels window), window is clamped to span limits,
+// averages are computed for the 4 channels at once using SIMD (when available)
+static void BoxBlurSpan(const unsigned short *src, unsigned short *dst, int count, int radius)
+{
+    int last = (radius < count)? radius : count - 1;    // Last pixel of first window
+    int size = last + 1;
+    float scale = 1.0f/(float)size;
+
+#if defined(RL_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 half = _mm_set1_ps(0.5f);
+    __m128i sum = zero;
+
+    for (int i = 0; i <= last; i++) sum = _mm_add_epi32(sum, _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(src + i*4)), zero));
+#elif defined(RL_SIMD_NEON)
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    uint32x4_t sum = vdupq_n_u32(0);
+
+    for (int i = 0; i <= last; i++) sum = vaddw_u16(sum, vld1_u16(src + i*4));
+#else
+    unsigned int sum[4] = { 0 };
+
+    for (int i = 0; i <= last; i++) for (int c = 0; c < 4; c++) sum[c] += src[i*4 + c];
+#endif
+
+    for (int x = 0; x < count; x++)
+    {
+        if (x > 0)
+        {
+            int previousSize = size;
+
+            if ((x + radius) < count)
+            {
+                const unsigned short *pixel = src + (x + radius)*4;
+            #if defined(RL_SIMD_SSE2)
+                sum = _mm_add_epi32(sum, _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)pixel), zero));
+            #elif defined(RL_SIMD_NEON)
+                sum = vaddw_u16(sum, vld1_u16(pixel));
+            #else
+                for (int c = 0; c < 4; c++) sum[c] += pixel[c];
+            #endif
+                size++;
+            }
+
+            if ((x - radius - 1) >= 0)
+            {
+                const unsigned short *pixel = src + (x - radius - 1)*4;
+            #if defined(RL_SIMD_SSE2)
+                sum = _mm_sub_epi32(sum, _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)pixel), zero));
+            #elif defined(RL_SIMD_NEON)
+                sum = vsubw_u16(sum, vld1_u16(pixel));
+            #else
+                for (int c = 0; c < 4; c++) sum[c] -= pixel[c];
+            #endif
+                size--;
+            }
+
+            if (size != previousSize) scale = 1.0f/(float)size;     // Only at span limits
+        }
+
+        // Average rounded to nearest, float rounding error is far below 16 bit precision
+    #if defined(RL_SIMD_SSE2)
+        // NOTE: Averages are biased to signed range to be packed with saturation (no unsigned pack on SSE2)
+        __m128i average = _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum), _mm_set1_ps(scale)), half)), _mm_set1_epi32(32768));
+        average = _mm_xor_si128(_mm_packs_epi32(average, average), _mm_set1_epi16((short)0x8000));
+        _mm_storel_epi64((__m128i *)(dst + x*4), average);
+    #elif defined(RL_SIMD_NEON)
+        vst1_u16(dst + x*4, vmovn_u32(vcvtq_u32_f32(vaddq_f32(vmulq_n_f32(vcvtq_f32_u32(sum), scale), half))));
+    #else
+        for (int c = 0; c < 4; c++) dst[x*4 + c] = (unsigned short)((float)sum[c]*scale + 0.5f);
+    #endif
+    }
+}
+
+// Box blur rows in range [start, end), horizontal passes
+// NOTE: Pixels are converted to 16 bit per channel with alpha premultiplied before blurring
+static void BlurRowsBatch(int start, int end, void *data)
+{
+    BlurJob *job = (BlurJob *)data;
+    int width = job->width;
+    unsigned short *line = (unsigned short *)RL_MALLOC(width*4*sizeof(unsigned short));
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *pixels = (const unsigned char *)(job->pixels + (size_t)y*width);
+        unsigned short *row = job->channels + (size_t)y*width*4;
+
+        for (int x = 0; x < width; x++)
+        {
+            unsigned int alpha = pixels[x*4 + 3];
+
+            // Premultiplied color scaled to 16 bit: color*alpha*65535/(255*255), rounded
+            row[x*4] = (unsigned short)((pixels[x*4]*alpha*257 + 127)/255);
+            row[x*4 + 1] = (unsigned short)((pixels[x*4 + 1]*alpha*257 + 127)/255);
+            row[x*4 + 2] = (unsigned short)((pixels[x*4 + 2]*alpha*257 + 127)/255);
+            row[x*4 + 3] = (unsigned short)(alpha*257);
+        }
+
+        for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
+        {
+            memcpy(line, row, width*4*sizeof(unsigned short));
+            BoxBlurSpan(line, row, width, job->blurSize);
+        }
+    }
+
+    RL_FREE(line);
+}
+
+// Box blur column tiles in range [start, end), vertical passes
+// NOTE: Tiles are transposed so every column is contiguous in memory,
+// alpha premultiply is reverted after blurring, converting back to 8 bit per channel
+static void BlurColumnsBatch(int start, int end, void *data)
+{
+    BlurJob *job = (BlurJob *)data;
+    const unsigned short *channels = job->channels;
+    int width = job->width;
+    int height = job->height;
+
+    unsigned short *tile = (unsigned short *)RL_MALLOC(GAUSSIAN_BLUR_TILE*height*4*sizeof(unsigned short));
+    unsigned short *tileBlur = (unsigned short *)RL_MALLOC(GAUSSIAN_BLUR_TILE*height*4*sizeof(unsigned short));
+
+    for (int t = start; t < end; t++)
+    {
+        int offsetX = t*GAUSSIAN_BLUR_TILE;
+        int tileWidth = ((width - offsetX) < GAUSSIAN_BLUR_TILE)? (width - offsetX) : GAUSSIAN_BLUR_TILE;
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int c = 0; c < tileWidth; c++) memcpy(tile + ((size_t)c*height + y)*4, channels + ((size_t)y*width + offsetX + c)*4, 4*sizeof(unsigned short));
+        }
+
+        for (int c = 0; c < tileWidth; c++)
+        {
+            unsigned short *src = tile + (size_t)c*height*4;
+            unsigned short *dst = tileBlur + (size_t)c*height*4;
+
+            for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
+            {
+                BoxBlurSpan(src, dst, height, job->blurSize);
+
+                unsigned short *temp = src;
+                src = dst;
+                dst = temp;
+            }
+
+            if (src != (tile + (size_t)c*height*4)) memcpy(tile + (size_t)c*height*4, src, height*4*sizeof(unsigned short));
+        }
+
+        // Reverse premultiply, rounded to 8 bit per channel
+        for (int y = 0; y < height; y++)
+        {
+            for (int c = 0; c < tileWidth; c++)
+            {
+                const unsigned short *value = tile + ((size_t)c*height + y)*4;
+                unsigned int alpha = value[3];
+                Color color = { 0 };
+
+                if (alpha > 0)
+                {
+                    unsigned int r = (value[0]*255 + alpha/2)/alpha;
+                    unsigned int g = (value[1]*255 + alpha/2)/alpha;
+                    unsigned int b = (value[2]*255 + alpha/2)/alpha;
+
+                    color.r = (unsigned char)((r > 255)? 255 : r);
+                    color.g = (unsigned char)((g > 255)? 255 : g);
+                    color.b = (unsigned char)((b > 255)? 255 : b);
+                    color.a = (unsigned char)((alpha + 128)/257);
+                }
+
+                job->pixels[(size_t)y*width + offsetX + c] = color;
+            }
+        }
+    }
+
+    RL_FREE(tile);
+    RL_FREE(tileBlur);
+}
+
+// Box blur a span of float RGBA pixels, src and dst must not overlap
+// NOTE: Sliding window sums kept in double precision (no drift on long spans), window is clamped to span limits,
+// sums are computed for the 4 channels at once using SIMD (when available)
+static void BoxBlurFloatSpan(const float *src, float *dst, int count, int radius)
+{
+    int last = (radius < count)? radius : count - 1;    // Last pixel of first window
+    int size = last + 1;
+    double scale = 1.0/(double)size;
+
+#if defined(RL_SIMD_SSE2)
+    __m128d sumLo = _mm_setzero_pd();   // Red and green sums
+    __m128d sumHi = _mm_setzero_pd();   // Blue and alpha sums
+
+    for (int i = 0; i <= last; i++)
+    {
+        __m128 pixel = _mm_loadu_ps(src + i*4);
+        sumLo = _mm_add_pd(sumLo, _mm_cvtps_pd(pixel));
+        sumHi = _mm_add_pd(sumHi, _mm_cvtps_pd(_mm_movehl_ps(pixel, pixel)));
+    }
+#else
+    double sum[4] = { 0 };
+
+    for (int i = 0; i <= last; i++) for (int c = 0; c < 4; c++) sum[c] += src[i*4 + c];
+#endif
+
+    for (int x = 0; x < count; x++)
+    {
+        if (x > 0)
+        {
+            int previousSize = size;
+
+            if ((x + radius) < count)
+            {
+                const float *pixel = src + (x + radius)*4;
+            #if defined(RL_SIMD_SSE2)
+                __m128 value = _mm_loadu_ps(pixel);
+                sumLo = _mm_add_pd(sumLo, _mm_cvtps_pd(value));
+                sumHi = _mm_add_pd(sumHi, _mm_cvtps_pd(_mm_movehl_ps(value, value)));
+            #else
+                for (int c = 0; c < 4; c++) sum[c] += pixel[c];
+            #endif
+                size++;
+            }
+
+            if ((x - radius - 1) >= 0)
+            {
+                const float *pixel = src + (x - radius - 1)*4;
+            #if defined(RL_SIMD_SSE2)
+                __m128 value = _mm_loadu_ps(pixel);
+                sumLo = _mm_sub_pd(sumLo, _mm_cvtps_pd(value));
+                sumHi = _mm_sub_pd(sumHi, _mm_cvtps_pd(_mm_movehl_ps(value, value)));
+            #else
+                for (int c = 0; c < 4; c++) sum[c] -= pixel[c];
+            #endif
+                size--;
+            }
+
+            if (size != previousSize) scale = 1.0/(double)size;     // Only at span limits
+        }
+
+    #if defined(RL_SIMD_SSE2)
+        __m128d vScale = _mm_set1_pd(scale);
+        _mm_storeu_ps(dst + x*4, _mm_movelh_ps(_mm_cvtpd_ps(_mm_mul_pd(sumLo, vScale)), _mm_cvtpd_ps(_mm_mul_pd(sumHi, vScale))));
+    #else
+        for (int c = 0; c < 4; c++) dst[x*4 + c] = (float)(sum[c]*scale);
+    #endif
+    }
+}
+
+// Box blur float RGBA rows in range [start, end), horizontal passes
+// NOTE: Alpha is premultiplied before blurring
+static void BlurRowsFloatBatch(int start, int end, void *data)
+{
+    BlurJob *job = (BlurJob *)data;
+    int width = job->width;
+    float *line = (float *)RL_MALLOC(width*4*sizeof(float));
+
+    for (int y = start; y < end; y++)
+    {
+        float *row = job->values + (size_t)y*width*4;
+
+        for (int x = 0; x < width; x++)
+        {
+            row[x*4] *= row[x*4 + 3];
+            row[x*4 + 1] *= row[x*4 + 3];
+            row[x*4 + 2] *= row[x*4 + 3];
+        }
+
+        for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
+        {
+            memcpy(line, row, width*4*sizeof(float));
+            BoxBlurFloatSpan(line, row, width, job->blurSize);
+        }
+    }
+
+    RL_FREE(line);
+}
+
+// Box blur float RGBA column tiles in range [start, end), vertical passes
+// NOTE: Tiles are transposed so every column is contiguous in memory,
+// alpha premultiply is reverted after blurring
+static void BlurColumnsFloatBatch(int start, int end, void *data)
+{
+    BlurJob *job = (BlurJob *)data;
+    float *values = job->values;
+    int width = job->width;
+    int height = job->height;
+
+    float *tile = (float *)RL_MALLOC(GAUSSIAN_BLUR_TILE*height*4*sizeof(float));
+    float *tileBlur = (float *)RL_MALLOC(GAUSSIAN_BLUR_TILE*height*4*sizeof(float));
+
+    for (int t = start; t < end; t++)
+    {
+        int offsetX = t*GAUSSIAN_BLUR_TILE;
+        int tileWidth = ((width - offsetX) < GAUSSIAN_BLUR_TILE)? (width - offsetX) : GAUSSIAN_BLUR_TILE;
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int c = 0; c < tileWidth; c++) memcpy(tile + (c*height + y)*4, values + ((size_t)y*width + offsetX + c)*4, 4*sizeof(float));
+        }
+
+        for (int c = 0; c < tileWidth; c++)
+        {
+            float *src = tile + c*height*4;
+            float *dst = tileBlur + c*height*4;
+
+            for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
+            {
+                BoxBlurFloatSpan(src, dst, height, job->blurSize);
+
+                float *temp = src;
+                src = dst;
+                dst = temp;
+            }
+
+            if (src != (tile + c*height*4)) memcpy(tile + c*height*4, src, height*4*sizeof(float));
+        }
+
+        // Reverse premultiply
+        for (int y = 0; y < height; y++)
+        {
+            for (int c = 0; c < tileWidth; c++)
+            {
+                const float *pixel = tile + (c*height + y)*4;
+                float *output = values + ((size_t)y*width + offsetX + c)*4;
+                float alpha = pixel[3];
+
+                if (alpha <= 0.0f)
+                {
+                    output[0] = 0.0f;
+                    output[1] = 0.0f;
+                    output[2] = 0.0f;
+                    output[3] = 0.0f;
+                }
+                else
+                {
+                    output[0] = pixel[0]/alpha;
+                    output[1] = pixel[1]/alpha;
+                    output[2] = pixel[2]/alpha;
+                    output[3] = alpha;
+                }
+            }
+        }
+    }
+
+    RL_FREE(tile);
+    RL_FREE(tileBlur);
+}
+
+// Convolve image rows in range [start, end) with kernel
+static void ConvolveRowsBatch(int start, int end, void *data)
+{
+    ConvolutionJob *job = (ConvolutionJob *)data;
+    const Vector4 *pixels = job->pixels;
+    const float *kernel = job->kernel;
+    int width = job->width;
+    int kernelWidth = job->kernelWidth;
+    int kernelSize = kernelWidth*kernelWidth;
+
+    Vector4 *temp = RL_CALLOC(kernelSize, sizeof(Vector4));
+
+    float rRes = 0.0f;
+    float gRes = 0.0f;
+    float bRes = 0.0f;
+    float aRes = 0.0f;
+
+    for (int x = start; x < end; x++)
+    {
+        for (int y = 0; y < width; y++)
+        {
+            for (int xk = job->startRange; xk < job->endRange; xk++)
+            {
+                for (int yk = job->startRange; yk < job->endRange; yk++)
+                {
+                    int xkabs = xk + kernelWidth/2;
+                    int ykabs = yk + kernelWidth/2;
+                    unsigned int imgindex = width*(x + xk) + (y + yk);
+
+                    if (imgindex >= (unsigned int)(width*job->height))
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
+                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
+                    }
+                    else
+                    {
+                        temp[kernelWidth*xkabs + ykabs].x = pixels[imgindex].x*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].y = pixels[imgindex].y*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].z = pixels[imgindex].z*kernel[kernelWidth*xkabs + ykabs];
+                        temp[kernelWidth*xkabs + ykabs].w = pixels[imgindex].w*kernel[kernelWidth*xkabs + ykabs];
+                    }
+                }
+            }
+
+            for (int i = 0; i < kernelSize; i++)
+            {
+                rRes += temp[i].x;
+                gRes += temp[i].y;
+                bRes += temp[i].z;
+                aRes += temp[i].w;
+            }
+
+            if (rRes < 0.0f) rRes = 0.0f;
+            if (gRes < 0.0f) gRes = 0.0f;
+            if (bRes < 0.0f) bRes = 0.0f;
+
+            if (!job->hdr)
+            {
+                if (rRes > 1.0f) rRes = 1.0f;
+                if (gRes > 1.0f) gRes = 1.0f;
+                if (bRes > 1.0f) bRes = 1.0f;
+            }
+
+            job->output[width*x + y].x = rRes;
+            job->output[width*x + y].y = gRes;
+            job->output[width*x + y].z = bRes;
+            job->output[width*x + y].w = aRes;
+
+            rRes = 0.0f;
+            gRes = 0.0f;
+            bRes = 0.0f;
+            aRes = 0.0f;
+
+            for (int i = 0; i < kernelSize; i++)
+            {
+                temp[i].x = 0.0f;
+                temp[i].y = 0.0f;
+                temp[i].z = 0.0f;
+                temp[i].w = 0.0f;
+            }
+        }
+    }
+
+    RL_FREE(temp);
+}
+
+// Rotate image rows in range [start, end) (bilinear)
+static void RotateRowsBatch(int start, int end, void *data)
+{
+    RotateJob *job = (RotateJob *)data;
+    int width = job->width;
+    int height = job->height;
+    int bytesPerPixel = job->bytesPerPixel;
+    float sinRadius = job->sinRadius;
+    float cosRadius = job->cosRadius;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + job->srcWidth/2.0f;
+            float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + job->srcHeight/2.0f;
+
+            if ((oldX >= 0) && (oldX < job->srcWidth) && (oldY >= 0) && (oldY < job->srcHeight))
+            {
+                int x1 = (int)floorf(oldX);
+                int y1 = (int)floorf(oldY);
+                int x2 = MIN(x1 + 1, job->srcWidth - 1);
+                int y2 = MIN(y1 + 1, job->srcHeight - 1);
+
+                float px = oldX - x1;
+                float py = oldY - y1;
+
+                for (int i = 0; i < bytesPerPixel; i++)
+                {
+                    float f1 = job->src[(y1*job->srcWidth + x1)*bytesPerPixel + i];
+                    float f2 = job->src[(y1*job->srcWidth + x2)*bytesPerPixel + i];
+                    float f3 = job->src[(y2*job->srcWidth + x1)*bytesPerPixel + i];
+                    float f4 = job->src[(y2*job->srcWidth + x2)*bytesPerPixel + i];
+
+                    float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+
+                    job->dst[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
+                }
+            }
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+// Reduce mipmap level rows in range [start, end), 2x2 box filter from source level
+// NOTE: Odd source dimensions drop last row/column, 1 pixel dimensions are only reduced on the other axis
+static void ReduceMipmapRowsBatch(int start, int end, void *data)
+{
+    MipmapJob *job = (MipmapJob *)data;
+    int channels = job->channels;
+    int colorChannels = ((channels == 2) || (channels == 4))? channels - 1 : channels;
+    int srcStride = job->srcWidth*channels;
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *row0 = job->src + (size_t)((2*y < job->srcHeight)? 2*y : job->srcHeight - 1)*srcStride;
+        const unsigned char *row1 = job->src + (size_t)((2*y + 1 < job->srcHeight)? 2*y + 1 : job->srcHeight - 1)*srcStride;
+        unsigned char *dst = job->dst + (size_t)y*job->width*channels;
+        int x = 0;
+
+        // Full pixel pairs available: vectorized span (gamma space)
+        if ((job->toLinear == NULL) && (job->srcWidth >= 2*job->width)) x = ReduceMipmapSpan(row0, row1, dst, job->width, channels);
+
+        for (; x < job->width; x++)
+        {
+            int x0 = 2*x*channels;
+            int x1 = ((2*x + 1) < job->srcWidth)? x0 + channels : x0;
+
+            for (int c = 0; c < channels; c++)
+            {
+                if ((job->toLinear != NULL) && (c < colorChannels))
+                {
+                    int sum = job->toLinear[row0[x0 + c]] + job->toLinear[row0[x1 + c]] + job->toLinear[row1[x0 + c]] + job->toLinear[row1[x1 + c]];
+                    int linear = (sum + 32) >> 6;   // Average (16 bit) to 12 bit
+                    dst[x*channels + c] = (unsigned char)job->toSrgb[(linear < 4095)? linear : 4095];
+                }
+                else dst[x*channels + c] = (unsigned char)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+            }
+        }
+    }
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Reduce float and half-float mipmap level rows in range [start, end), 2x2 box filter from source level
+// NOTE: Same sampling as ReduceMipmapRowsBatch(), values averaged in float precision (not clamped),
+// float pixels with 4 channels are averaged at once using SIMD (when available)
+static void ReduceMipmapRowsFloatBatch(int start, int end, void *data)
+{
+    MipmapJob *job = (MipmapJob *)data;
+    int channels = job->channels;
+    size_t srcStride = (size_t)job->srcWidth*channels*job->channelSize;
+    size_t dstStride = (size_t)job->width*channels*job->channelSize;
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *row0 = job->src + (size_t)((2*y < job->srcHeight)? 2*y : job->srcHeight - 1)*srcStride;
+        const unsigned char *row1 = job->src + (size_t)((2*y + 1 < job->srcHeight)? 2*y + 1 : job->srcHeight - 1)*srcStride;
+        unsigned char *dst = job->dst + (size_t)y*dstStride;
+
+        for (int x = 0; x < job->width; x++)
+        {
+            int x0 = 2*x*channels;
+            int x1 = ((2*x + 1) < job->srcWidth)? x0 + channels : x0;
+
+            if (job->channelSize == 4)
+            {
+                const float *a = (const float *)row0;
+                const float *b = (const float *)row1;
+                float *pixel = (float *)dst + x*channels;
+
+            #if defined(RL_SIMD_SSE2)
+                if (channels == 4)
+                {
+                    __m128 sum = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(a + x0), _mm_loadu_ps(a + x1)), _mm_add_ps(_mm_loadu_ps(b + x0), _mm_loadu_ps(b + x1)));
+                    _mm_storeu_ps(pixel, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+                    continue;
+                }
+            #elif defined(RL_SIMD_NEON)
+                if (channels == 4)
+                {
+                    float32x4_t sum = vaddq_f32(vaddq_f32(vld1q_f32(a + x0), vld1q_f32(a + x1)), vaddq_f32(vld1q_f32(b + x0), vld1q_f32(b + x1)));
+                    vst1q_f32(pixel, vmulq_n_f32(sum, 0.25f));
+                    continue;
+                }
+            #endif
+                for (int c = 0; c < channels; c++) pixel[c] = ((a[x0 + c] + a[x1 + c]) + (b[x0 + c] + b[x1 + c]))*0.25f;
+            }
+            else
+            {
+                const unsigned short *a = (const unsigned short *)row0;
+                const unsigned short *b = (const unsigned short *)row1;
+                unsigned short *pixel = (unsigned short *)dst + x*channels;
+
+                for (int c = 0; c < channels; c++)
+                {
+                    pixel[c] = FloatToHalf(((HalfToFloat(a[x0 + c]) + HalfToFloat(a[x1 + c])) + (HalfToFloat(b[x0 + c]) + HalfToFloat(b[x1 + c])))*0.25f);
+                }
+            }
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+// Reduce two rows span to half width, averaging 2x2 pixels blocks (rounded)
+// NOTE: Source rows must contain 2*count pixels, returns number of pixels reduced
+// (SIMD processing for 1 and 4 channels, remaining pixels must be reduced by caller)
+static int ReduceMipmapSpan(const unsigned char *row0, const unsigned char *row1, unsigned char *dst, int count, int channels)
+{
+    int x = 0;
+
+#if defined(RL_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i two = _mm_set1_epi16(2);
+
+    if (channels == 4)
+    {
+        // 8 source pixels per row, 4 reduced pixels per iteration
+        for (; (x + 4) <= count; x += 4)
+        {
+            __m128i a0 = _mm_loadu_si128((const __m128i *)(row0 + x*8));
+            __m128i a1 = _mm_loadu_si128((const __m128i *)(row0 + x*8 + 16));
+            __m128i b0 = _mm_loadu_si128((const __m128i *)(row1 + x*8));
+            __m128i b1 = _mm_loadu_si128((const __m128i *)(row1 + x*8 + 16));
+
+            // Vertical sums, two pixels per register
+            __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+            __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+            __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+            __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+            // Horizontal pixel pairs sums (low 64 bits)
+            s0 = _mm_add_epi16(s0, _mm_srli_si128(s0, 8));
+            s1 = _mm_add_epi16(s1, _mm_srli_si128(s1, 8));
+            s2 = _mm_add_epi16(s2, _mm_srli_si128(s2, 8));
+            s3 = _mm_add_epi16(s3, _mm_srli_si128(s3, 8));
+
+            __m128i r0 = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(s0, s1), two), 2);
+            __m128i r1 = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(s2, s3), two), 2);
+
+            _mm_storeu_si128((__m128i *)(dst + x*4), _mm_packus_epi16(r0, r1));
+        }
+    }
+    else if (channels == 1)
+    {
+        // 32 source pixels per row, 16 reduced pixels per iteration
+        const __m128i ones = _mm_set1_epi16(1);
+
+        for (; (x + 16) <= count; x += 16)
+        {
+            __m128i a0 = _mm_loadu_si128((const __m128i *)(row0 + x*2));
+            __m128i a1 = _mm_loadu_si128((const __m128i *)(row0 + x*2 + 16));
+            __m128i b0 = _mm_loadu_si128((const __m128i *)(row1 + x*2));
+            __m128i b1 = _mm_loadu_si128((const __m128i *)(row1 + x*2 + 16));
+
+            // Vertical sums, then horizontal pairs sums (32 bit)
+            __m128i s0 = _mm_madd_epi16(_mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero)), ones);
+            __m128i s1 = _mm_madd_epi16(_mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero)), ones);
+            __m128i s2 = _mm_madd_epi16(_mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero)), ones);
+            __m128i s3 = _mm_madd_epi16(_mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero)), ones);
+
+            __m128i r0 = _mm_srli_epi16(_mm_add_epi16(_mm_packs_epi32(s0, s1), two), 2);
+            __m128i r1 = _mm_srli_epi16(_mm_add_epi16(_mm_packs_epi32(s2, s3), two), 2);
+
+            _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(r0, r1));
+        }
+    }
+#elif defined(RL_SIMD_NEON)
+    if (channels == 4)
+    {
+        // 8 source pixels per row deinterleaved in even/odd pixels, 4 reduced pixels per iteration
+        for (; (x + 4) <= count; x += 4)
+        {
+            uint32x4x2_t a = vld2q_u32((const uint32_t *)(row0 + x*8));
+            uint32x4x2_t b = vld2q_u32((const uint32_t *)(row1 + x*8));
+            uint8x16_t a0 = vreinterpretq_u8_u32(a.val[0]);
+            uint8x16_t a1 = vreinterpretq_u8_u32(a.val[1]);
+            uint8x16_t b0 = vreinterpretq_u8_u32(b.val[0]);
+            uint8x16_t b1 = vreinterpretq_u8_u32(b.val[1]);
+
+            uint16x8_t low = vaddq_u16(vaddl_u8(vget_low_u8(a0), vget_low_u8(a1)), vaddl_u8(vget_low_u8(b0), vget_low_u8(b1)));
+            uint16x8_t high = vaddq_u16(vaddl_u8(vget_high_u8(a0), vget_high_u8(a1)), vaddl_u8(vget_high_u8(b0), vget_high_u8(b1)));
+
+            vst1q_u8(dst + x*4, vcombine_u8(vrshrn_n_u16(low, 2), vrshrn_n_u16(high, 2)));
+        }
+    }
+    else if (channels == 1)
+    {
+        // 16 source pixels per row, 8 reduced pixels per iteration
+        for (; (x + 8) <= count; x += 8)
+        {
+            uint16x8_t sum = vpadalq_u8(vpaddlq_u8(vld1q_u8(row0 + x*2)), vld1q_u8(row1 + x*2));
+            vst1_u8(dst + x, vrshrn_n_u16(sum, 2));
+        }
+    }
+#endif
+
+    return x;
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Get alpha test coverage of pixels: ratio of pixels with alpha over alpha cutoff
+// NOTE: Alpha is the last channel of pixels
+static float GetAlphaCoverage(const unsigned char *pixels, int count, int channels, float alphaCutoff)
+{
+    int reference = (int)(alphaCutoff*255.0f);
+    int covered = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (pixels[i*channels + channels - 1] > reference) covered++;
+    }
+
+    return (float)covered/(float)count;
+}
+
+// Scale pixels alpha to match alpha test coverage
+// NOTE: Scale is searched by bisection over alpha histogram
+static void ScaleAlphaCoverage(unsigned char *pixels, int count, int channels, float alphaCutoff, float coverage)
+{
+    int reference = (int)(alphaCutoff*255.0f);
+    int histogram[256] = { 0 };
+
+    for (int i = 0; i < count; i++) histogram[pixels[i*channels + channels - 1]]++;
+
+    float minScale = 0.0f;
+    float maxScale = 4.0f;
+    float scale = 1.0f;
+
+    for (int k = 0; k < 16; k++)
+    {
+        int covered = 0;
+        for (int a = 0; a < 256; a++) if ((int)(a*scale + 0.5f) > reference) covered += histogram[a];
+
+        float current = (float)covered/(float)count;
+
+        if (current < coverage) minScale = scale;
+        else if (current > coverage) maxScale = scale;
+        else break;
+
+        scale = (minScale + maxScale)*0.5f;
+    }
+
+    if (scale == 1.0f) return;
+
+    for (int i = 0; i < count; i++)
+    {
+        int alpha = (int)(pixels[i*channels + channels - 1]*scale + 0.5f);
+        pixels[i*channels + channels - 1] = (unsigned char)((alpha > 255)? 255 : alpha);
+    }
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+#if defined(PNG_ENCODER_AVAILABLE)
+// Encode 8 bit per channel pixels as PNG file data
+// NOTE: Rows are split in chunks of PNG_COMPRESS_CHUNK_SIZE filtered data, filtered and compressed in parallel
+// as independent deflate streams (sync flushed) concatenated into one zlib stream, output does not depend on threads count
+// Compression level: 0-1 (Up filter, fastest matching), 2-4 (None/Sub/Up filters), 5-9 (all filters), deeper matching with level
+static unsigned char *EncodePNG(const unsigned char *pixels, int width, int height, int channels, int level, int *dataSize)
+{
+    static const unsigned char colorTypes[5] = { 0, 0, 4, 2, 6 };  // Grayscale, gray+alpha, RGB, RGBA
+
+    PNGEncodeJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.channels = channels;
+    job.level = (level < 0)? 0 : (level > 9)? 9 : level;
+    job.chunkRows = PNG_COMPRESS_CHUNK_SIZE/(width*channels + 1);
+    if (job.chunkRows < 1) job.chunkRows = 1;
+    job.chunkCount = (height + job.chunkRows - 1)/job.chunkRows;
+    job.chunks = (unsigned char **)RL_CALLOC(job.chunkCount, sizeof(unsigned char *));
+    job.chunkSizes = (int *)RL_CALLOC(job.chunkCount, sizeof(int));
+    job.chunkAdlers = (unsigned int *)RL_CALLOC(job.chunkCount, sizeof(unsigned int));
+
+    ParallelFor(job.chunkCount, 1, EncodePNGChunksBatch, &job);
+
+    // Combine chunks Adler-32 checksums (as computed over all filtered data)
+    unsigned int adler = job.chunkAdlers[0];
+    int zlibSize = 2 + 4;
+
+    for (int c = 0; c < job.chunkCount; c++)
+    {
+        if (c > 0)
+        {
+            int rows = ((c + 1)*job.chunkRows < height)? job.chunkRows : (height - c*job.chunkRows);
+            unsigned int length = (unsigned int)(rows*(width*channels + 1))%65521;
+            unsigned int sum1 = adler & 0xffff;
+            unsigned int sum2 = (length*sum1)%65521;
+            sum1 += (job.chunkAdlers[c] & 0xffff) + 65521 - 1;
+            sum2 += (adler >> 16) + (job.chunkAdlers[c] >> 16) + 65521 - length;
+            if (sum1 >= 65521) sum1 -= 65521;
+            if (sum1 >= 65521) sum1 -= 65521;
+            if (sum2 >= (65521 << 1)) sum2 -= (65521 << 1);
+            if (sum2 >= 65521) sum2 -= 65521;
+            adler = (sum2 << 16) | sum1;
+        }
+
+        zlibSize += job.chunkSizes[c];
+    }
+
+    // PNG file: signature + IHDR + IDAT (zlib stream) + IEND
+    *dataSize = 8 + (12 + 13) + (12 + zlibSize) + 12;
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(*dataSize);
+    unsigned char *ptr = fileData;
+
+    #define PNG_WRITE_U32(p, value) { (p)[0] = (unsigned char)((value) >> 24); (p)[1] = (unsigned char)((value) >> 16); (p)[2] = (unsigned char)((value) >> 8); (p)[3] = (unsigned char)(value); }
+
+    memcpy(ptr, "\x89PNG\r\n\x1a\n", 8); ptr += 8;
+
+    PNG_WRITE_U32(ptr, 13);
+    memcpy(ptr + 4, "IHDR", 4);
+    PNG_WRITE_U32(ptr + 8, width);
+    PNG_WRITE_U32(ptr + 12, height);
+    ptr[16] = 8;                        // Bit depth
+    ptr[17] = colorTypes[channels];     // Color type
+    ptr[18] = 0; ptr[19] = 0; ptr[20] = 0;  // Compression, filter and interlace methods
+    PNG_WRITE_U32(ptr + 21, ComputeCRC32(ptr + 4, 17));
+    ptr += 25;
+
+    PNG_WRITE_U32(ptr, zlibSize);
+    memcpy(ptr + 4, "IDAT", 4);
+    ptr[8] = 0x78;                      // Deflate, 32K window
+    ptr[9] = 0x01;
+    unsigned char *chunkPtr = ptr + 10;
+
+    for (int c = 0; c < job.chunkCount; c++)
+    {
+        memcpy(chunkPtr, job.chunks[c], job.chunkSizes[c]);
+        chunkPtr += job.chunkSizes[c];
+        RL_FREE(job.chunks[c]);
+    }
+
+    PNG_WRITE_U32(chunkPtr, adler);
+    PNG_WRITE_U32(chunkPtr + 4, ComputeCRC32(ptr + 4, 4 + zlibSize));
+    ptr += 12 + zlibSize;
+
+    memcpy(ptr, "\0\0\0\0IEND\xae\x42\x60\x82", 12);
+
+    RL_FREE(job.chunks);
+    RL_FREE(job.chunkSizes);
+    RL_FREE(job.chunkAdlers);
+
+    return fileData;
+}
+
+// Filter and compress PNG rows chunks
+static void EncodePNGChunksBatch(int start, int end, void *data)
+{
+    PNGEncodeJob *job = (PNGEncodeJob *)data;
+    int pitch = job->width*job->channels;
+    int filters = (job->level < 2)? 1 : (job->level < 5)? 3 : 5;
+    int sdeflLevel = (job->level > 1)? (job->level - 1) : job->level;  // sdefl levels: 0 to SDEFL_LVL_MAX (8)
+
+    struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));  // WARNING: struct sdefl is almost 1MB
+    unsigned char *filtered = (unsigned char *)RL_MALLOC((size_t)job->chunkRows*(pitch + 1));
+    unsigned char *scratch = (unsigned char *)RL_MALLOC(pitch + 1);
+    unsigned char *zeros = (unsigned char *)RL_CALLOC(pitch, 1);
+
+    for (int c = start; c < end; c++)
+    {
+        int startRow = c*job->chunkRows;
+        int endRow = ((startRow + job->chunkRows) < job->height)? (startRow + job->chunkRows) : job->height;
+        int size = (endRow - startRow)*(pitch + 1);
+
+        for (int y = startRow; y < endRow; y++)
+        {
+            const unsigned char *row = job->pixels + (size_t)y*pitch;
+            FilterPNGRow(row, (y > 0)? (row - pitch) : zeros, filtered + (size_t)(y - startRow)*(pitch + 1), scratch, pitch, job->channels, filters);
+        }
+
+        job->chunkAdlers[c] = ComputeAdler32(1, filtered, size);
+        job->chunks[c] = (unsigned char *)RL_MALLOC(sdefl_bound(size) + 5);
+
+        // NOTE: Last chunk ends the stream (final block), previous ones end with a sync flush
+        if (c == (job->chunkCount - 1)) job->chunkSizes[c] = sdeflate(sdefl, job->chunks[c], filtered, size, sdeflLevel);
+        else job->chunkSizes[c] = sdeflate_sync(sdefl, job->chunks[c], filtered, size, sdeflLevel);
+    }
+
+    RL_FREE(sdefl);
+    RL_FREE(filtered);
+    RL_FREE(scratch);
+    RL_FREE(zeros);
+}
+
+// Filter PNG row, choosing the filter type with minimum sum of absolute differences
+// NOTE: Only first filters types are tried: 1 (Up), 3 (None, Sub, Up), 5 (None, Sub, Up, Average, Paeth)
+static void FilterPNGRow(const unsigned char *row, const unsigned char *prior, unsigned char *output, unsigned char *scratch, int pitch, int bpp, int filters)
+{
+    unsigned char *best = output;
+    unsigned char *test = (filters == 1)? output : scratch;
+    unsigned int bestSum = 0xffffffff;
+
+    for (int type = (filters == 1)? 2 : 0; type < ((filters == 1)? 3 : filters); type++)
+    {
+        unsigned char *out = test + 1;
+        test[0] = (unsigned char)type;
+
+        switch (type)
+        {
+            case 0: memcpy(out, row, pitch); break;
+            case 1:
+            {
+                for (int i = 0; i < bpp; i++) out[i] = row[i];
+                for (int i = bpp; i < pitch; i++) out[i] = row[i] - row[i - bpp];
+            } break;
+            case 2: for (int i = 0; i < pitch; i++) out[i] = row[i] - prior[i]; break;
+            case 3:
+            {
+                for (int i = 0; i < bpp; i++) out[i] = row[i] - (prior[i] >> 1);
+                for (int i = bpp; i < pitch; i++) out[i] = row[i] - ((row[i - bpp] + prior[i]) >> 1);
+            } break;
+            case 4:
+            {
+                for (int i = 0; i < bpp; i++) out[i] = row[i] - prior[i];
+                for (int i = bpp; i < pitch; i++)
+                {
+                    int a = row[i - bpp], b = prior[i], c = prior[i - bpp];
+                    int pa = abs(b - c), pb = abs(a - c), pc = abs(a + b - 2*c);
+                    out[i] = row[i] - (((pa <= pb) && (pa <= pc))? a : (pb <= pc)? b : c);
+                }
+            } break;
+            default: break;
+        }
+
+        if (filters == 1) return;
+
+        // Sum of absolute values (as signed bytes)
+        unsigned int sum = 0;
+        for (int i = 0; i < pitch; i++) sum += (out[i] < 128)? out[i] : (256 - out[i]);
+
+        if (sum < bestSum)
+        {
+            bestSum = sum;
+            unsigned char *temp = best;
+            best = test;
+            test = temp;
+        }
+    }
+
+    if (best != output) memcpy(output, best, pitch + 1);
+}
+
+// Update Adler-32 checksum with data
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int dataSize)
+{
+    unsigned int sum1 = adler & 0xffff;
+    unsigned int sum2 = adler >> 16;
+
+    while (dataSize > 0)
+    {
+        // NOTE: Sums can not overflow before 5552 bytes
+        int blockSize = (dataSize < 5552)? dataSize : 5552;
+
+        for (int i = 0; i < blockSize; i++)
+        {
+            sum1 += data[i];
+            sum2 += sum1;
+        }
+
+        sum1 %= 65521;
+        sum2 %= 65521;
+        data += blockSize;
+        dataSize -= blockSize;
+    }
+
+    return (sum2 << 16) | sum1;
+}
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Load queued async requests images, runs on a background thread
+// NOTE: Task loads queued requests in order until no request is waiting
+static void LoadAsyncRequestTask(void *data)
+{
+    while (true)
+    {
+        AsyncLoadRequest *request = NULL;
+
+        LockAsyncTasks();
+
+        for (int i = 0; i < MAX_ASYNC_LOAD_REQUESTS; i++)
+        {
+            // NOTE: Order compared by difference, valid when order counter wraps around
+            if ((asyncRequests[i].state == ASYNC_LOAD_QUEUED) &&
+                ((request == NULL) || ((int)(asyncRequests[i].order - request->order) < 0))) request = &asyncRequests[i];
+        }
+
+        if (request == NULL)
+        {
+            asyncLoadTasks--;
+            UnlockAsyncTasks();
+            break;
+        }
+
+        request->state = ASYNC_LOAD_DECODING;
+        UnlockAsyncTasks();
+
+        Image image = LoadImage(request->fileName);
+
+        LockAsyncTasks();
+        request->image = image;
+        request->state = request->toTexture? ASYNC_LOAD_UPLOADING : ASYNC_LOAD_READY;
+        UnlockAsyncTasks();
+    }
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+// Compress image blocks rows in range [start, end) to GPU compressed format
+static void CompressBlocksBatch(int start, int end, void *data)
+{
+    CompressJob *job = (CompressJob *)data;
+    int blocksX = (job->width + 3)/4;
+    int blockSize = ((job->format == PIXELFORMAT_COMPRESSED_DXT3_RGBA) ||
+                     (job->format == PIXELFORMAT_COMPRESSED_DXT5_RGBA) ||
+                     (job->format == PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))? 16 : 8;
+    unsigned char block[16*4] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            // Get block pixels (row-major), pixels out of image replicate image borders
+            for (int y = 0; y < 4; y++)
+            {
+                int py = ((by*4 + y) < job->height)? (by*4 + y) : (job->height - 1);
+
+                for (int x = 0; x < 4; x++)
+                {
+                    int px = ((bx*4 + x) < job->width)? (bx*4 + x) : (job->width - 1);
+                    memcpy(block + (y*4 + x)*4, &job->pixels[py*job->width + px], 4);
+                }
+            }
+
+            unsigned char *output = job->output + (by*blocksX + bx)*blockSize;
+
+            switch (job->format)
+            {
+                case PIXELFORMAT_COMPRESSED_DXT1_RGB: CompressBlockBC1(block, output, false, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_DXT1_RGBA: CompressBlockBC1(block, output, true, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                {
+                    // Explicit 4 bit alpha
+                    for (int i = 0; i < 8; i++)
+                    {
+                        int alpha0 = (block[(i*2)*4 + 3]*15 + 127)/255;
+                        int alpha1 = (block[(i*2 + 1)*4 + 3]*15 + 127)/255;
+                        output[i] = (unsigned char)(alpha0 | (alpha1 << 4));
+                    }
+
+                    CompressBlockBC1(block, output + 8, false, job->quality);
+                } break;
+                case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                {
+                    CompressBlockBC3Alpha(block, output, job->quality);
+                    CompressBlockBC1(block, output + 8, false, job->quality);
+                } break;
+                case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+                case PIXELFORMAT_COMPRESSED_ETC2_RGB: CompressBlockETC1(block, output, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+                {
+                    CompressBlockEACAlpha(block, output, job->quality);
+                    CompressBlockETC1(block, output + 8, job->quality);
+                } break;
+                default: break;
+            }
+        }
+    }
+}
+
+// Fit BC1 block pixels indices for provided endpoints (R5G6B5), returns squared error
+// NOTE: Endpoints are ordered for required mode: 4 colors (color0 > color1) or 3 colors + transparent (color0 <= color1),
+// pixels with transparent flag set are assigned transparent index (3 colors mode only)
+static unsigned int FitBlockBC1(const unsigned char *block, const bool *transparent, unsigned short *color0, unsigned short *color1, bool threeColors, unsigned int *indices)
+{
+    if ((threeColors && (*color0 > *color1)) || (!threeColors && (*color0 < *color1)))
+    {
+        unsigned short temp = *color0;
+        *color0 = *color1;
+        *color1 = temp;
+    }
+
+    int palette[4][3] = { 0 };
+    palette[0][0] = ((*color0 >> 11) << 3) | (*color0 >> 13);
+    palette[0][1] = (((*color0 >> 5) & 0x3f) << 2) | ((*color0 >> 9) & 0x3);
+    palette[0][2] = ((*color0 & 0x1f) << 3) | ((*color0 >> 2) & 0x7);
+    palette[1][0] = ((*color1 >> 11) << 3) | (*color1 >> 13);
+    palette[1][1] = (((*color1 >> 5) & 0x3f) << 2) | ((*color1 >> 9) & 0x3);
+    palette[1][2] = ((*color1 & 0x1f) << 3) | ((*color1 >> 2) & 0x7);
+
+    // NOTE: Equal endpoints are decoded in 3 colors mode, only first color is used
+    int paletteSize = (*color0 == *color1)? 1 : (threeColors? 3 : 4);
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (threeColors) palette[2][c] = (palette[0][c] + palette[1][c])/2;
+        else
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+    }
+
+    unsigned int error = 0;
+    *indices = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (transparent[i])
+        {
+            *indices |= 3u << (i*2);
+            continue;
+        }
+
+        int bestIndex = 0;
+        int bestError = 0x7fffffff;
+
+        for (int p = 0; p < paletteSize; p++)
+        {
+            int dr = block[i*4] - palette[p][0];
+            int dg = block[i*4 + 1] - palette[p][1];
+            int db = block[i*4 + 2] - palette[p][2];
+            int pixelError = dr*dr + dg*dg + db*db;
+
+            if (pixelError < bestError)
+            {
+                bestError = pixelError;
+                bestIndex = p;
+            }
+        }
+
+        *indices |= (unsigned int)bestIndex << (i*2);
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Quantize color to R5G6B5
+static unsigned short QuantizeColor565(float r, float g, float b)
+{
+    int r5 = (int)(((r < 0.0f)? 0.0f : ((r > 255.0f)? 255.0f : r))*31.0f/255.0f + 0.5f);
+    int g6 = (int)(((g < 0.0f)? 0.0f : ((g > 255.0f)? 255.0f : g))*63.0f/255.0f + 0.5f);
+    int b5 = (int)(((b < 0.0f)? 0.0f : ((b > 255.0f)? 255.0f : b))*31.0f/255.0f + 0.5f);
+
+    return (unsigned short)((r5 << 11) | (g6 << 5) | b5);
+}
+
+// Compress 4x4 pixels block (R8G8B8A8) to BC1 (DXT1), 8 bytes
+// NOTE: Endpoints are selected from color bounding box (quality 0) or principal axis (quality 1 and 2),
+// then refined by least squares; quality 2 also searches neighbor endpoints
+static void CompressBlockBC1(const unsigned char *block, unsigned char *output, bool alpha, int quality)
+{
+    bool transparent[16] = { 0 };
+    bool threeColors = false;
+    int opaqueCount = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        transparent[i] = alpha && (block[i*4 + 3] < PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD);
+        if (transparent[i]) threeColors = true;
+        else opaqueCount++;
+    }
+
+    unsigned short color0 = 0;
+    unsigned short color1 = 0;
+    unsigned int indices = 0xffffffff;
+
+    if (opaqueCount > 0)
+    {
+        float mean[3] = { 0 };
+        float minColor[3] = { 255.0f, 255.0f, 255.0f };
+        float maxColor[3] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            if (transparent[i]) continue;
+
+            for (int c = 0; c < 3; c++)
+            {
+                float value = block[i*4 + c];
+                mean[c] += value;
+                if (value < minColor[c]) minColor[c] = value;
+                if (value > maxColor[c]) maxColor[c] = value;
+            }
+        }
+
+        for (int c = 0; c < 3; c++) mean[c] /= (float)opaqueCount;
+
+        float start[3] = { maxColor[0], maxColor[1], maxColor[2] };
+        float end[3] = { minColor[0], minColor[1], minColor[2] };
+
+        // Covariance matrix, used to select bounding box diagonal or principal axis
+        float cov[6] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            if (transparent[i]) continue;
+
+            float r = block[i*4] - mean[0];
+            float g = block[i*4 + 1] - mean[1];
+            float b = block[i*4 + 2] - mean[2];
+
+            cov[0] += r*r; cov[1] += r*g; cov[2] += r*b;
+            cov[3] += g*g; cov[4] += g*b; cov[5] += b*b;
+        }
+
+        if (quality == 0)
+        {
+            // Bounding box diagonal following color correlation, inset to reduce extremes error
+            if (cov[1] < 0.0f) { float temp = start[1]; start[1] = end[1]; end[1] = temp; }
+            if (cov[2] < 0.0f) { float temp = start[2]; start[2] = end[2]; end[2] = temp; }
+
+            for (int c = 0; c < 3; c++)
+            {
+                float inset = (start[c] - end[c])/16.0f;
+                start[c] -= inset;
+                end[c] += inset;
+            }
+        }
+        else
+        {
+            // Principal axis by power iteration, starting from bounding box diagonal
+            float axis[3] = { maxColor[0] - minColor[0], maxColor[1] - minColor[1], maxColor[2] - minColor[2] };
+            if (cov[1] < 0.0f) axis[1] = -axis[1];
+            if (cov[2] < 0.0f) axis[2] = -axis[2];
+
+            for (int k = 0; k < 8; k++)
+            {
+                float x = cov[0]*axis[0] + cov[1]*axis[1] + cov[2]*axis[2];
+                float y = cov[1]*axis[0] + cov[3]*axis[1] + cov[4]*axis[2];
+                float z = cov[2]*axis[0] + cov[4]*axis[1] + cov[5]*axis[2];
+                float length = fmaxf(fabsf(x), fmaxf(fabsf(y), fabsf(z)));
+
+                if (length < 1e-6f) break;
+
+                axis[0] = x/length;
+                axis[1] = y/length;
+                axis[2] = z/length;
+            }
+
+            float axisLength = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+
+            if (axisLength > 1e-6f)
+            {
+                float minProjection = 1e9f;
+                float maxProjection = -1e9f;
+
+                for (int i = 0; i < 16; i++)
+                {
+                    if (transparent[i]) continue;
+
+                    float projection = ((block[i*4] - mean[0])*axis[0] + (block[i*4 + 1] - mean[1])*axis[1] + (block[i*4 + 2] - mean[2])*axis[2])/axisLength;
+                    if (projection < minProjection) minProjection = projection;
+                    if (projection > maxProjection) maxProjection = projection;
+                }
+
+                for (int c = 0; c < 3; c++)
+                {
+                    start[c] = mean[c] + axis[c]*maxProjection;
+                    end[c] = mean[c] + axis[c]*minProjection;
+                }
+            }
+        }
+
+        color0 = QuantizeColor565(start[0], start[1], start[2]);
+        color1 = QuantizeColor565(end[0], end[1], end[2]);
+        unsigned int error = FitBlockBC1(block, transparent, &color0, &color1, threeColors, &indices);
+
+        // Least squares endpoints refinement for current indices
+        int iterations = (quality == 0)? 0 : ((quality == 1)? 2 : 8);
+
+        for (int k = 0; (k < iterations) && (error > 0); k++)
+        {
+            float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+            float ax[3] = { 0 };
+            float bx[3] = { 0 };
+
+            for (int i = 0; i < 16; i++)
+            {
+                if (transparent[i]) continue;
+
+                int index = (indices >> (i*2)) & 0x3;
+                float weight = 0.0f;    // First endpoint weight
+
+                if (color0 == color1) weight = 1.0f;
+                else if (threeColors) weight = (index == 0)? 1.0f : ((index == 1)? 0.0f : 0.5f);
+                else weight = (index == 0)? 1.0f : ((index == 1)? 0.0f : ((index == 2)? 2.0f/3.0f : 1.0f/3.0f));
+
+                aa += weight*weight;
+                ab += weight*(1.0f - weight);
+                bb += (1.0f - weight)*(1.0f - weight);
+
+                for (int c = 0; c < 3; c++)
+                {
+                    ax[c] += weight*block[i*4 + c];
+                    bx[c] += (1.0f - weight)*block[i*4 + c];
+                }
+            }
+
+            float det = aa*bb - ab*ab;
+            if (fabsf(det) < 1e-6f) break;
+
+            unsigned short refined0 = QuantizeColor565((ax[0]*bb - bx[0]*ab)/det, (ax[1]*bb - bx[1]*ab)/det, (ax[2]*bb - bx[2]*ab)/det);
+            unsigned short refined1 = QuantizeColor565((bx[0]*aa - ax[0]*ab)/det, (bx[1]*aa - ax[1]*ab)/det, (bx[2]*aa - ax[2]*ab)/det);
+            unsigned int refinedIndices = 0;
+            unsigned int refinedError = FitBlockBC1(block, transparent, &refined0, &refined1, threeColors, &refinedIndices);
+
+            if (refinedError >= error) break;
+
+            color0 = refined0;
+            color1 = refined1;
+            indices = refinedIndices;
+            error = refinedError;
+        }
+
+        // Neighbor endpoints search, one channel step at a time
+        if (quality >= 2)
+        {
+            static const int channelShift[3] = { 11, 5, 0 };
+            static const int channelMax[3] = { 31, 63, 31 };
+            bool improved = true;
+
+            for (int k = 0; (k < 4) && improved && (error > 0); k++)
+            {
+                improved = false;
+
+                for (int e = 0; e < 2; e++)
+                {
+                    for (int c = 0; c < 3; c++)
+                    {
+                        for (int step = -1; step <= 1; step += 2)
+                        {
+                            unsigned short candidate0 = color0;
+                            unsigned short candidate1 = color1;
+                            unsigned short *endpoint = (e == 0)? &candidate0 : &candidate1;
+                            int value = ((*endpoint >> channelShift[c]) & channelMax[c]) + step;
+
+                            if ((value < 0) || (value > channelMax[c])) continue;
+
+                            *endpoint = (unsigned short)((*endpoint & ~(channelMax[c] << channelShift[c])) | (value << channelShift[c]));
+
+                            unsigned int candidateIndices = 0;
+                            unsigned int candidateError = FitBlockBC1(block, transparent, &candidate0, &candidate1, threeColors, &candidateIndices);
+
+                            if (candidateError < error)
+                            {
+                                color0 = candidate0;
+                                color1 = candidate1;
+                                indices = candidateIndices;
+                                error = candidateError;
+                                improved = true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    output[0] = (unsigned char)(color0 & 0xff);
+    output[1] = (unsigned char)(color0 >> 8);
+    output[2] = (unsigned char)(color1 & 0xff);
+    output[3] = (unsigned char)(color1 >> 8);
+    output[4] = (unsigned char)(indices & 0xff);
+    output[5] = (unsigned char)((indices >> 8) & 0xff);
+    output[6] = (unsigned char)((indices >> 16) & 0xff);
+    output[7] = (unsigned char)(indices >> 24);
+}
+
+// Fit BC3 alpha block indices for provided endpoints, returns squared error
+// NOTE: 8 alpha values mode if alpha0 > alpha1, 6 alpha values + 0 and 255 otherwise
+static unsigned int FitBlockBC3Alpha(const unsigned char *block, int alpha0, int alpha1, unsigned long long *indices)
+{
+    int palette[8] = { alpha0, alpha1, 0, 0, 0, 0, 0, 255 };
+
+    if (alpha0 > alpha1) for (int i = 2; i < 8; i++) palette[i] = ((8 - i)*alpha0 + (i - 1)*alpha1 + 3)/7;
+    else for (int i = 2; i < 6; i++) palette[i] = ((6 - i)*alpha0 + (i - 1)*alpha1 + 2)/5;
+
+    unsigned int error = 0;
+    *indices = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int bestIndex = 0;
+        int bestError = 0x7fffffff;
+
+        for (int p = 0; p < 8; p++)
+        {
+            int pixelError = (block[i*4 + 3] - palette[p])*(block[i*4 + 3] - palette[p]);
+
+            if (pixelError < bestError)
+            {
+                bestError = pixelError;
+                bestIndex = p;
+            }
+        }
+
+        *indices |= (unsigned long long)bestIndex << (i*3);
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Compress 4x4 pixels block alpha (R8G8B8A8) to BC3 (DXT5) alpha, 8 bytes
+static void CompressBlockBC3Alpha(const unsigned char *block, unsigned char *output, int quality)
+{
+    int minAlpha = 255, maxAlpha = 0;
+    int minInner = 255, maxInner = 0;     // Excluding 0 and 255 values
+
+    for (int i = 0; i < 16; i++)
+    {
+        int value = block[i*4 + 3];
+
+        if (value < minAlpha) minAlpha = value;
+        if (value > maxAlpha) maxAlpha = value;
+
+        if ((value > 0) && (value < 255))
+        {
+            if (value < minInner) minInner = value;
+            if (value > maxInner) maxInner = value;
+        }
+    }
+
+    int alpha0 = maxAlpha;
+    int alpha1 = minAlpha;
+    unsigned long long indices = 0;
+    unsigned int error = FitBlockBC3Alpha(block, alpha0, alpha1, &indices);
+
+    if (error > 0)
+    {
+        // 6 alpha values mode, 0 and 255 values represented exactly
+        if ((quality >= 1) && (minInner <= maxInner) && ((minAlpha == 0) || (maxAlpha == 255)))
+        {
+            unsigned long long candidateIndices = 0;
+            unsigned int candidateError = FitBlockBC3Alpha(block, minInner, maxInner, &candidateIndices);
+
+            if (candidateError < error)
+            {
+                alpha0 = minInner;
+                alpha1 = maxInner;
+                indices = candidateIndices;
+                error = candidateError;
+            }
+        }
+
+        // Neighbor endpoints search
+        if (quality >= 2)
+        {
+            int base0 = alpha0;
+            int base1 = alpha1;
+
+            for (int d0 = -2; d0 <= 2; d0++)
+            {
+                for (int d1 = -2; d1 <= 2; d1++)
+                {
+                    int candidate0 = base0 + d0;
+                    int candidate1 = base1 + d1;
+
+                    if ((candidate0 < 0) || (candidate0 > 255) || (candidate1 < 0) || (candidate1 > 255)) continue;
+                    if ((base0 > base1) != (candidate0 > candidate1)) continue;     // Keep alpha mode
+
+                    unsigned long long candidateIndices = 0;
+                    unsigned int candidateError = FitBlockBC3Alpha(block, candidate0, candidate1, &candidateIndices);
+
+                    if (candidateError < error)
+                    {
+                        alpha0 = candidate0;
+                        alpha1 = candidate1;
+                        indices = candidateIndices;
+                        error = candidateError;
+                    }
+                }
+            }
+        }
+    }
+
+    output[0] = (unsigned char)alpha0;
+    output[1] = (unsigned char)alpha1;
+    for (int i = 0; i < 6; i++) output[2 + i] = (unsigned char)((indices >> (i*8)) & 0xff);
+}
+
+// ETC1 intensity modifiers tables, by pixel index: { a, b, -a, -b }
+static const int etcModifiers[8][4] = {
+    { 2, 8, -2, -8 }, { 5, 17, -5, -17 }, { 9, 29, -9, -29 }, { 13, 42, -13, -42 },
+    { 18, 60, -18, -60 }, { 24, 80, -24, -80 }, { 33, 106, -33, -106 }, { 47, 183, -47, -183 }
+};
+
+// Fit ETC1 subblock pixels for provided base color, selects modifiers table and pixels indices, returns squared error
+static unsigned int FitSubblockETC1(const unsigned char *block, const int *pixels, const int *base, int *table, unsigned int *indices)
+{
+    unsigned int bestError = 0xffffffff;
+
+    for (int t = 0; t < 8; t++)
+    {
+        unsigned int error = 0;
+        unsigned int tableIndices = 0;
+
+        for (int i = 0; i < 8; i++)
+        {
+            const unsigned char *pixel = block + pixels[i]*4;
+            int bestIndex = 0;
+            int bestPixelError = 0x7fffffff;
+
+            for (int m = 0; m < 4; m++)
+            {
+                int pixelError = 0;
+
+                for (int c = 0; c < 3; c++)
+                {
+                    int value = base[c] + etcModifiers[t][m];
+                    value = (value < 0)? 0 : ((value > 255)? 255 : value);
+                    pixelError += (value - pixel[c])*(value - pixel[c]);
+                }
+
+                if (pixelError < bestPixelError)
+                {
+                    bestPixelError = pixelError;
+                    bestIndex = m;
+                }
+            }
+
+            tableIndices |= (unsigned int)bestIndex << (i*2);
+            error += bestPixelError;
+            if (error >= bestError) break;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            *table = t;
+            *indices = tableIndices;
+        }
+    }
+
+    return bestError;
+}
+
+// Compress 4x4 pixels block (R8G8B8A8) to ETC1, 8 bytes
+// NOTE: Only individual and differential modes are used, so blocks are also valid ETC2 RGB blocks,
+// quality 1 and 2 search base colors around subblocks average color
+static void CompressBlockETC1(const unsigned char *block, unsigned char *output, int quality)
+{
+    unsigned int bestError = 0xffffffff;
+    unsigned int bestHigh = 0;
+    unsigned int bestLow = 0;
+
+    for (int flip = 0; flip < 2; flip++)
+    {
+        // Subblocks pixels (row-major block indices), first subblock is left (no flip) or top (flip)
+        int pixels[2][8] = { 0 };
+        int count[2] = { 0 };
+
+        for (int y = 0; y < 4; y++)
+        {
+            for (int x = 0; x < 4; x++)
+            {
+                int subblock = flip? (y >= 2) : (x >= 2);
+                pixels[subblock][count[subblock]++] = y*4 + x;
+            }
+        }
+
+        for (int differential = 0; differential < 2; differential++)
+        {
+            int bits = differential? 5 : 4;
+            int maxValue = (1 << bits) - 1;
+
+            // Candidate base colors per subblock: average color quantized and neighbors
+            int candidates[2][27][3] = { 0 };
+            unsigned int errors[2][27] = { 0 };
+            int tables[2][27] = { 0 };
+            unsigned int indices[2][27] = { 0 };
+            int candidateCount = 0;
+
+            for (int s = 0; s < 2; s++)
+            {
+                int average[3] = { 0 };
+
+                for (int i = 0; i < 8; i++) for (int c = 0; c < 3; c++) average[c] += block[pixels[s][i]*4 + c];
+                for (int c = 0; c < 3; c++) average[c] = ((average[c]/8)*maxValue + 127)/255;
+
+                candidateCount = 0;
+
+                for (int dr = -1; dr <= 1; dr++)
+                {
+                    for (int dg = -1; dg <= 1; dg++)
+                    {
+                        for (int db = -1; db <= 1; db++)
+                        {
+                            if ((quality == 0) && ((dr != 0) || (dg != 0) || (db != 0))) continue;
+                            if ((quality == 1) && ((dr != dg) || (dg != db))) continue;     // Only intensity offsets
+
+                            int candidate[3] = { average[0] + dr, average[1] + dg, average[2] + db };
+                            if ((candidate[0] < 0) || (candidate[0] > maxValue) ||
+                                (candidate[1] < 0) || (candidate[1] > maxValue) ||
+                                (candidate[2] < 0) || (candidate[2] > maxValue)) continue;
+
+                            int base[3] = { 0 };
+                            for (int c = 0; c < 3; c++) base[c] = differential? ((candidate[c] << 3) | (candidate[c] >> 2)) : ((candidate[c] << 4) | candidate[c]);
+
+                            memcpy(candidates[s][candidateCount], candidate, sizeof(candidate));
+                            errors[s][candidateCount] = FitSubblockETC1(block, pixels[s], base, &tables[s][candidateCount], &indices[s][candidateCount]);
+                            candidateCount++;
+                        }
+                    }
+                }
+
+                // Keep same candidates count for both subblocks, not valid candidates have max error
+                for (int i = candidateCount; i < 27; i++) errors[s][i] = 0xffffffff;
+            }
+
+            // Select best valid pair, differential mode requires base colors difference in range [-4..3]
+            for (int i = 0; i < 27; i++)
+            {
+                if (errors[0][i] == 0xffffffff) continue;
+
+                for (int j = 0; j < 27; j++)
+                {
+                    if (errors[1][j] == 0xffffffff) continue;
+                    if ((errors[0][i] + errors[1][j]) >= bestError) continue;
+
+                    int delta[3] = { 0 };
+                    bool valid = true;
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        delta[c] = candidates[1][j][c] - candidates[0][i][c];
+                        if (differential && ((delta[c] < -4) || (delta[c] > 3))) valid = false;
+                    }
+
+                    if (!valid) continue;
+
+                    bestError = errors[0][i] + errors[1][j];
+
+                    if (differential)
+                    {
+                        bestHigh = ((unsigned int)candidates[0][i][0] << 27) | ((unsigned int)(delta[0] & 0x7) << 24) |
+                                   ((unsigned int)candidates[0][i][1] << 19) | ((unsigned int)(delta[1] & 0x7) << 16) |
+                                   ((unsigned int)candidates[0][i][2] << 11) | ((unsigned int)(delta[2] & 0x7) << 8) | 0x2;
+                    }
+                    else
+                    {
+                        bestHigh = ((unsigned int)candidates[0][i][0] << 28) | ((unsigned int)candidates[1][j][0] << 24) |
+                                   ((unsigned int)candidates[0][i][1] << 20) | ((unsigned int)candidates[1][j][1] << 16) |
+                                   ((unsigned int)candidates[0][i][2] << 12) | ((unsigned int)candidates[1][j][2] << 8);
+                    }
+
+                    bestHigh |= ((unsigned int)tables[0][i] << 5) | ((unsigned int)tables[1][j] << 2) | (unsigned int)flip;
+
+                    // Pixels indices, column-major order: most significant bits [16..31], least significant bits [0..15]
+                    bestLow = 0;
+
+                    for (int s = 0; s < 2; s++)
+                    {
+                        unsigned int subblockIndices = (s == 0)? indices[0][i] : indices[1][j];
+
+                        for (int k = 0; k < 8; k++)
+                        {
+                            int index = (subblockIndices >> (k*2)) & 0x3;
+                            int pixel = (pixels[s][k]%4)*4 + pixels[s][k]/4;
+
+                            bestLow |= ((unsigned int)(index >> 1) << (16 + pixel)) | ((unsigned int)(index & 0x1) << pixel);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Block stored as big-endian
+    for (int i = 0; i < 4; i++)
+    {
+        output[i] = (unsigned char)(bestHigh >> (24 - i*8));
+        output[4 + i] = (unsigned char)(bestLow >> (24 - i*8));
+    }
+}
+
+// EAC alpha modifiers tables
+static const int eacModifiers[16][8] = {
+    { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+// Fit EAC alpha block indices for provided base, multiplier and table, returns squared error
+static unsigned int FitBlockEACAlpha(const unsigned char *block, int base, int multiplier, int table, unsigned long long *indices)
+{
+    int palette[8] = { 0 };
+
+    for (int i = 0; i < 8; i++)
+    {
+        int value = base + eacModifiers[table][i]*multiplier;
+        palette[i] = (value < 0)? 0 : ((value > 255)? 255 : value);
+    }
+
+    unsigned int error = 0;
+    *indices = 0;
+
+    // Pixels indices, column-major order, first pixel in most significant bits
+    for (int x = 0; x < 4; x++)
+    {
+        for (int y = 0; y < 4; y++)
+        {
+            int alpha = block[(y*4 + x)*4 + 3];
+            int bestIndex = 0;
+            int bestError = 0x7fffffff;
+
+            for (int p = 0; p < 8; p++)
+            {
+                int pixelError = (alpha - palette[p])*(alpha - palette[p]);
+
+                if (pixelError < bestError)
+                {
+                    bestError = pixelError;
+                    bestIndex = p;
+                }
+            }
+
+            *indices |= (unsigned long long)bestIndex << (45 - (x*4 + y)*3);
+            error += bestError;
+        }
+    }
+
+    return error;
+}
+
+// Compress 4x4 pixels block alpha (R8G8B8A8) to ETC2 EAC alpha, 8 bytes
+// NOTE: Base and multiplier are computed to cover alpha range with every modifiers table,
+// quality 1 and 2 search neighbor bases and multipliers
+static void CompressBlockEACAlpha(const unsigned char *block, unsigned char *output, int quality)
+{
+    int minAlpha = 255, maxAlpha = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (block[i*4 + 3] < minAlpha) minAlpha = block[i*4 + 3];
+        if (block[i*4 + 3] > maxAlpha) maxAlpha = block[i*4 + 3];
+    }
+
+    // Constant alpha: table 13 includes modifier 0 (index 4)
+    int bestBase = minAlpha;
+    int bestMultiplier = 1;
+    int bestTable = 13;
+    unsigned long long bestIndices = 0;
+    unsigned int bestError = FitBlockEACAlpha(block, bestBase, bestMultiplier, bestTable, &bestIndices);
+
+    int searchBase = (quality == 0)? 0 : ((quality == 1)? 1 : 2);
+    int searchMultiplier = (quality == 0)? 0 : 1;
+
+    for (int t = 0; (t < 16) && (bestError > 0); t++)
+    {
+        int tableMin = eacModifiers[t][3];
+        int tableMax = eacModifiers[t][7];
+        int multiplier = ((maxAlpha - minAlpha) + (tableMax - tableMin)/2)/(tableMax - tableMin);
+        int base = minAlpha - tableMin*multiplier;
+
+        for (int dm = -searchMultiplier; dm <= searchMultiplier; dm++)
+        {
+            int candidateMultiplier = multiplier + dm;
+            if (candidateMultiplier < 1) candidateMultiplier = 1;
+            if (candidateMultiplier > 15) candidateMultiplier = 15;
+
+            // Base centered on alpha range for current multiplier
+            int candidateBase = (minAlpha + maxAlpha)/2 - ((tableMin + tableMax)*candidateMultiplier)/2;
+            if (dm == 0) candidateBase = (base + candidateBase)/2;
+
+            for (int db = -searchBase; db <= searchBase; db++)
+            {
+                int value = candidateBase + db;
+                if ((value < 0) || (value > 255)) continue;
+
+                unsigned long long indices = 0;
+                unsigned int error = FitBlockEACAlpha(block, value, candidateMultiplier, t, &indices);
+
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestBase = value;
+                    bestMultiplier = candidateMultiplier;
+                    bestTable = t;
+                    bestIndices = indices;
+                }
+            }
+        }
+    }
+
+    output[0] = (unsigned char)bestBase;
+    output[1] = (unsigned char)((bestMultiplier << 4) | bestTable);
+    for (int i = 0; i < 6; i++) output[2 + i] = (unsigned char)((bestIndices >> (40 - i*8)) & 0xff);
 }
+#endif      // SUPPORT_IMAGE_COMPRESSION
 
 #endif      // SUPPORT_MODULE_RTEXTURES
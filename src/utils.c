@@ -7,6 +7,11 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_THREADS
+*           Use worker threads for ParallelFor() processing and background threads for RunAsyncTask(),
+*           sequential processing otherwise
+*           NOTE: Uses Win32 threads on Windows and pthreads on other platforms, not available on PLATFORM_WEB
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +54,68 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_STANDARD_FILEIO) && (defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__)) && \
+    !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB) && !defined(__EMSCRIPTEN__)
+    #define MAPPED_FILES_AVAILABLE
+    #include <sys/mman.h>               // Required for: mmap(), munmap()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+#endif
+
+#if defined(SUPPORT_THREADS) && !defined(PLATFORM_WEB) && !defined(__EMSCRIPTEN__)
+    #define THREADS_AVAILABLE
+    #if defined(_WIN32)
+        #include <process.h>            // Required for: _beginthreadex()
+
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **srwLock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **srwLock);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **conditionVariable, void **srwLock, unsigned long milliseconds, unsigned long flags);
+        __declspec(dllimport) void __stdcall WakeConditionVariable(void **conditionVariable);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(void **conditionVariable);
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()
+        #include <unistd.h>             // Required for: sysconf()
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS           16         // Max number of worker threads for parallel processing
+#endif
+#ifndef MAX_ASYNC_TASKS
+    #define MAX_ASYNC_TASKS             256         // Max number of queued async tasks
+#endif
+#ifndef MAX_PARALLEL_JOBS
+    #define MAX_PARALLEL_JOBS            16         // Max number of ParallelFor() calls processed simultaneously by worker threads
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Parallel processing job, items range split in batches processed by worker threads and calling thread
+typedef struct ParallelForJob {
+    ParallelForCallback callback;   // Processing callback
+    void *userData;                 // Processing user data
+    int count;                      // Items count, range [0, count)
+    int batchCount;                 // Batches count
+    int nextBatch;                  // Next batch to be processed (protected by workers lock)
+    int pendingBatches;             // Batches not completed (protected by workers lock)
+} ParallelForJob;
+
+// Async task, queued to be run by a background thread
+typedef struct AsyncTask {
+    AsyncTaskCallback callback;     // Task callback
+    void *userData;                 // Task user data
+} AsyncTask;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +128,41 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+static int workerThreads = 0;                       // Worker threads for parallel processing (0: Use available processors)
+
+#if defined(THREADS_AVAILABLE)
+static AsyncTask asyncTasks[MAX_ASYNC_TASKS] = { 0 };   // Async tasks queue (ring buffer)
+static int asyncTaskFirst = 0;                      // Async tasks queue first task index
+static int asyncTaskCount = 0;                      // Async tasks queue tasks count
+static int asyncThreadCount = 0;                    // Async background threads running
+static bool asyncClosing = false;                   // Async background threads closing requested
+#if defined(_WIN32)
+static void *asyncLock = NULL;                      // Async tasks shared data lock (SRWLOCK)
+static void *asyncCondition = NULL;                 // Async tasks queue condition (CONDITION_VARIABLE)
+static void *asyncThreads[MAX_WORKER_THREADS] = { 0 };
+#else
+static pthread_mutex_t asyncLock = PTHREAD_MUTEX_INITIALIZER;   // Async tasks shared data lock
+static pthread_cond_t asyncCondition = PTHREAD_COND_INITIALIZER; // Async tasks queue condition
+static pthread_t asyncThreads[MAX_WORKER_THREADS] = { 0 };
+#endif
+
+static ParallelForJob *workerJobs[MAX_PARALLEL_JOBS] = { 0 };  // Parallel processing jobs with batches to be processed
+static int workerJobCount = 0;                      // Parallel processing jobs count
+static int workerThreadCount = 0;                   // Worker threads running (persistent, created on first use)
+static bool workerClosing = false;                  // Worker threads closing requested
+#if defined(_WIN32)
+static void *workerLock = NULL;                     // Worker threads shared data lock (SRWLOCK)
+static void *workerCondition = NULL;                // Worker threads jobs condition (CONDITION_VARIABLE)
+static void *workerDoneCondition = NULL;            // Worker threads batches completed condition (CONDITION_VARIABLE)
+static void *workerThreadsHandles[MAX_WORKER_THREADS] = { 0 };
+#else
+static pthread_mutex_t workerLock = PTHREAD_MUTEX_INITIALIZER;      // Worker threads shared data lock
+static pthread_cond_t workerCondition = PTHREAD_COND_INITIALIZER;   // Worker threads jobs condition
+static pthread_cond_t workerDoneCondition = PTHREAD_COND_INITIALIZER;   // Worker threads batches completed condition
+static pthread_t workerThreadsHandles[MAX_WORKER_THREADS] = { 0 };
+#endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -94,6 +190,20 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(THREADS_AVAILABLE)
+#if defined(_WIN32)
+static unsigned __stdcall ParallelForThread(void *arg);    // Parallel processing worker thread entry point
+static unsigned __stdcall AsyncTaskThread(void *arg);      // Async tasks background thread entry point
+#else
+static void *ParallelForThread(void *arg);                  // Parallel processing worker thread entry point
+static void *AsyncTaskThread(void *arg);                    // Async tasks background thread entry point
+#endif
+static void LockWorkers(void);                              // Lock data shared with worker threads
+static void UnlockWorkers(void);                            // Unlock data shared with worker threads
+static void ProcessParallelForBatch(ParallelForJob *job);   // Process next batch of job, requires LockWorkers()
+static void CloseWorkerThreads(void);                       // Wait for parallel processing jobs and close worker threads
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -157,6 +267,223 @@ void TraceLog(int logType, const char *text, ...)
 #endif  // SUPPORT_TRACELOG
 }
 
+// Set number of worker threads used for parallel processing
+// NOTE: 0 uses all available processors (default), 1 disables worker threads
+void SetWorkerThreads(int count)
+{
+    if (count < 0) count = 0;
+    if (count > MAX_WORKER_THREADS) count = MAX_WORKER_THREADS;
+
+    workerThreads = count;
+}
+
+// Get number of worker threads used for parallel processing
+int GetWorkerThreadCount(void)
+{
+    int count = 1;
+
+#if defined(THREADS_AVAILABLE)
+    if (workerThreads > 0) count = workerThreads;
+    else
+    {
+    #if defined(_WIN32)
+        count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+    #else
+        count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+    }
+
+    if (count < 1) count = 1;
+    if (count > MAX_WORKER_THREADS) count = MAX_WORKER_THREADS;
+#endif
+
+    return count;
+}
+
+// Process items range [0, count) split in contiguous batches between worker threads
+// NOTE: Batches are processed by persistent worker threads (created on first use) and calling thread,
+// batches are at least minBatchSize items, callback must only write data owned by its range,
+// so results do not depend on the number of threads
+void ParallelFor(int count, int minBatchSize, ParallelForCallback callback, void *userData)
+{
+    if ((count <= 0) || (callback == NULL)) return;
+    if (minBatchSize < 1) minBatchSize = 1;
+
+    int batchCount = GetWorkerThreadCount();
+    if (batchCount > count/minBatchSize) batchCount = count/minBatchSize;
+
+#if defined(THREADS_AVAILABLE)
+    if (batchCount > 1)
+    {
+        ParallelForJob job = { 0 };
+        job.callback = callback;
+        job.userData = userData;
+        job.count = count;
+        job.batchCount = batchCount;
+        job.pendingBatches = batchCount;
+
+        bool queued = false;
+
+        LockWorkers();
+
+        // Worker threads are created on first use, calling thread also processes batches
+        while (!workerClosing && (workerThreadCount < (batchCount - 1)))
+        {
+        #if defined(_WIN32)
+            workerThreadsHandles[workerThreadCount] = (void *)_beginthreadex(NULL, 0, ParallelForThread, NULL, 0, NULL);
+            if (workerThreadsHandles[workerThreadCount] == NULL) break;
+        #else
+            if (pthread_create(&workerThreadsHandles[workerThreadCount], NULL, ParallelForThread, NULL) != 0) break;
+        #endif
+            workerThreadCount++;
+        }
+
+        if ((workerThreadCount > 0) && !workerClosing && (workerJobCount < MAX_PARALLEL_JOBS))
+        {
+            workerJobs[workerJobCount] = &job;
+            workerJobCount++;
+            queued = true;
+
+        #if defined(_WIN32)
+            WakeAllConditionVariable(&workerCondition);
+        #else
+            pthread_cond_broadcast(&workerCondition);
+        #endif
+        }
+
+        if (queued)
+        {
+            // Process job batches not taken by worker threads, then wait for the ones being processed
+            while (job.nextBatch < job.batchCount) ProcessParallelForBatch(&job);
+
+            while (job.pendingBatches > 0)
+            {
+            #if defined(_WIN32)
+                SleepConditionVariableSRW(&workerDoneCondition, &workerLock, 0xffffffff, 0);   // INFINITE
+            #else
+                pthread_cond_wait(&workerDoneCondition, &workerLock);
+            #endif
+            }
+        }
+
+        UnlockWorkers();
+
+        if (queued) return;
+    }
+#endif
+
+    callback(0, count, userData);
+}
+
+// Run task on a background thread, tasks are queued and run in order by available background threads
+// NOTE: Background threads are created on first use, task runs on calling thread if threads are not available
+void RunAsyncTask(AsyncTaskCallback task, void *userData)
+{
+    if (task == NULL) return;
+
+#if defined(THREADS_AVAILABLE)
+    bool queued = false;
+
+    LockAsyncTasks();
+
+    if ((asyncThreadCount == 0) && !asyncClosing)
+    {
+        int count = GetWorkerThreadCount();
+
+        for (int i = 0; i < count; i++)
+        {
+        #if defined(_WIN32)
+            asyncThreads[asyncThreadCount] = (void *)_beginthreadex(NULL, 0, AsyncTaskThread, NULL, 0, NULL);
+            if (asyncThreads[asyncThreadCount] != NULL) asyncThreadCount++;
+        #else
+            if (pthread_create(&asyncThreads[asyncThreadCount], NULL, AsyncTaskThread, NULL) == 0) asyncThreadCount++;
+        #endif
+        }
+    }
+
+    if ((asyncThreadCount > 0) && !asyncClosing && (asyncTaskCount < MAX_ASYNC_TASKS))
+    {
+        AsyncTask *queuedTask = &asyncTasks[(asyncTaskFirst + asyncTaskCount)%MAX_ASYNC_TASKS];
+        queuedTask->callback = task;
+        queuedTask->userData = userData;
+        asyncTaskCount++;
+        queued = true;
+
+    #if defined(_WIN32)
+        WakeConditionVariable(&asyncCondition);
+    #else
+        pthread_cond_signal(&asyncCondition);
+    #endif
+    }
+
+    UnlockAsyncTasks();
+
+    if (queued) return;
+
+    TRACELOGD("SYSTEM: Async tasks queue not available, running task on calling thread");
+#endif
+
+    task(userData);
+}
+
+// Lock data shared with async tasks
+// NOTE: Data written by a task must be accessed with lock from other threads
+void LockAsyncTasks(void)
+{
+#if defined(THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&asyncLock);
+    #else
+    pthread_mutex_lock(&asyncLock);
+    #endif
+#endif
+}
+
+// Unlock data shared with async tasks
+void UnlockAsyncTasks(void)
+{
+#if defined(THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&asyncLock);
+    #else
+    pthread_mutex_unlock(&asyncLock);
+    #endif
+#endif
+}
+
+// Wait for queued async tasks to be completed and close background threads
+// NOTE: Parallel processing worker threads are also closed, created again on next use
+void CloseAsyncTasks(void)
+{
+#if defined(THREADS_AVAILABLE)
+    LockAsyncTasks();
+    asyncClosing = true;
+    #if defined(_WIN32)
+    WakeAllConditionVariable(&asyncCondition);
+    #else
+    pthread_cond_broadcast(&asyncCondition);
+    #endif
+    UnlockAsyncTasks();
+
+    for (int i = 0; i < asyncThreadCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(asyncThreads[i], 0xffffffff);    // INFINITE
+        CloseHandle(asyncThreads[i]);
+    #else
+        pthread_join(asyncThreads[i], NULL);
+    #endif
+    }
+
+    LockAsyncTasks();
+    asyncThreadCount = 0;
+    asyncClosing = false;
+    UnlockAsyncTasks();
+
+    CloseWorkerThreads();
+#endif
+}
+
 // Internal memory allocator
 // NOTE: Initializes to zero by default
 void *MemAlloc(unsigned int size)
@@ -250,6 +577,52 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Map file into memory, pages are loaded on demand by the OS
+// NOTE: Mapping is private copy-on-write, data can be modified in place without changing the file,
+// returns NULL when mapping is not available (platform or custom file callback), use LoadFileData() instead
+void *MapFileData(const char *fileName, int *dataSize)
+{
+    void *data = NULL;
+    *dataSize = 0;
+
+#if defined(MAPPED_FILES_AVAILABLE)
+    if ((fileName == NULL) || (loadFileData != NULL)) return NULL;
+
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat info = { 0 };
+
+        // WARNING: dataSize is unified along raylib as a 'int' type, so, for file-sizes > INT_MAX (2147483647 bytes) we have a limitation
+        if ((fstat(fd, &info) == 0) && (info.st_size > 0) && (info.st_size <= 2147483647))
+        {
+            void *mapping = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                data = mapping;
+                *dataSize = (int)info.st_size;
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to map file", fileName);
+        }
+
+        close(fd);      // Mapping keeps a reference to the file
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#endif
+
+    return data;
+}
+
+// Unmap file data mapped with MapFileData()
+void UnmapFileData(void *data, int dataSize)
+{
+#if defined(MAPPED_FILES_AVAILABLE)
+    if ((data != NULL) && (dataSize > 0)) munmap(data, (size_t)dataSize);
+#endif
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -508,3 +881,156 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+#if defined(THREADS_AVAILABLE)
+// Parallel processing worker thread entry point, processes jobs batches until closing is requested and no jobs are left
+#if defined(_WIN32)
+static unsigned __stdcall ParallelForThread(void *arg)
+#else
+static void *ParallelForThread(void *arg)
+#endif
+{
+    LockWorkers();
+
+    while (true)
+    {
+        while ((workerJobCount == 0) && !workerClosing)
+        {
+        #if defined(_WIN32)
+            SleepConditionVariableSRW(&workerCondition, &workerLock, 0xffffffff, 0);   // INFINITE
+        #else
+            pthread_cond_wait(&workerCondition, &workerLock);
+        #endif
+        }
+
+        if (workerJobCount == 0) break;
+
+        ProcessParallelForBatch(workerJobs[0]);     // Oldest job first
+    }
+
+    UnlockWorkers();
+
+    return 0;
+}
+
+// Lock data shared with worker threads
+static void LockWorkers(void)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&workerLock);
+#else
+    pthread_mutex_lock(&workerLock);
+#endif
+}
+
+// Unlock data shared with worker threads
+static void UnlockWorkers(void)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&workerLock);
+#else
+    pthread_mutex_unlock(&workerLock);
+#endif
+}
+
+// Process next batch of job, job is removed from jobs list once all its batches are taken
+// NOTE: Requires LockWorkers(), lock is released while batch is processed
+static void ProcessParallelForBatch(ParallelForJob *job)
+{
+    int batch = job->nextBatch;
+    job->nextBatch++;
+
+    if (job->nextBatch == job->batchCount)
+    {
+        for (int i = 0; i < workerJobCount; i++)
+        {
+            if (workerJobs[i] == job)
+            {
+                for (int j = i; j < (workerJobCount - 1); j++) workerJobs[j] = workerJobs[j + 1];
+                workerJobCount--;
+                break;
+            }
+        }
+    }
+
+    UnlockWorkers();
+    job->callback((int)((long long)job->count*batch/job->batchCount), (int)((long long)job->count*(batch + 1)/job->batchCount), job->userData);
+    LockWorkers();
+
+    job->pendingBatches--;
+
+    if (job->pendingBatches == 0)
+    {
+    #if defined(_WIN32)
+        WakeAllConditionVariable(&workerDoneCondition);
+    #else
+        pthread_cond_broadcast(&workerDoneCondition);
+    #endif
+    }
+}
+
+// Wait for parallel processing jobs to be completed and close worker threads
+static void CloseWorkerThreads(void)
+{
+    LockWorkers();
+    int threadCount = workerThreadCount;
+    workerClosing = true;
+    #if defined(_WIN32)
+    WakeAllConditionVariable(&workerCondition);
+    #else
+    pthread_cond_broadcast(&workerCondition);
+    #endif
+    UnlockWorkers();
+
+    for (int i = 0; i < threadCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(workerThreadsHandles[i], 0xffffffff);    // INFINITE
+        CloseHandle(workerThreadsHandles[i]);
+    #else
+        pthread_join(workerThreadsHandles[i], NULL);
+    #endif
+    }
+
+    LockWorkers();
+    workerThreadCount = 0;
+    workerClosing = false;
+    UnlockWorkers();
+}
+
+// Async tasks background thread entry point, runs queued tasks until closing is requested and queue is empty
+#if defined(_WIN32)
+static unsigned __stdcall AsyncTaskThread(void *arg)
+#else
+static void *AsyncTaskThread(void *arg)
+#endif
+{
+    LockAsyncTasks();
+
+    while (true)
+    {
+        while ((asyncTaskCount == 0) && !asyncClosing)
+        {
+        #if defined(_WIN32)
+            SleepConditionVariableSRW(&asyncCondition, &asyncLock, 0xffffffff, 0);   // INFINITE
+        #else
+            pthread_cond_wait(&asyncCondition, &asyncLock);
+        #endif
+        }
+
+        if (asyncTaskCount == 0) break;
+
+        AsyncTask task = asyncTasks[asyncTaskFirst];
+        asyncTaskFirst = (asyncTaskFirst + 1)%MAX_ASYNC_TASKS;
+        asyncTaskCount--;
+
+        UnlockAsyncTasks();
+        task.callback(task.userData);
+        LockAsyncTasks();
+    }
+
+    UnlockAsyncTasks();
+
+    return 0;
+}
+#endif
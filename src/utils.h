@@ -52,10 +52,35 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// Thread-local storage qualifier, used by internal static buffers to be safe from multiple threads
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+    #define RL_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+    #define RL_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+    #define RL_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+    #define RL_THREAD_LOCAL __thread
+#else
+    #define RL_THREAD_LOCAL
+#endif
+
+// SIMD instruction sets available at compile time, used by some internal processing loops
+// NOTE: Modules include the required intrinsics headers when they use them
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RL_SIMD_SSE2
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (defined(__aarch64__) || defined(_M_ARM64))
+    #define RL_SIMD_NEON
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Parallel processing callback, processes items in range [start, end)
+typedef void (*ParallelForCallback)(int start, int end, void *userData);
+
+// Async task callback, runs on a background thread
+typedef void (*AsyncTaskCallback)(void *userData);
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +99,16 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+int GetWorkerThreadCount(void);                                        // Get number of worker threads used for parallel processing
+void ParallelFor(int count, int minBatchSize, ParallelForCallback callback, void *userData); // Process items range [0, count) split in batches between worker threads
+void RunAsyncTask(AsyncTaskCallback task, void *userData);             // Run task on a background thread (queued), runs on calling thread if not available
+void LockAsyncTasks(void);                                             // Lock data shared with async tasks
+void UnlockAsyncTasks(void);                                           // Unlock data shared with async tasks
+void CloseAsyncTasks(void);                                            // Wait for queued async tasks and close background threads (async and worker threads)
+
+void *MapFileData(const char *fileName, int *dataSize);                // Map file into memory (private copy-on-write pages), NULL if not available
+void UnmapFileData(void *data, int dataSize);                          // Unmap file data mapped with MapFileData()
+
 #if defined(__cplusplus)
 }
 #endif